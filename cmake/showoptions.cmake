@@ -63,6 +63,13 @@ else()
   message("* Use coreside debug     : No  (default)")
 endif()
 
+if( WITH_DEBUG_LOG )
+  message("* Build debug log calls  : Yes (default)")
+else()
+  message("* Build debug log calls  : No")
+  add_definitions(-DTRINITY_LOG_NO_DEBUG)
+endif()
+
 if( WIN32 )
   if( USE_MYSQL_SOURCES )
     message("* Use MySQL sourcetree   : Yes (default)")
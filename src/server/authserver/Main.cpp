@@ -32,6 +32,8 @@
 #include "SignalHandler.h"
 #include "RealmList.h"
 #include "RealmAcceptor.h"
+#include "RealmSocketMgr.h"
+#include "Timer.h"
 
 #ifndef _TRINITY_REALM_CONFIG
 # define _TRINITY_REALM_CONFIG  "authserver.conf"
@@ -39,6 +41,7 @@
 
 bool StartDB();
 void StopDB();
+int32 GetAuthWorkerThreads();
 
 bool stopEvent = false;                                     // Setting it to true stops the server
 
@@ -109,7 +112,7 @@ extern int main(int argc, char **argv)
     ACE_Reactor::instance(new ACE_Reactor(new ACE_TP_Reactor(), true), true);
 #endif
 
-    sLog->outDebug(LOG_FILTER_AUTHSERVER, "Max allowed open files is %d", ACE::max_handles());
+    TC_LOG_DEBUG(LOG_FILTER_AUTHSERVER, "Max allowed open files is %d", ACE::max_handles());
 
     // authserver PID file creation
     std::string pidfile = ConfigMgr::GetStringDefault("PidFile", "");
@@ -138,6 +141,16 @@ extern int main(int argc, char **argv)
         return 1;
     }
 
+    int32 networkThreads = ConfigMgr::GetIntDefault("Network.Threads", 1);
+    if (networkThreads < 1)
+    {
+        sLog->outError(LOG_FILTER_AUTHSERVER, "Network.Threads must be at least 1, defaulting to 1.");
+        networkThreads = 1;
+    }
+
+    if (!sRealmSocketMgr->Start(size_t(networkThreads), size_t(GetAuthWorkerThreads())))
+        return 1;
+
     // Launch the listening network socket
     RealmAcceptor acceptor;
 
@@ -208,6 +221,9 @@ extern int main(int argc, char **argv)
     uint32 numLoops = (ConfigMgr::GetIntDefault("MaxPingTime", 30) * (MINUTE * 1000000 / 100000));
     uint32 loopCounter = 0;
 
+    uint32 statsInterval = ConfigMgr::GetIntDefault("Network.StatsInterval", 60) * IN_MILLISECONDS;
+    uint32 lastStatsTime = getMSTime();
+
     // Wait for termination signal
     while (!stopEvent)
     {
@@ -223,8 +239,19 @@ extern int main(int argc, char **argv)
             sLog->outInfo(LOG_FILTER_AUTHSERVER, "Ping MySQL to keep connection alive");
             LoginDatabase.KeepAlive();
         }
+
+        if (statsInterval && getMSTimeDiff(lastStatsTime, getMSTime()) >= statsInterval)
+        {
+            uint32 now = getMSTime();
+            sRealmSocketMgr->LogStats(getMSTimeDiff(lastStatsTime, now));
+            lastStatsTime = now;
+        }
     }
 
+    // Stop accepting, then the workers and the network threads
+    acceptor.close();
+    sRealmSocketMgr->Stop();
+
     // Close the Database Pool and library
     StopDB();
 
@@ -251,14 +278,15 @@ bool StartDB()
         worker_threads = 1;
     }
 
-    int32 synch_threads = ConfigMgr::GetIntDefault("LoginDatabase.SynchThreads", 1);
+    // one synchronous connection per thread running the commands, see RealmSocketMgr
+    int32 synch_default = std::max(GetAuthWorkerThreads(), 1);
+    int32 synch_threads = ConfigMgr::GetIntDefault("LoginDatabase.SynchThreads", synch_default);
     if (synch_threads < 1 || synch_threads > 32)
     {
-        sLog->outError(LOG_FILTER_AUTHSERVER, "Improper value specified for LoginDatabase.SynchThreads, defaulting to 1.");
-        synch_threads = 1;
+        sLog->outError(LOG_FILTER_AUTHSERVER, "Improper value specified for LoginDatabase.SynchThreads, defaulting to %d.", synch_default);
+        synch_threads = synch_default;
     }
 
-    // NOTE: While authserver is singlethreaded you should keep synch_threads == 1. Increasing it is just silly since only 1 will be used ever.
     if (!LoginDatabase.Open(dbstring.c_str(), uint8(worker_threads), uint8(synch_threads)))
     {
         sLog->outError(LOG_FILTER_AUTHSERVER, "Cannot connect to database");
@@ -270,6 +298,12 @@ bool StartDB()
     return true;
 }
 
+int32 GetAuthWorkerThreads()
+{
+    int32 workerThreads = ConfigMgr::GetIntDefault("Network.WorkerThreads", 4);
+    return workerThreads < 0 || workerThreads > 32 ? 4 : workerThreads;
+}
+
 void StopDB()
 {
     LoginDatabase.Close();
@@ -68,6 +68,13 @@ void RealmList::UpdateIfNeed()
     UpdateRealms();
 }
 
+void RealmList::GetRealms(RealmMap& realms)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    UpdateIfNeed();
+    realms = m_realms;
+}
+
 void RealmList::UpdateRealms(bool init)
 {
     sLog->outInfo(LOG_FILTER_AUTHSERVER, "Updating Realm List...");
@@ -21,6 +21,7 @@
 
 #include <ace/Singleton.h>
 #include <ace/Null_Mutex.h>
+#include <ace/Thread_Mutex.h>
 #include "Common.h"
 
 enum RealmFlags
@@ -64,6 +65,9 @@ public:
 
     void UpdateIfNeed();
 
+    // copy of the realms, updated first if needed, for the auth worker threads
+    void GetRealms(RealmMap& realms);
+
     void AddRealm(Realm NewRealm) {m_realms[NewRealm.name] = NewRealm;}
 
     RealmMap::const_iterator begin() const { return m_realms.begin(); }
@@ -77,6 +81,7 @@ private:
     void UpdateRealms(bool init=false);
     void UpdateRealm(uint32 ID, const std::string& name, const std::string& address, uint16 port, uint8 icon, RealmFlags flag, uint8 timezone, AccountTypes allowedSecurityLevel, float popu, uint32 build);
 
+    ACE_Thread_Mutex m_lock;                                // protects m_realms once the network is started
     RealmMap m_realms;
     FirewallFarms m_firewallFarms;
     uint32   m_UpdateInterval;
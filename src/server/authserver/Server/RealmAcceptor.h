@@ -23,6 +23,7 @@
 #include <ace/SOCK_Acceptor.h>
 
 #include "RealmSocket.h"
+#include "RealmSocketMgr.h"
 #include "AuthSocket.h"
 
 class RealmAcceptor : public ACE_Acceptor<RealmSocket, ACE_SOCK_Acceptor>
@@ -41,14 +42,15 @@ protected:
         if (sh == 0)
             ACE_NEW_RETURN(sh, RealmSocket, -1);
 
-        sh->reactor(reactor());
+        // the connection lives on a network thread, the acceptor stays on the main reactor
+        sh->reactor(sRealmSocketMgr->GetNextReactor());
         sh->set_session(new AuthSocket(*sh));
         return 0;
     }
 
     virtual int handle_timeout(const ACE_Time_Value& /*current_time*/, const void* /*act = 0*/)
     {
-        sLog->outDebug(LOG_FILTER_AUTHSERVER, "Resuming acceptor");
+        TC_LOG_DEBUG(LOG_FILTER_AUTHSERVER, "Resuming acceptor");
         reactor()->cancel_timer(this, 1);
         return reactor()->register_handler(this, ACE_Event_Handler::ACCEPT_MASK);
     }
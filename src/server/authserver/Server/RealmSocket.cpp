@@ -19,9 +19,12 @@
 #include <ace/OS_NS_string.h>
 #include <ace/INET_Addr.h>
 #include <ace/SString.h>
+#include <ace/Guard_T.h>
 
 #include "RealmSocket.h"
+#include "RealmSocketMgr.h"
 #include "Log.h"
+#include "Timer.h"
 
 #ifndef MSG_NOSIGNAL
 #define MSG_NOSIGNAL 0
@@ -32,7 +35,8 @@ RealmSocket::Session::Session(void) {}
 RealmSocket::Session::~Session(void) { }
 
 RealmSocket::RealmSocket(void) :
-    input_buffer_(4096), session_(NULL),
+    lock_(), input_buffer_(4096), processing_(false), pending_input_(false), read_suspended_(false),
+    scheduled_time_(0), session_(NULL),
     _remoteAddress(), _remotePort(0)
 {
     reference_counting_policy().value(ACE_Event_Handler::Reference_Counting_Policy::ENABLED);
@@ -75,6 +79,8 @@ int RealmSocket::open(void * arg)
     if (session_)
         session_->OnAccept();
 
+    sRealmSocketMgr->OnConnectionOpened();
+
     // reactor takes care of the socket from now on
     remove_reference();
 
@@ -83,15 +89,27 @@ int RealmSocket::open(void * arg)
 
 int RealmSocket::close(int)
 {
-    shutdown();
+    Base::shutdown();
 
-    closing_ = true;
+    set_closing();
 
     remove_reference();
 
     return 0;
 }
 
+bool RealmSocket::is_closing(void) const
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+    return closing_;
+}
+
+void RealmSocket::set_closing(void)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+    closing_ = true;
+}
+
 const std::string& RealmSocket::getRemoteAddress(void) const
 {
     return _remoteAddress;
@@ -104,11 +122,13 @@ uint16 RealmSocket::getRemotePort(void) const
 
 size_t RealmSocket::recv_len(void) const
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
     return input_buffer_.length();
 }
 
 bool RealmSocket::recv_soft(char *buf, size_t len)
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
     if (input_buffer_.length() < len)
         return false;
 
@@ -119,16 +139,19 @@ bool RealmSocket::recv_soft(char *buf, size_t len)
 
 bool RealmSocket::recv(char *buf, size_t len)
 {
-    bool ret = recv_soft(buf, len);
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+    if (input_buffer_.length() < len)
+        return false;
 
-    if (ret)
-        recv_skip(len);
+    ACE_OS::memcpy(buf, input_buffer_.rd_ptr(), len);
+    input_buffer_.rd_ptr(len);
 
-    return ret;
+    return true;
 }
 
 void RealmSocket::recv_skip(size_t len)
 {
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
     input_buffer_.rd_ptr(len);
 }
 
@@ -169,30 +192,35 @@ bool RealmSocket::send(const char *buf, size_t len)
 
     message_block.wr_ptr(len);
 
-    if (msg_queue()->is_empty())
     {
-        // Try to send it directly.
-        ssize_t n = noblk_send(message_block);
+        TRINITY_GUARD(ACE_Thread_Mutex, lock_);
 
-        if (n < 0)
-            return false;
+        if (msg_queue()->is_empty())
+        {
+            // Try to send it directly.
+            ssize_t n = noblk_send(message_block);
 
-        size_t un = size_t(n);
-        if (un == len)
-            return true;
+            if (n < 0)
+                return false;
 
-        // fall down
-        message_block.rd_ptr(un);
-    }
+            size_t un = size_t(n);
+            if (un == len)
+                return true;
 
-    ACE_Message_Block* mb = message_block.clone();
+            // fall down
+            message_block.rd_ptr(un);
+        }
 
-    if (msg_queue()->enqueue_tail(mb, (ACE_Time_Value *)(&ACE_Time_Value::zero)) == -1)
-    {
-        mb->release();
-        return false;
+        ACE_Message_Block* mb = message_block.clone();
+
+        if (msg_queue()->enqueue_tail(mb, (ACE_Time_Value *)(&ACE_Time_Value::zero)) == -1)
+        {
+            mb->release();
+            return false;
+        }
     }
 
+    // outside of the lock, the reactor thread may wait for it in handle_output
     if (reactor()->schedule_wakeup(this, ACE_Event_Handler::WRITE_MASK) == -1)
         return false;
 
@@ -201,11 +229,13 @@ bool RealmSocket::send(const char *buf, size_t len)
 
 int RealmSocket::handle_output(ACE_HANDLE)
 {
+    ACE_Message_Block* mb = 0;
+
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+
     if (closing_)
         return -1;
 
-    ACE_Message_Block* mb = 0;
-
     if (msg_queue()->is_empty())
     {
         reactor()->cancel_wakeup(this, ACE_Event_Handler::WRITE_MASK);
@@ -243,10 +273,24 @@ int RealmSocket::handle_output(ACE_HANDLE)
     ACE_NOTREACHED(return -1);
 }
 
+void RealmSocket::shutdown(void)
+{
+    set_closing();
+
+    // handle_exception returns -1, the reactor closes the socket
+    if (reactor()->notify(this, ACE_Event_Handler::EXCEPT_MASK) == -1)
+        Base::shutdown();
+}
+
+int RealmSocket::handle_exception(ACE_HANDLE)
+{
+    return -1;
+}
+
 int RealmSocket::handle_close(ACE_HANDLE h, ACE_Reactor_Mask)
 {
-    // As opposed to WorldSocket::handle_close, we don't need locks here.
-    closing_ = true;
+    // a worker may still be processing the input
+    set_closing();
 
     if (h == ACE_INVALID_HANDLE)
         peer().close_writer();
@@ -260,30 +304,119 @@ int RealmSocket::handle_close(ACE_HANDLE h, ACE_Reactor_Mask)
 
 int RealmSocket::handle_input(ACE_HANDLE)
 {
-    if (closing_)
-        return -1;
+    ssize_t space, n = 0;
+    int error = 0;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, lock_);
 
-    const ssize_t space = input_buffer_.space();
+        if (closing_)
+            return -1;
+
+        // drop what the session already consumed
+        input_buffer_.crunch();
+        space = input_buffer_.space();
+
+        // a recv of 0 bytes would look like EOF
+        if (space > 0)
+        {
+            n = peer().recv(input_buffer_.wr_ptr(), space);
+            error = errno;
+
+            if (n > 0)
+                input_buffer_.wr_ptr((size_t)n);
+        }
+    }
+
+    if (space == 0)
+    {
+        // the session did not consume the input yet, stop reading until it does.
+        // The wakeup is cancelled before process_input can see read_suspended_ and resume it.
+        reactor()->cancel_wakeup(this, ACE_Event_Handler::READ_MASK);
+
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+            read_suspended_ = true;
+        }
+
+        if (session_ != NULL)
+            sRealmSocketMgr->ProcessInput(this);
 
-    ssize_t n = peer().recv(input_buffer_.wr_ptr(), space);
+        return 0;
+    }
 
     if (n < 0)
-        return errno == EWOULDBLOCK ? 0 : -1;
+        return error == EWOULDBLOCK ? 0 : -1;
     else if (n == 0) // EOF
         return -1;
 
-    input_buffer_.wr_ptr((size_t)n);
-
     if (session_ != NULL)
-    {
-        session_->OnRead();
-        input_buffer_.crunch();
-    }
+        sRealmSocketMgr->ProcessInput(this);
 
     // return 1 in case there is more data to read from OS
     return n == space ? 1 : 0;
 }
 
+bool RealmSocket::schedule_processing(void)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+
+    pending_input_ = true;
+    if (processing_)
+        return false;
+
+    processing_ = true;
+    scheduled_time_ = getMSTime();
+    return true;
+}
+
+void RealmSocket::process_input(void)
+{
+    for (;;)
+    {
+        bool resume, overflow;
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, lock_);
+            if (closing_)
+            {
+                processing_ = false;
+                return;
+            }
+
+            if (!pending_input_)
+            {
+                processing_ = false;
+                if (!read_suspended_)
+                    return;
+
+                // nothing consumed from a full buffer, the command does not fit in it
+                read_suspended_ = false;
+                overflow = input_buffer_.length() == input_buffer_.size();
+                resume = !overflow;
+            }
+            else
+            {
+                pending_input_ = false;
+                resume = overflow = false;
+            }
+        }
+
+        if (overflow)
+        {
+            sLog->outError(LOG_FILTER_AUTHSERVER, "Input buffer of %s:%u is full with an incomplete command, closing the connection", _remoteAddress.c_str(), uint32(_remotePort));
+            shutdown();
+            return;
+        }
+
+        if (resume)
+        {
+            reactor()->schedule_wakeup(this, ACE_Event_Handler::READ_MASK);
+            return;
+        }
+
+        session_->OnRead();
+    }
+}
+
 void RealmSocket::set_session(Session* session)
 {
     if (session_ != NULL)
@@ -24,6 +24,7 @@
 #include <ace/SOCK_Stream.h>
 #include <ace/Message_Block.h>
 #include <ace/Basic_Types.h>
+#include <ace/Thread_Mutex.h>
 #include "Common.h"
 
 class RealmSocket : public ACE_Svc_Handler<ACE_SOCK_STREAM, ACE_NULL_SYNCH>
@@ -53,6 +54,9 @@ public:
 
     bool send(const char *buf, size_t len);
 
+    // closes the socket from its reactor thread
+    void shutdown(void);
+
     const std::string& getRemoteAddress(void) const;
 
     uint16 getRemotePort(void) const;
@@ -64,14 +68,31 @@ public:
     virtual int handle_input(ACE_HANDLE = ACE_INVALID_HANDLE);
     virtual int handle_output(ACE_HANDLE = ACE_INVALID_HANDLE);
 
+    virtual int handle_exception(ACE_HANDLE = ACE_INVALID_HANDLE);
+
     virtual int handle_close(ACE_HANDLE = ACE_INVALID_HANDLE, ACE_Reactor_Mask = ACE_Event_Handler::ALL_EVENTS_MASK);
 
     void set_session(Session* session);
 
+    // false if the input is already scheduled, see RealmSocketMgr::ProcessInput
+    bool schedule_processing(void);
+    // runs the session on the input until none is left, one thread at a time
+    void process_input(void);
+    uint32 scheduled_time(void) const { return scheduled_time_; }
+
 private:
     ssize_t noblk_send(ACE_Message_Block &message_block);
+    bool is_closing(void) const;
+    void set_closing(void);
 
+    // input_buffer_, the output queue and closing_ are shared by the reactor and the processing thread
+    mutable ACE_Thread_Mutex lock_;
     ACE_Message_Block input_buffer_;
+    bool processing_;
+    bool pending_input_;
+    // the reactor stopped reading on a full input buffer, process_input resumes it
+    bool read_suspended_;
+    uint32 scheduled_time_;
     Session* session_;
     std::string _remoteAddress;
     uint16 _remotePort;
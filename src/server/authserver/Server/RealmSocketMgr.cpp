@@ -0,0 +1,275 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ace/Dev_Poll_Reactor.h>
+#include <ace/TP_Reactor.h>
+#include <ace/Task.h>
+#include <ace/Condition_Thread_Mutex.h>
+#include <ace/Guard_T.h>
+
+#include <deque>
+
+#include "RealmSocketMgr.h"
+#include "RealmSocket.h"
+#include "Database/DatabaseEnv.h"
+#include "Log.h"
+#include "Timer.h"
+
+// Network thread running the reactor of its share of the connections
+class RealmReactorRunnable : protected ACE_Task_Base
+{
+    public:
+        RealmReactorRunnable() : m_reactor(NULL)
+        {
+            ACE_Reactor_Impl* imp = NULL;
+
+#if defined (ACE_HAS_EVENT_POLL) || defined (ACE_HAS_DEV_POLL)
+            imp = new ACE_Dev_Poll_Reactor();
+            imp->max_notify_iterations(128);
+            imp->restart(1);
+#else
+            imp = new ACE_TP_Reactor();
+            imp->max_notify_iterations(128);
+#endif
+
+            m_reactor = new ACE_Reactor(imp, 1);
+        }
+
+        virtual ~RealmReactorRunnable()
+        {
+            Stop();
+            delete m_reactor;
+        }
+
+        int Start() { return activate(); }
+
+        void Stop()
+        {
+            m_reactor->end_reactor_event_loop();
+            wait();
+        }
+
+        ACE_Reactor* GetReactor() { return m_reactor; }
+
+    protected:
+        virtual int svc()
+        {
+            TC_LOG_DEBUG(LOG_FILTER_AUTHSERVER, "Network thread starting");
+
+            while (!m_reactor->reactor_event_loop_done())
+            {
+                // the reactor modifies the interval
+                ACE_Time_Value interval(0, 100000);
+                if (m_reactor->run_reactor_event_loop(interval) == -1)
+                    break;
+            }
+
+            TC_LOG_DEBUG(LOG_FILTER_AUTHSERVER, "Network thread exits");
+            return 0;
+        }
+
+    private:
+        ACE_Reactor* m_reactor;
+};
+
+// Threads processing the commands of the connections with pending input
+class AuthWorkerPool : protected ACE_Task_Base
+{
+    public:
+        AuthWorkerPool() : m_lock(), m_condition(m_lock), m_shutdown(false) { }
+
+        virtual ~AuthWorkerPool() { Stop(); }
+
+        int Start(size_t threads) { return activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(threads)); }
+
+        void Stop()
+        {
+            {
+                TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+                m_shutdown = true;
+                m_condition.broadcast();
+            }
+
+            wait();
+
+            // connections still queued are not processed anymore
+            for (std::deque<RealmSocket*>::const_iterator itr = m_queue.begin(); itr != m_queue.end(); ++itr)
+                (*itr)->remove_reference();
+
+            m_queue.clear();
+        }
+
+        // the socket is referenced until a worker processed it
+        void Enqueue(RealmSocket* socket)
+        {
+            socket->add_reference();
+
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            m_queue.push_back(socket);
+            m_condition.signal();
+        }
+
+    protected:
+        virtual int svc()
+        {
+            MySQL::Thread_Init();
+
+            for (;;)
+            {
+                RealmSocket* socket;
+                {
+                    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+                    while (m_queue.empty() && !m_shutdown)
+                        m_condition.wait();
+
+                    if (m_shutdown)
+                        break;
+
+                    socket = m_queue.front();
+                    m_queue.pop_front();
+                }
+
+                uint32 scheduled = socket->scheduled_time();
+                socket->process_input();
+                sRealmSocketMgr->OnInputProcessed(getMSTimeDiff(scheduled, getMSTime()));
+                socket->remove_reference();
+            }
+
+            MySQL::Thread_End();
+            return 0;
+        }
+
+    private:
+        ACE_Thread_Mutex m_lock;
+        ACE_Condition_Thread_Mutex m_condition;
+        std::deque<RealmSocket*> m_queue;
+        bool m_shutdown;
+};
+
+RealmSocketMgr::RealmSocketMgr() :
+    m_nextReactor(0), m_workers(NULL),
+    m_connections(0), m_processed(0), m_totalLatency(0), m_maxLatency(0)
+{
+}
+
+RealmSocketMgr::~RealmSocketMgr()
+{
+    Stop();
+}
+
+bool RealmSocketMgr::Start(size_t networkThreads, size_t workerThreads)
+{
+    for (size_t i = 0; i < std::max<size_t>(networkThreads, 1); ++i)
+    {
+        RealmReactorRunnable* runnable = new RealmReactorRunnable();
+        m_reactors.push_back(runnable);
+
+        if (runnable->Start() == -1)
+        {
+            sLog->outError(LOG_FILTER_AUTHSERVER, "Failed to start network thread %u", uint32(i));
+            return false;
+        }
+    }
+
+    // without workers, the network threads process the commands themselves
+    if (workerThreads)
+    {
+        m_workers = new AuthWorkerPool();
+        if (m_workers->Start(workerThreads) == -1)
+        {
+            sLog->outError(LOG_FILTER_AUTHSERVER, "Failed to start the auth worker threads");
+            return false;
+        }
+    }
+
+    sLog->outInfo(LOG_FILTER_AUTHSERVER, "Started %u network threads and %u worker threads", uint32(m_reactors.size()), uint32(workerThreads));
+    return true;
+}
+
+void RealmSocketMgr::Stop()
+{
+    // workers first, they may still send on the sockets of the network threads
+    delete m_workers;
+    m_workers = NULL;
+
+    for (std::vector<RealmReactorRunnable*>::const_iterator itr = m_reactors.begin(); itr != m_reactors.end(); ++itr)
+        delete *itr;
+
+    m_reactors.clear();
+}
+
+ACE_Reactor* RealmSocketMgr::GetNextReactor()
+{
+    if (m_reactors.empty())
+        return NULL;
+
+    m_nextReactor = (m_nextReactor + 1) % m_reactors.size();
+    return m_reactors[m_nextReactor]->GetReactor();
+}
+
+void RealmSocketMgr::ProcessInput(RealmSocket* socket)
+{
+    // already scheduled, the worker processing it will see the new data
+    if (!socket->schedule_processing())
+        return;
+
+    if (m_workers)
+    {
+        m_workers->Enqueue(socket);
+        return;
+    }
+
+    uint32 scheduled = socket->scheduled_time();
+    socket->process_input();
+    OnInputProcessed(getMSTimeDiff(scheduled, getMSTime()));
+}
+
+void RealmSocketMgr::OnConnectionOpened()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_statsLock);
+    ++m_connections;
+}
+
+void RealmSocketMgr::OnInputProcessed(uint32 latency)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_statsLock);
+    ++m_processed;
+    m_totalLatency += latency;
+    m_maxLatency = std::max(m_maxLatency, latency);
+}
+
+void RealmSocketMgr::LogStats(uint32 diff)
+{
+    uint32 connections, processed, maxLatency;
+    uint64 totalLatency;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_statsLock);
+        connections = m_connections;
+        processed = m_processed;
+        totalLatency = m_totalLatency;
+        maxLatency = m_maxLatency;
+
+        m_connections = 0;
+        m_processed = 0;
+        m_totalLatency = 0;
+        m_maxLatency = 0;
+    }
+
+    sLog->outInfo(LOG_FILTER_AUTHSERVER, "Network: %u connections (%.2f/s), %u inputs processed, latency avg %u ms max %u ms",
+        connections, diff ? float(connections) * IN_MILLISECONDS / diff : 0.0f, processed,
+        processed ? uint32(totalLatency / processed) : 0, maxLatency);
+}
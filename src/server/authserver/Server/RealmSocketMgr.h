@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __REALMSOCKETMGR_H__
+#define __REALMSOCKETMGR_H__
+
+#include <ace/Singleton.h>
+#include <ace/Thread_Mutex.h>
+
+#include "Common.h"
+
+class ACE_Reactor;
+class RealmSocket;
+class RealmReactorRunnable;
+class AuthWorkerPool;
+
+/*
+ * Network and worker threads of the authserver.
+ *
+ * The acceptor stays on the main reactor and hands the new connections
+ * round-robin to the reactors of the network threads, which only move bytes
+ * in and out of the sockets. The commands of a connection, with their login
+ * database queries and SRP6 computations, are processed by the worker threads,
+ * one worker at a time per connection, so a slow login never holds the others.
+ */
+class RealmSocketMgr
+{
+    friend class ACE_Singleton<RealmSocketMgr, ACE_Thread_Mutex>;
+
+    public:
+        bool Start(size_t networkThreads, size_t workerThreads);
+        void Stop();
+
+        // reactor of the network thread taking the next connection
+        ACE_Reactor* GetNextReactor();
+
+        // called by the network thread when data arrived on the socket
+        void ProcessInput(RealmSocket* socket);
+
+        void OnConnectionOpened();
+        void OnInputProcessed(uint32 latency);
+
+        // logs the connection rate and the command latency since the last call
+        void LogStats(uint32 diff);
+
+    private:
+        RealmSocketMgr();
+        ~RealmSocketMgr();
+
+        std::vector<RealmReactorRunnable*> m_reactors;
+        size_t m_nextReactor;
+        AuthWorkerPool* m_workers;
+
+        ACE_Thread_Mutex m_statsLock;
+        uint32 m_connections;
+        uint32 m_processed;
+        uint64 m_totalLatency;
+        uint32 m_maxLatency;
+};
+
+#define sRealmSocketMgr ACE_Singleton<RealmSocketMgr, ACE_Thread_Mutex>::instance()
+
+#endif
@@ -23,6 +23,7 @@
 #include "Dynamic/UnorderedMap.h"
 #include "Define.h"
 #include <ace/Thread_Mutex.h>
+#include <vector>
 
 //===========================================================
 
@@ -91,6 +92,10 @@ namespace VMAP
             void unloadMap(unsigned int mapId, int x, int y);
             void unloadMap(unsigned int mapId);
 
+            // loads the models of a tile ahead of loadMap(), thread safe, see StaticMapTree::PreloadMapTile
+            bool preloadMapTile(const char* basePath, unsigned int mapId, int x, int y, std::vector<std::string>& models);
+            void releasePreloadedModels(std::vector<std::string> const& models);
+
             bool isInLineOfSight(unsigned int mapId, float x1, float y1, float z1, float x2, float y2, float z2) ;
             /**
             fill the hit pos and return true, if an object was hit
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _NAVTILEDEFINES_H
+#define _NAVTILEDEFINES_H
+
+#include "Define.h"
+
+/*
+ * Navigation tile file format, written by mmaps_generator and read by NavTile.
+ *
+ * One file per map grid: mmaps/%03u%02u%02u.mmtile (map id, grid x, grid y, same
+ * numbering as the .map files). A tile holds NAV_TILE_CELLS x NAV_TILE_CELLS cells
+ * centered on the V8 points of the height map, indexed like GridMap (first index
+ * from world x, second from world y):
+ *
+ *   NavTileHeader
+ *   float  height[NAV_TILE_CELLS * NAV_TILE_CELLS]   ground height at the cell center
+ *   uint8  flags[NAV_TILE_CELLS * NAV_TILE_CELLS]    NavCellFlags
+ *   uint8  links[NAV_TILE_CELLS * NAV_TILE_CELLS]    one bit per NavDirection, set when
+ *                                                    the neighbour can be walked to
+ *
+ * Links leaving the tile are only set when the cell itself is walkable, the server
+ * validates them against the neighbour tile once both are loaded.
+ */
+
+#define NAV_TILE_MAGIC          0x4C54564E                  // 'NVTL'
+#define NAV_TILE_VERSION        1
+#define NAV_TILE_CELLS          128
+#define NAV_TILE_SIZE           533.33333f
+#define NAV_CELL_SIZE           (NAV_TILE_SIZE / NAV_TILE_CELLS)
+
+// max height difference per yard between two linked cells (~50 degrees)
+#define NAV_MAX_CLIMB_SLOPE     1.2f
+// water deeper than this has to be swum
+#define NAV_SWIM_DEPTH          1.5f
+
+struct NavTileHeader
+{
+    uint32 magic;
+    uint32 version;
+    uint32 mapId;
+    uint32 tileX;
+    uint32 tileY;
+    uint32 cells;
+};
+
+enum NavCellFlags
+{
+    NAV_CELL_WALKABLE   = 0x01,                             // ground, no hole
+    NAV_CELL_WATER      = 0x02,                             // deep water, swimmers only
+    NAV_CELL_HAZARD     = 0x04                              // magma or slime
+};
+
+enum NavDirection
+{
+    NAV_DIR_N           = 0,                                // first cell index + 1
+    NAV_DIR_NE,
+    NAV_DIR_E,                                              // second cell index + 1
+    NAV_DIR_SE,
+    NAV_DIR_S,
+    NAV_DIR_SW,
+    NAV_DIR_W,
+    NAV_DIR_NW,
+    MAX_NAV_DIRECTIONS
+};
+
+inline int NavDirectionX(uint8 dir)
+{
+    static int const dx[MAX_NAV_DIRECTIONS] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+    return dx[dir];
+}
+
+inline int NavDirectionY(uint8 dir)
+{
+    static int const dy[MAX_NAV_DIRECTIONS] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+    return dy[dir];
+}
+
+inline bool IsDiagonalNavDirection(uint8 dir)
+{
+    return dir & 1;
+}
+
+#endif
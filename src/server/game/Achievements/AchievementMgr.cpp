@@ -436,6 +436,7 @@ void AchievementMgr<T>::RemoveCriteriaProgress(const AchievementCriteriaEntry* e
     SendPacket(&data);
 
     progressMap->erase(criteriaProgress);
+    SetKnownCompletedCriteria(entry, NULL, false);
 }
 
 template<>
@@ -465,6 +466,7 @@ void AchievementMgr<Guild>::RemoveCriteriaProgress(const AchievementCriteriaEntr
     SendPacket(&data);
 
     GetCriteriaProgressMap()->erase(criteriaProgress);
+    SetKnownCompletedCriteria(entry, NULL, false);
 }
 
 template<class T>
@@ -1100,6 +1102,10 @@ void AchievementMgr<Player>::Reset()
     m_completedAchievements.clear();
     _achievementPoints = 0;
     criteriaProgress->clear();
+    {
+        CriteriaProgressMap::WriteGuard guard(m_criteriaProgress.GetLock());
+        m_completedCriteria.clear();
+    }
     DeleteFromDB(GetOwner()->GetGUIDLow());
 
     // Re-fill data
@@ -1397,10 +1403,13 @@ void AchievementMgr<T>::UpdateAchievementCriteria(AchievementCriteriaTypes type,
     if (IsGuild<T>() && !sWorld->getBoolConfig(CONFIG_GUILD_LEVELING_ENABLED))
         return;
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type, IsGuild<T>());
+    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByTypeAndAsset(type, miscValue1, IsGuild<T>());
     for (AchievementCriteriaEntryList::const_iterator i = achievementCriteriaList.begin(); i != achievementCriteriaList.end(); ++i)
     {
         AchievementCriteriaEntry const* achievementCriteria = (*i);
+        if (IsKnownCompletedCriteria(achievementCriteria->ID))
+            continue;
+
         AchievementEntry const* achievement = sAchievementMgr->GetAchievement(achievementCriteria->achievement);
         if (!achievement)
             continue;
@@ -2114,6 +2123,7 @@ void AchievementMgr<T>::SetCriteriaProgress(AchievementCriteriaEntry const* entr
    AchievementEntry const* achievement = sAchievementMgr->GetAchievement(entry->achievement);
     uint32 timeElapsed = 0;
     bool criteriaComplete = IsCompletedCriteria(entry, achievement);
+    SetKnownCompletedCriteria(entry, achievement, criteriaComplete);
 
     if (entry->timeLimit)
     {
@@ -2745,6 +2755,35 @@ uint64 AchievementMgr<T>::GetFirstAchievedCharacterOnAccount(uint32 achievementI
     return (*itr).second.first_guid;
 }
 
+template<class T>
+bool AchievementMgr<T>::IsKnownCompletedCriteria(uint32 criteriaId) const
+{
+    CriteriaProgressMap::ReadGuard guard(m_criteriaProgress.GetLock());
+    return criteriaId < m_completedCriteria.size() && m_completedCriteria[criteriaId];
+}
+
+template<class T>
+void AchievementMgr<T>::SetKnownCompletedCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, bool completed)
+{
+    if (!completed)
+    {
+        CriteriaProgressMap::WriteGuard guard(m_criteriaProgress.GetLock());
+        if (criteria->ID < m_completedCriteria.size())
+            m_completedCriteria[criteria->ID] = false;
+        return;
+    }
+
+    // realm firsts stop being completable when someone else gets them, counters never complete
+    if (achievement->flags & (ACHIEVEMENT_FLAG_COUNTER | ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL))
+        return;
+
+    CriteriaProgressMap::WriteGuard guard(m_criteriaProgress.GetLock());
+    if (criteria->ID >= m_completedCriteria.size())
+        m_completedCriteria.resize(sAchievementCriteriaStore.GetNumRows(), false);
+
+    m_completedCriteria[criteria->ID] = true;
+}
+
 template<class T>
 bool AchievementMgr<T>::CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint64 miscValue1, uint64 miscValue2, uint64 miscValue3, Unit const* unit, Player* referencePlayer)
 {
@@ -2789,7 +2828,10 @@ bool AchievementMgr<T>::CanUpdateCriteria(AchievementCriteriaEntry const* criter
             return false;
 
     if (IsCompletedCriteria(criteria, achievement))
+    {
+        SetKnownCompletedCriteria(criteria, achievement, true);
         return false;
+    }
 
     if (!RequirementsSatisfied(criteria, miscValue1, miscValue2, miscValue3, unit, referencePlayer))
         return false;
@@ -3997,11 +4039,20 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
 
         m_AchievementCriteriaListByAchievement[criteria->achievement].push_back(criteria);
 
-        if (achievement && achievement->flags & ACHIEVEMENT_FLAG_GUILD)
+        bool guild = achievement && achievement->flags & ACHIEVEMENT_FLAG_GUILD;
+        if (guild)
             ++guildCriterias, m_GuildAchievementCriteriasByType[criteria->type].push_back(criteria);
         else
             ++criterias, m_AchievementCriteriasByType[criteria->type].push_back(criteria);
 
+        if (criteria->type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL && GetCriteriaAssetMatch(AchievementCriteriaTypes(criteria->type)) != ACHIEVEMENT_CRITERIA_ASSET_ANY)
+        {
+            if (guild)
+                m_GuildAchievementCriteriasByAsset[criteria->type][criteria->raw.field3].push_back(criteria);
+            else
+                m_AchievementCriteriasByAsset[criteria->type][criteria->raw.field3].push_back(criteria);
+        }
+
         if (criteria->timeLimit)
             m_AchievementCriteriasByTimedType[criteria->timedCriteriaStartType].push_back(criteria);
     }
@@ -4009,6 +4060,75 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Loaded %u achievement criteria and %u guild achievement crieteria in %u ms", criterias, guildCriterias, GetMSTimeDiffToNow(oldMSTime));
 }
 
+AchievementCriteriaEntryList const& AchievementGlobalMgr::GetAchievementCriteriaByTypeAndAsset(AchievementCriteriaTypes type, uint64 asset, bool guild) const
+{
+    switch (GetCriteriaAssetMatch(type))
+    {
+        case ACHIEVEMENT_CRITERIA_ASSET_ANY:
+            return GetAchievementCriteriaByType(type, guild);
+        case ACHIEVEMENT_CRITERIA_ASSET_OPTIONAL:
+            if (!asset)
+                return GetAchievementCriteriaByType(type, guild);
+            break;
+        case ACHIEVEMENT_CRITERIA_ASSET_REQUIRED:
+            if (!asset)
+                return m_emptyCriteriaList;
+            break;
+        case ACHIEVEMENT_CRITERIA_ASSET_EXACT:
+            break;
+    }
+
+    // assets are 32 bit, nothing can match
+    if (asset > std::numeric_limits<uint32>::max())
+        return m_emptyCriteriaList;
+
+    AchievementCriteriaListByAsset const& byAsset = guild ? m_GuildAchievementCriteriasByAsset[type] : m_AchievementCriteriasByAsset[type];
+    AchievementCriteriaListByAsset::const_iterator itr = byAsset.find(uint32(asset));
+    return itr != byAsset.end() ? itr->second : m_emptyCriteriaList;
+}
+
+AchievementCriteriaAssetMatch AchievementGlobalMgr::GetCriteriaAssetMatch(AchievementCriteriaTypes type)
+{
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_CURRENCY:
+            return ACHIEVEMENT_CRITERIA_ASSET_REQUIRED;
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+            return ACHIEVEMENT_CRITERIA_ASSET_OPTIONAL;
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_GUILD_CHALLENGE_TYPE:
+            return ACHIEVEMENT_CRITERIA_ASSET_EXACT;
+        default:
+            break;
+    }
+
+    return ACHIEVEMENT_CRITERIA_ASSET_ANY;
+}
+
 void AchievementGlobalMgr::LoadAchievementReferenceList()
 {
     uint32 oldMSTime = getMSTime();
@@ -20,6 +20,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Common.h"
 #include <ace/Singleton.h>
@@ -34,6 +35,18 @@ typedef std::list<AchievementEntry const*>         AchievementEntryList;
 typedef ACE_Based::LockedMap<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
 typedef ACE_Based::LockedMap<uint32, AchievementEntryList>         AchievementListByReferencedId;
 
+typedef UNORDERED_MAP<uint32, AchievementCriteriaEntryList>        AchievementCriteriaListByAsset;
+
+// How an update's miscValue1 selects criteria by their main requirement (asset, first criteria field),
+// must agree with AchievementMgr::RequirementsSatisfied
+enum AchievementCriteriaAssetMatch
+{
+    ACHIEVEMENT_CRITERIA_ASSET_ANY,                         // not keyed by asset
+    ACHIEVEMENT_CRITERIA_ASSET_REQUIRED,                    // miscValue1 is the asset, 0 matches nothing
+    ACHIEVEMENT_CRITERIA_ASSET_OPTIONAL,                    // miscValue1 is the asset, 0 matches all (login, skill and reputation rechecks)
+    ACHIEVEMENT_CRITERIA_ASSET_EXACT                        // miscValue1 is the asset, 0 included
+};
+
 struct CriteriaProgress
 {
     uint32 counter;
@@ -262,6 +275,8 @@ class AchievementMgr
         bool CanCompleteCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
         bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
         bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint64 miscValue1, uint64 miscValue2, uint64 miscValue3, Unit const* unit, Player* referencePlayer);
+        bool IsKnownCompletedCriteria(uint32 criteriaId) const;
+        void SetKnownCompletedCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, bool completed);
         void SendPacket(WorldPacket* data) const;
 
         bool ConditionsSatisfied(AchievementCriteriaEntry const *criteria, Player* referencePlayer) const;
@@ -273,6 +288,8 @@ class AchievementMgr
         CompletedAchievementMap m_completedAchievements;
         typedef std::map<uint32, uint32> TimedAchievementMap;
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
+        std::vector<bool> m_completedCriteria;        // by criteria id, completed and not touched since, skipped without looking at the progress
+                                                      // guarded by the m_criteriaProgress lock, guilds are updated from several map threads
         uint32 _achievementPoints;
 };
 
@@ -291,6 +308,10 @@ class AchievementGlobalMgr
             return guild ? m_GuildAchievementCriteriasByType[type] : m_AchievementCriteriasByType[type];
         }
 
+        // criteria of a type an update with this miscValue1 can affect
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByTypeAndAsset(AchievementCriteriaTypes type, uint64 asset, bool guild = false) const;
+        static AchievementCriteriaAssetMatch GetCriteriaAssetMatch(AchievementCriteriaTypes type);
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -370,6 +391,11 @@ class AchievementGlobalMgr
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
         AchievementCriteriaEntryList m_GuildAchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
 
+        // same, keyed by asset for the types GetCriteriaAssetMatch knows
+        AchievementCriteriaListByAsset m_AchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaListByAsset m_GuildAchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        AchievementCriteriaEntryList m_emptyCriteriaList;
+
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
 
         // store achievement criterias by achievement to speed up lookup
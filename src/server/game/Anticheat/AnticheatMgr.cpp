@@ -2,103 +2,132 @@
 #include "AnticheatScripts.h"
 #include "MapManager.h"
 
-#define CLIMB_ANGLE 1.9f
+#include <ace/Task.h>
+#include <ace/Condition_Thread_Mutex.h>
+#include <ace/Guard_T.h>
 
-AnticheatMgr::AnticheatMgr()
-{
-}
+#define CLIMB_ANGLE 1.9f
 
-AnticheatMgr::~AnticheatMgr()
-{
-    m_Players.clear();
-}
+// how long the analyzer lets the samples pile up between two batches
+#define ANTICHEAT_ANALYZE_INTERVAL 100
 
-void AnticheatMgr::JumpHackDetection(Player* player, MovementInfo movementInfo,uint32 opcode)
+// Thread draining the sample rings every ANTICHEAT_ANALYZE_INTERVAL ms
+class AnticheatAnalyzer : protected ACE_Task_Base
 {
-    if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & JUMP_HACK_DETECTION) == 0)
-        return;
+    public:
+        AnticheatAnalyzer() : m_lock(), m_condition(m_lock), m_shutdown(false) { }
 
-    uint32 key = player->GetGUIDLow();
+        virtual ~AnticheatAnalyzer() { Stop(); }
 
-    if (m_Players[key].GetLastOpcode() == CMSG_MOVE_JUMP && opcode == CMSG_MOVE_JUMP)
-    {
-        BuildReport(player,JUMP_HACK_REPORT);
-        //sLog->outError("AnticheatMgr:: Jump-Hack detected player GUID (low) %u",player->GetGUIDLow());
-    }
-}
+        int Start() { return activate(); }
 
-void AnticheatMgr::WalkOnWaterHackDetection(Player* player, MovementInfo movementInfo)
-{
-    if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & WALK_WATER_HACK_DETECTION) == 0)
-        return;
+        void Stop()
+        {
+            {
+                TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+                m_shutdown = true;
+                m_condition.broadcast();
+            }
 
-    uint32 key = player->GetGUIDLow();
-    if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_WATERWALKING))
-        return;
+            wait();
+        }
 
-    // if we are a ghost we can walk on water
-    if (!player->isAlive())
-        return;
+    protected:
+        virtual int svc()
+        {
+            for (;;)
+            {
+                {
+                    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+                    if (!m_shutdown)
+                    {
+                        ACE_Time_Value until = ACE_OS::gettimeofday() + ACE_Time_Value(0, ANTICHEAT_ANALYZE_INTERVAL * 1000);
+                        m_condition.wait(&until);
+                    }
+
+                    if (m_shutdown)
+                        break;
+                }
+
+                sAnticheatMgr->AnalyzeSamples();
+            }
 
-    if (player->HasAuraType(SPELL_AURA_FEATHER_FALL) ||
-        player->HasAuraType(SPELL_AURA_SAFE_FALL) ||
-        player->HasAuraType(SPELL_AURA_WATER_WALK))
-        return;
+            return 0;
+        }
 
-    //sLog->outError("AnticheatMgr:: Walk on Water - Hack detected player GUID (low) %u",player->GetGUIDLow());
-    BuildReport(player,WALK_WATER_HACK_REPORT);
+    private:
+        ACE_Thread_Mutex m_lock;
+        ACE_Condition_Thread_Mutex m_condition;
+        bool m_shutdown;
+};
 
+AnticheatMgr::AnticheatMgr() : m_analyzer(NULL)
+{
 }
 
-void AnticheatMgr::FlyHackDetection(Player* player, MovementInfo movementInfo)
+AnticheatMgr::~AnticheatMgr()
 {
-    if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & FLY_HACK_DETECTION) == 0)
-        return;
+    StopAnalyzer();
 
-    uint32 key = player->GetGUIDLow();
-    if (!m_Players[key].GetLastMovementInfo().HasMovementFlag(MOVEMENTFLAG_FLYING))
-        return;
+    for (AnticheatSampleRingMap::const_iterator itr = m_Rings.begin(); itr != m_Rings.end(); ++itr)
+        delete itr->second;
 
-    if (player->HasAuraType(SPELL_AURA_FLY) ||
-        player->HasAuraType(SPELL_AURA_MOD_INCREASE_MOUNTED_FLIGHT_SPEED) ||
-        player->HasAuraType(SPELL_AURA_MOD_INCREASE_FLIGHT_SPEED))
+    m_Rings.clear();
+    m_Players.clear();
+}
+
+void AnticheatMgr::StartAnalyzer()
+{
+    if (m_analyzer)
         return;
 
-    //sLog->outError("AnticheatMgr:: Fly-Hack detected player GUID (low) %u",player->GetGUIDLow());
-    BuildReport(player,FLY_HACK_REPORT);
+    m_analyzer = new AnticheatAnalyzer();
+    if (m_analyzer->Start() == -1)
+    {
+        sLog->outError(LOG_FILTER_GENERAL, "AnticheatMgr: failed to start the analyzer thread, hack detection disabled");
+        delete m_analyzer;
+        m_analyzer = NULL;
+    }
 }
 
-void AnticheatMgr::TeleportPlaneHackDetection(Player* player, MovementInfo movementInfo)
+void AnticheatMgr::StopAnalyzer()
 {
-    if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & TELEPORT_PLANE_HACK_DETECTION) == 0)
-        return;
+    delete m_analyzer;
+    m_analyzer = NULL;
+}
 
-    uint32 key = player->GetGUIDLow();
+void AnticheatMgr::JumpHackDetection(AnticheatSample const* window, uint32 count, uint8* hits)
+{
+    for (uint32 i = 1; i < count; ++i)
+        hits[i] |= uint8(window[i - 1].opcode == CMSG_MOVE_JUMP && window[i].opcode == CMSG_MOVE_JUMP) << JUMP_HACK_REPORT;
+}
 
-    if (m_Players[key].GetLastMovementInfo().pos.GetPositionZ() != 0 ||
-        movementInfo.pos.GetPositionZ() != 0)
-        return;
+void AnticheatMgr::WalkOnWaterHackDetection(AnticheatSample const* window, uint32 count, uint8* hits)
+{
+    // if we are a ghost we can walk on water, the auras are checked at capture
+    for (uint32 i = 1; i < count; ++i)
+        hits[i] |= uint8((window[i - 1].moveFlags & MOVEMENTFLAG_WATERWALKING) != 0 &&
+            (window[i].flags & ANTICHEAT_SAMPLE_CAN_WALK_WATER) == 0) << WALK_WATER_HACK_REPORT;
+}
 
-    if (movementInfo.HasMovementFlag(MOVEMENTFLAG_FALLING))
-        return;
+void AnticheatMgr::FlyHackDetection(AnticheatSample const* window, uint32 count, uint8* hits)
+{
+    for (uint32 i = 1; i < count; ++i)
+        hits[i] |= uint8((window[i - 1].moveFlags & MOVEMENTFLAG_FLYING) != 0 &&
+            (window[i].flags & ANTICHEAT_SAMPLE_CAN_FLY) == 0) << FLY_HACK_REPORT;
+}
 
+void AnticheatMgr::TeleportPlaneHackDetection(AnticheatSample const* window, uint32 count, uint8* hits)
+{
     //DEAD_FALLING was deprecated
-    //if (player->getDeathState() == DEAD_FALLING)
-    //    return;
-    float x, y, z;
-    player->GetPosition(x, y, z);
-    float ground_Z = player->GetMap()->GetHeight(x, y, z);
-    float z_diff = fabs(ground_Z - z);
-
-    // we are not really walking there
-    if (z_diff > 1.0f)
-    {
-        //sLog->outError("AnticheatMgr:: Teleport To Plane - Hack detected player GUID (low) %u",player->GetGUIDLow());
-        BuildReport(player,TELEPORT_PLANE_HACK_REPORT);
-    }
+    // we are not really walking there when the ground is more than 1 yard away
+    for (uint32 i = 1; i < count; ++i)
+        hits[i] |= uint8(window[i - 1].z == 0 && window[i].z == 0 &&
+            (window[i].moveFlags & MOVEMENTFLAG_FALLING) == 0 &&
+            fabs(window[i].groundZ - window[i].playerZ) > 1.0f) << TELEPORT_PLANE_HACK_REPORT;
 }
 
-void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode)
+void AnticheatMgr::StartHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode)
 {
     if (!sWorld->getBoolConfig(CONFIG_ANTICHEAT_ENABLE))
         return;
@@ -106,103 +135,183 @@ void AnticheatMgr::StartHackDetection(Player* player, MovementInfo movementInfo,
     if (player->isGameMaster())
         return;
 
-    uint32 key = player->GetGUIDLow();
+    AnticheatSampleRing* samples = player->GetAnticheatSamples();
+    if (!samples)
+        return;
 
+    AnticheatSample sample;
+    sample.opcode = opcode;
+    sample.moveFlags = movementInfo.flags;
+    sample.clientTime = movementInfo.time;
+    sample.serverTime = getMSTime();
+    sample.mapId = player->GetMapId();
+    sample.x = movementInfo.pos.GetPositionX();
+    sample.y = movementInfo.pos.GetPositionY();
+    sample.z = movementInfo.pos.GetPositionZ();
+    player->GetPosition(sample.playerX, sample.playerY, sample.playerZ);
+    sample.allowedSpeed = 0.0f;
+    sample.groundZ = sample.playerZ;
+    sample.flags = 0;
+
+    // still the previous sample of the next packet
     if (player->isInFlight() || player->GetTransport() || player->GetVehicle())
     {
-        m_Players[key].SetLastMovementInfo(movementInfo);
-        m_Players[key].SetLastOpcode(opcode);
+        sample.flags = ANTICHEAT_SAMPLE_UNCHECKED;
+        samples->Push(sample);
         return;
     }
 
-    SpeedHackDetection(player,movementInfo);
-    FlyHackDetection(player,movementInfo);
-    WalkOnWaterHackDetection(player,movementInfo);
-    JumpHackDetection(player,movementInfo,opcode);
-    TeleportPlaneHackDetection(player, movementInfo);
-    ClimbHackDetection(player,movementInfo,opcode);
-
-    m_Players[key].SetLastMovementInfo(movementInfo);
-    m_Players[key].SetLastOpcode(opcode);
-}
+    // we need to know HOW is the player moving
+    // TO-DO: Should we check the incoming movement flags?
+    UnitMoveType moveType;
+    if (player->HasUnitMovementFlag(MOVEMENTFLAG_SWIMMING))
+        moveType = MOVE_SWIM;
+    else if (player->IsFlying())
+        moveType = MOVE_FLIGHT;
+    else if (player->HasUnitMovementFlag(MOVEMENTFLAG_WALKING))
+        moveType = MOVE_WALK;
+    else
+        moveType = MOVE_RUN;
 
-// basic detection
-void AnticheatMgr::ClimbHackDetection(Player *player, MovementInfo movementInfo, uint32 opcode)
-{
-    if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & CLIMB_HACK_DETECTION) == 0)
-        return;
+    // how many yards the player can do in one sec.
+    sample.allowedSpeed = player->GetSpeed(moveType) + movementInfo.j_xyspeed;
 
-    uint32 key = player->GetGUIDLow();
+    if (player->HasAuraType(SPELL_AURA_FLY) ||
+        player->HasAuraType(SPELL_AURA_MOD_INCREASE_MOUNTED_FLIGHT_SPEED) ||
+        player->HasAuraType(SPELL_AURA_MOD_INCREASE_FLIGHT_SPEED))
+        sample.flags |= ANTICHEAT_SAMPLE_CAN_FLY;
 
-    if (opcode != CMSG_MOVE_HEARTBEAT ||
-        m_Players[key].GetLastOpcode() != CMSG_MOVE_HEARTBEAT)
-        return;
+    if (!player->isAlive() ||
+        player->HasAuraType(SPELL_AURA_FEATHER_FALL) ||
+        player->HasAuraType(SPELL_AURA_SAFE_FALL) ||
+        player->HasAuraType(SPELL_AURA_WATER_WALK))
+        sample.flags |= ANTICHEAT_SAMPLE_CAN_WALK_WATER;
 
     // in this case we don't care if they are "legal" flags, they are handled in another parts of the Anticheat Manager.
     if (player->IsInWater() ||
         player->IsFlying() ||
         player->IsFalling())
-        return;
+        sample.flags |= ANTICHEAT_SAMPLE_CLIMB_EXEMPT;
 
-    Position playerPos;
-    player->GetPosition(&playerPos);
+    // the map is only readable from its own thread
+    if (sample.z == 0)
+        sample.groundZ = player->GetMap()->GetHeight(sample.playerX, sample.playerY, sample.playerZ);
 
-    float deltaZ = fabs(playerPos.GetPositionZ() - movementInfo.pos.GetPositionZ());
-    float deltaXY = movementInfo.pos.GetExactDist2d(&playerPos);
+    samples->Push(sample);
+}
 
-    float angle = player->NormalizeOrientation(tan(deltaZ/deltaXY));
+void AnticheatMgr::AnalyzeSamples()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_ringsLock);
 
-    if (angle > CLIMB_ANGLE)
+    for (AnticheatSampleRingMap::const_iterator itr = m_Rings.begin(); itr != m_Rings.end(); ++itr)
     {
-        //sLog->outError("AnticheatMgr:: Climb-Hack detected player GUID (low) %u", player->GetGUIDLow());
-        BuildReport(player,CLIMB_HACK_REPORT);
+        AnticheatSampleRing* ring = itr->second;
+
+        m_window.clear();
+        if (AnticheatSample const* last = ring->GetLast())
+            m_window.push_back(*last);
+
+        if (!ring->Drain(m_window))
+            continue;
+
+        AnalyzeWindow(ring->GetLowGuid(), m_window);
+        ring->SetLast(m_window.back());
     }
 }
 
-void AnticheatMgr::SpeedHackDetection(Player* player,MovementInfo movementInfo)
+void AnticheatMgr::AnalyzeWindow(uint32 lowGuid, AnticheatSampleWindow const& window)
 {
-    if ((sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED) & SPEED_HACK_DETECTION) == 0)
+    uint32 count = window.size();
+    if (count < 2)
         return;
 
-    uint32 key = player->GetGUIDLow();
-
-    // We also must check the map because the movementFlag can be modified by the client.
-    // If we just check the flag, they could always add that flag and always skip the speed hacking detection.
-    // 369 == DEEPRUN TRAM
-    if (player->GetMapId() == 369)
-        return;
+    m_hits.assign(count, 0);
+    AnticheatSample const* samples = &window[0];
+    uint8* hits = &m_hits[0];
+
+    uint32 detections = sWorld->getIntConfig(CONFIG_ANTICHEAT_DETECTIONS_ENABLED);
+    if (detections & SPEED_HACK_DETECTION)
+        SpeedHackDetection(samples, count, hits);
+    if (detections & FLY_HACK_DETECTION)
+        FlyHackDetection(samples, count, hits);
+    if (detections & WALK_WATER_HACK_DETECTION)
+        WalkOnWaterHackDetection(samples, count, hits);
+    if (detections & JUMP_HACK_DETECTION)
+        JumpHackDetection(samples, count, hits);
+    if (detections & TELEPORT_PLANE_HACK_DETECTION)
+        TeleportPlaneHackDetection(samples, count, hits);
+    if (detections & CLIMB_HACK_DETECTION)
+        ClimbHackDetection(samples, count, hits);
+
+    for (uint32 i = 1; i < count; ++i)
+    {
+        if (!hits[i] || (samples[i].flags & ANTICHEAT_SAMPLE_UNCHECKED))
+            continue;
 
-    uint32 distance2D = (uint32)movementInfo.pos.GetExactDist2d(&m_Players[key].GetLastMovementInfo().pos);
-    uint8 moveType = 0;
+        for (uint8 type = 0; type < MAX_REPORT_TYPES; ++type)
+        {
+            if (!(hits[i] & (1 << type)))
+                continue;
+
+            AnticheatVerdict verdict;
+            verdict.lowGuid = lowGuid;
+            verdict.reportType = type;
+            verdict.time = samples[i].serverTime;
+            m_verdicts.add(verdict);
+        }
+    }
+}
 
-    // we need to know HOW is the player moving
-    // TO-DO: Should we check the incoming movement flags?
-    if (player->HasUnitMovementFlag(MOVEMENTFLAG_SWIMMING))
-        moveType = MOVE_SWIM;
-    else if (player->IsFlying())
-        moveType = MOVE_FLIGHT;
-    else if (player->HasUnitMovementFlag(MOVEMENTFLAG_WALKING))
-        moveType = MOVE_WALK;
-    else
-        moveType = MOVE_RUN;
+void AnticheatMgr::Update()
+{
+    AnticheatVerdict verdict;
+    while (m_verdicts.next(verdict))
+        BuildReport(verdict.lowGuid, verdict.reportType, verdict.time);
+}
 
-    // how many yards the player can do in one sec.
-    uint32 speedRate = (uint32)(player->GetSpeed(UnitMoveType(moveType)) + movementInfo.j_xyspeed);
+// basic detection
+void AnticheatMgr::ClimbHackDetection(AnticheatSample const* window, uint32 count, uint8* hits)
+{
+    for (uint32 i = 1; i < count; ++i)
+    {
+        AnticheatSample const& sample = window[i];
 
-    // how long the player took to move to here.
-    uint32 timeDiff = getMSTimeDiff(m_Players[key].GetLastMovementInfo().time,movementInfo.time);
+        float deltaZ = fabs(sample.playerZ - sample.z);
+        float dx = sample.x - sample.playerX;
+        float dy = sample.y - sample.playerY;
+        float deltaXY = sqrt(dx * dx + dy * dy);
 
-    if (!timeDiff)
-        timeDiff = 1;
+        float angle = Position::NormalizeOrientation(tan(deltaZ / deltaXY));
 
-    // this is the distance doable by the player in 1 sec, using the time done to move to this point.
-    uint32 clientSpeedRate = distance2D * 1000 / timeDiff;
+        hits[i] |= uint8(sample.opcode == CMSG_MOVE_HEARTBEAT && window[i - 1].opcode == CMSG_MOVE_HEARTBEAT &&
+            (sample.flags & ANTICHEAT_SAMPLE_CLIMB_EXEMPT) == 0 && angle > CLIMB_ANGLE) << CLIMB_HACK_REPORT;
+    }
+}
 
-    // we did the (uint32) cast to accept a margin of tolerance
-    if (clientSpeedRate > speedRate)
+void AnticheatMgr::SpeedHackDetection(AnticheatSample const* window, uint32 count, uint8* hits)
+{
+    for (uint32 i = 1; i < count; ++i)
     {
-        BuildReport(player,SPEED_HACK_REPORT);
-        //sLog->outError("AnticheatMgr:: Speed-Hack detected player GUID (low) %u",player->GetGUIDLow());
+        AnticheatSample const& prev = window[i - 1];
+        AnticheatSample const& sample = window[i];
+
+        float dx = sample.x - prev.x;
+        float dy = sample.y - prev.y;
+        uint32 distance2D = uint32(sqrt(dx * dx + dy * dy));
+
+        // how long the player took to move to here.
+        uint32 timeDiff = std::max<uint32>(getMSTimeDiff(prev.clientTime, sample.clientTime), 1);
+
+        // this is the distance doable by the player in 1 sec, using the time done to move to this point.
+        uint32 clientSpeedRate = distance2D * 1000 / timeDiff;
+
+        // We also must check the map because the movementFlag can be modified by the client.
+        // If we just check the flag, they could always add that flag and always skip the speed hacking detection.
+        // 369 == DEEPRUN TRAM
+        // we did the (uint32) cast to accept a margin of tolerance
+        hits[i] |= uint8(sample.mapId != 369 && sample.mapId == prev.mapId &&
+            clientSpeedRate > uint32(sample.allowedSpeed)) << SPEED_HACK_REPORT;
     }
 }
 
@@ -213,6 +322,15 @@ void AnticheatMgr::StartScripts()
 
 void AnticheatMgr::HandlePlayerLogin(Player* player)
 {
+    AnticheatSampleRing* samples = new AnticheatSampleRing(player->GetGUIDLow());
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_ringsLock);
+        AnticheatSampleRing*& ring = m_Rings[player->GetGUIDLow()];
+        delete ring;
+        ring = samples;
+    }
+    player->SetAnticheatSamples(samples);
+
     /*
     // we must delete this to prevent errors in case of crash
     CharacterDatabase.PExecute("DELETE FROM players_reports_status WHERE guid=%u",player->GetGUIDLow());
@@ -232,6 +350,16 @@ void AnticheatMgr::HandlePlayerLogout(Player* player)
     //CharacterDatabase.PExecute("DELETE FROM players_reports_status WHERE guid=%u",player->GetGUIDLow());
     // Delete not needed data from the memory.
     m_Players.erase(player->GetGUIDLow());
+
+    player->SetAnticheatSamples(NULL);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_ringsLock);
+    AnticheatSampleRingMap::iterator itr = m_Rings.find(player->GetGUIDLow());
+    if (itr != m_Rings.end())
+    {
+        delete itr->second;
+        m_Rings.erase(itr);
+    }
 }
 
 void AnticheatMgr::SavePlayerData(Player* player)
@@ -262,14 +390,15 @@ bool AnticheatMgr::MustCheckTempReports(uint8 type)
     return true;
 }
 
-void AnticheatMgr::BuildReport(Player* player,uint8 reportType)
+void AnticheatMgr::BuildReport(uint32 key, uint8 reportType, uint32 actualTime)
 {
-    uint32 key = player->GetGUIDLow();
+    // logged out before its verdicts were applied
+    Player* player = sObjectMgr->GetPlayerByLowGUID(key);
+    if (!player)
+        return;
 
     if (MustCheckTempReports(reportType))
     {
-        uint32 actualTime = getMSTime();
-
         if (!m_Players[key].GetTempReportsTimer(reportType))
             m_Players[key].SetTempReportsTimer(actualTime,reportType);
 
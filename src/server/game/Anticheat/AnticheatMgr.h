@@ -2,14 +2,18 @@
 #define SC_ACMGR_H
 
 #include <ace/Singleton.h>
+#include <ace/Thread_Mutex.h>
 #include "Common.h"
 #include "SharedDefines.h"
 #include "ScriptPCH.h"
 #include "AnticheatData.h"
 #include "Chat.h"
+#include "AnticheatSamples.h"
+#include "LockedQueue.h"
 
 class Player;
 class AnticheatData;
+class AnticheatAnalyzer;
 
 enum ReportTypes
 {
@@ -35,6 +39,23 @@ enum DetectionTypes
 
 // GUIDLow is the key.
 typedef std::map<uint32, AnticheatData> AnticheatPlayersDataMap;
+typedef std::map<uint32, AnticheatSampleRing*> AnticheatSampleRingMap;
+typedef std::vector<AnticheatSample> AnticheatSampleWindow;
+
+// detection posted by the analyzer, applied on the world thread
+struct AnticheatVerdict
+{
+    uint32 lowGuid;
+    uint8 reportType;
+    uint32 time;
+};
+
+/*
+ * StartHackDetection only captures the movement packets into the ring of the
+ * player. The analyzer thread drains the rings in batches and runs each
+ * detector over the window of new samples, and Update(), called by the world
+ * thread, turns its verdicts into reports.
+ */
 
 class AnticheatMgr
 {
@@ -44,7 +65,16 @@ class AnticheatMgr
 
 public:
 
-    void StartHackDetection(Player* player, MovementInfo movementInfo, uint32 opcode);
+    void StartHackDetection(Player* player, MovementInfo const& movementInfo, uint32 opcode);
+
+    void StartAnalyzer();
+    void StopAnalyzer();
+
+    // analyzer thread, analyzes the samples pushed since the last call
+    void AnalyzeSamples();
+
+    // world thread, builds the reports of the verdicts posted by the analyzer
+    void Update();
     void DeletePlayerReport(Player* player, bool login);
     void DeletePlayerData(Player* player);
     void CreatePlayerData(Player* player);
@@ -64,18 +94,28 @@ public:
 
     void ResetDailyReportStates();
 private:
-    void SpeedHackDetection(Player* player, MovementInfo movementInfo);
-    void FlyHackDetection(Player* player, MovementInfo movementInfo);
-    void WalkOnWaterHackDetection(Player* player, MovementInfo movementInfo);
-    void JumpHackDetection(Player* player, MovementInfo movementInfo,uint32 opcode);
-    void TeleportPlaneHackDetection(Player* player, MovementInfo);
-    void ClimbHackDetection(Player* player,MovementInfo movementInfo,uint32 opcode);
+    // window[0] is the previous sample, hits[i] gets the report bit of window[i]
+    void SpeedHackDetection(AnticheatSample const* window, uint32 count, uint8* hits);
+    void FlyHackDetection(AnticheatSample const* window, uint32 count, uint8* hits);
+    void WalkOnWaterHackDetection(AnticheatSample const* window, uint32 count, uint8* hits);
+    void JumpHackDetection(AnticheatSample const* window, uint32 count, uint8* hits);
+    void TeleportPlaneHackDetection(AnticheatSample const* window, uint32 count, uint8* hits);
+    void ClimbHackDetection(AnticheatSample const* window, uint32 count, uint8* hits);
 
-    void BuildReport(Player* player,uint8 reportType);
+    void AnalyzeWindow(uint32 lowGuid, AnticheatSampleWindow const& window);
+
+    void BuildReport(uint32 key, uint8 reportType, uint32 actualTime);
 
     bool MustCheckTempReports(uint8 type);
 
-    AnticheatPlayersDataMap m_Players;                        ///< Player data
+    AnticheatPlayersDataMap m_Players;                        ///< Player data, world thread only
+
+    ACE_Thread_Mutex m_ringsLock;                             ///< Guards m_Rings against login and logout while analyzing
+    AnticheatSampleRingMap m_Rings;
+    AnticheatSampleWindow m_window;                           ///< Analyzer thread only
+    std::vector<uint8> m_hits;                                ///< Analyzer thread only
+    ACE_Based::LockedQueue<AnticheatVerdict, ACE_Thread_Mutex> m_verdicts;
+    AnticheatAnalyzer* m_analyzer;
 };
 
 #define sAnticheatMgr ACE_Singleton<AnticheatMgr, ACE_Null_Mutex>::instance()
@@ -0,0 +1,97 @@
+#ifndef SC_ACSAMPLES_H
+#define SC_ACSAMPLES_H
+
+#include <ace/Atomic_Op.h>
+#include <ace/Thread_Mutex.h>
+
+#include "Define.h"
+
+// must be a power of 2
+#define ANTICHEAT_SAMPLE_RING_SIZE 256
+
+enum AnticheatSampleFlags
+{
+    ANTICHEAT_SAMPLE_UNCHECKED      = 0x01,     // GM, taxi, transport or vehicle, only kept as previous sample
+    ANTICHEAT_SAMPLE_CAN_FLY        = 0x02,     // fly auras
+    ANTICHEAT_SAMPLE_CAN_WALK_WATER = 0x04,     // dead or water walk, feather fall, safe fall auras
+    ANTICHEAT_SAMPLE_CLIMB_EXEMPT   = 0x08      // in water, flying or falling
+};
+
+/*
+ * Everything the detectors need from a movement packet, captured on the map
+ * thread before the movement is applied, so the analysis never touches the
+ * Player.
+ */
+struct AnticheatSample
+{
+    uint32 opcode;
+    uint32 moveFlags;
+    uint32 clientTime;
+    uint32 serverTime;
+    uint32 mapId;
+    float x, y, z;                              // position sent by the client
+    float playerX, playerY, playerZ;            // position of the player when the packet arrived
+    float allowedSpeed;                         // speed of the current move type plus the jump speed
+    float groundZ;                              // only computed for packets at z 0
+    uint32 flags;                               // AnticheatSampleFlags
+};
+
+/*
+ * Single producer single consumer ring of the movement samples of a player.
+ * The map thread handling the player's packets pushes, the anticheat worker
+ * drains; a full ring drops the new samples.
+ */
+class AnticheatSampleRing
+{
+    public:
+        AnticheatSampleRing(uint32 lowGuid) : m_lowGuid(lowGuid), m_head(0), m_tail(0), m_dropped(0), m_hasLast(false) { }
+
+        uint32 GetLowGuid() const { return m_lowGuid; }
+
+        // producer side
+        bool Push(AnticheatSample const& sample)
+        {
+            long head = m_head.value();
+            if (head - m_tail.value() >= ANTICHEAT_SAMPLE_RING_SIZE)
+            {
+                ++m_dropped;
+                return false;
+            }
+
+            m_samples[head & (ANTICHEAT_SAMPLE_RING_SIZE - 1)] = sample;
+            ++m_head;
+            return true;
+        }
+
+        // consumer side, appends the pending samples and returns their count
+        template<class Container>
+        uint32 Drain(Container& out)
+        {
+            long tail = m_tail.value();
+            long head = m_head.value();
+
+            for (long i = tail; i != head; ++i)
+                out.push_back(m_samples[i & (ANTICHEAT_SAMPLE_RING_SIZE - 1)]);
+
+            m_tail = head;
+            return uint32(head - tail);
+        }
+
+        long GetDropped() const { return m_dropped.value(); }
+
+        // last analyzed sample, the reference of the next batch; consumer only
+        AnticheatSample const* GetLast() const { return m_hasLast ? &m_last : NULL; }
+        void SetLast(AnticheatSample const& sample) { m_last = sample; m_hasLast = true; }
+
+    private:
+        uint32 m_lowGuid;
+        AnticheatSample m_samples[ANTICHEAT_SAMPLE_RING_SIZE];
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_head;
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_tail;
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_dropped;
+
+        AnticheatSample m_last;
+        bool m_hasLast;
+};
+
+#endif
@@ -24,6 +24,7 @@
 #include "Common.h"
 #include "DatabaseEnv.h"
 #include "DBCStructure.h"
+#include "AuctionSearchIndex.h"
 
 class Item;
 class Player;
@@ -100,7 +101,7 @@ class AuctionHouseObject
 {
   public:
     // Initialize storage
-    AuctionHouseObject() { next = AuctionsMap.begin(); }
+    AuctionHouseObject() { }
     ~AuctionHouseObject()
     {
         for (AuctionEntryMap::iterator itr = AuctionsMap.begin(); itr != AuctionsMap.end(); ++itr)
@@ -108,6 +109,8 @@ class AuctionHouseObject
     }
 
     typedef std::map<uint32, AuctionEntry*> AuctionEntryMap;
+    // (expire time, auction id), oldest first
+    typedef std::set<std::pair<time_t, uint32> > AuctionExpiryIndex;
 
     uint32 Getcount() const { return AuctionsMap.size(); }
 
@@ -124,7 +127,8 @@ class AuctionHouseObject
 
     bool RemoveAuction(AuctionEntry* auction, uint32 itemEntry);
 
-    void Update();
+    // expires auctions into the sweep transaction of AuctionHouseMgr::Update, returns their number
+    uint32 Update(SQLTransaction& trans);
 
     void BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
     void BuildListOwnerItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount);
@@ -135,9 +139,8 @@ class AuctionHouseObject
 
   private:
     AuctionEntryMap AuctionsMap;
-
-    // storage for "next" auction item for next Update()
-    AuctionEntryMap::const_iterator next;
+    AuctionExpiryIndex ExpiryIndex;
+    AuctionSearchIndex SearchIndex;
 };
 
 class AuctionHouseMgr
@@ -0,0 +1,332 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionSearchIndex.h"
+#include "AuctionHouseMgr.h"
+#include "DBCStores.h"
+#include "Item.h"
+#include "ObjectMgr.h"
+#include "Util.h"
+
+#include <algorithm>
+
+void AuctionSearchIndex::Insert(AuctionEntry const* auction, Item const* item)
+{
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(auction->itemEntry);
+    if (!proto)
+        return;
+
+    Remove(auction->Id);
+
+    AuctionInfo& info = _auctions[auction->Id];
+    info.itemEntry = auction->itemEntry;
+    info.randomPropertyId = item ? item->GetItemRandomPropertyId() : 0;
+    info.itemClass = proto->Class;
+    info.itemSubClass = proto->SubClass;
+    info.inventoryType = proto->InventoryType;
+    info.quality = proto->Quality;
+    info.requiredLevel = proto->RequiredLevel;
+
+    _all.insert(auction->Id);
+    AddToBucket(_byClass, info.itemClass, auction->Id);
+    AddToBucket(_bySubClass, info.itemSubClass, auction->Id);
+    AddToBucket(_byInventoryType, info.inventoryType, auction->Id);
+    AddToBucket(_byQuality, info.quality, auction->Id);
+    AddToBucket(_byLevel, info.requiredLevel, auction->Id);
+
+    for (NameIndexMap::iterator itr = _names.begin(); itr != _names.end(); ++itr)
+    {
+        std::wstring name;
+        BuildName(info, itr->first, name);
+        AddName(itr->second, auction->Id, name);
+    }
+}
+
+void AuctionSearchIndex::Remove(uint32 auctionId)
+{
+    AuctionInfoMap::iterator itr = _auctions.find(auctionId);
+    if (itr == _auctions.end())
+        return;
+
+    AuctionInfo const& info = itr->second;
+    RemoveFromBucket(_byClass, info.itemClass, auctionId);
+    RemoveFromBucket(_bySubClass, info.itemSubClass, auctionId);
+    RemoveFromBucket(_byInventoryType, info.inventoryType, auctionId);
+    RemoveFromBucket(_byQuality, info.quality, auctionId);
+    RemoveFromBucket(_byLevel, info.requiredLevel, auctionId);
+    _all.erase(auctionId);
+
+    for (NameIndexMap::iterator nameItr = _names.begin(); nameItr != _names.end(); ++nameItr)
+        RemoveName(nameItr->second, auctionId);
+
+    _auctions.erase(itr);
+}
+
+void AuctionSearchIndex::Search(AuctionSearchQuery const& query, std::vector<uint32>& result)
+{
+    result.clear();
+
+    // smallest bucket the results have to be in, an empty one means no result
+    AuctionIdSet const* best = &_all;
+    if (!NarrowTo(_byClass, query.itemClass, best) ||
+        !NarrowTo(_bySubClass, query.itemSubClass, best) ||
+        !NarrowTo(_byInventoryType, query.inventoryType, best) ||
+        !NarrowTo(_byQuality, query.quality, best))
+        return;
+
+    std::vector<uint32> candidates;
+    bool fromBest = true;
+
+    if (query.levelmin)
+    {
+        uint32 levelmax = query.levelmax ? query.levelmax : 0xFF;
+        size_t size = 0;
+        for (uint32 level = query.levelmin; level <= levelmax; ++level)
+        {
+            BucketMap::const_iterator itr = _byLevel.find(level);
+            if (itr != _byLevel.end())
+                size += itr->second.size();
+        }
+
+        if (!size)
+            return;
+
+        if (size < best->size())
+        {
+            candidates.reserve(size);
+            for (uint32 level = query.levelmin; level <= levelmax; ++level)
+            {
+                BucketMap::const_iterator itr = _byLevel.find(level);
+                if (itr != _byLevel.end())
+                    candidates.insert(candidates.end(), itr->second.begin(), itr->second.end());
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+            fromBest = false;
+        }
+    }
+
+    NameIndex* names = NULL;
+    if (!query.name.empty())
+    {
+        names = &GetNameIndex(query.locale);
+
+        // any match of the searched text contains its longest word whole, inside a single word of the name
+        std::wstring word;
+        for (size_t start = 0; start < query.name.size();)
+        {
+            size_t end = query.name.find(L' ', start);
+            if (end == std::wstring::npos)
+                end = query.name.size();
+
+            if (end - start > word.size())
+                word = query.name.substr(start, end - start);
+
+            start = end + 1;
+        }
+
+        if (!word.empty())
+        {
+            std::vector<uint32> matching;
+            for (std::map<std::wstring, AuctionIdSet>::const_iterator itr = names->words.begin(); itr != names->words.end(); ++itr)
+                if (itr->first.find(word) != std::wstring::npos)
+                    matching.insert(matching.end(), itr->second.begin(), itr->second.end());
+
+            if (matching.empty())
+                return;
+
+            if (matching.size() < (fromBest ? best->size() : candidates.size()))
+            {
+                std::sort(matching.begin(), matching.end());
+                matching.erase(std::unique(matching.begin(), matching.end()), matching.end());
+                candidates.swap(matching);
+                fromBest = false;
+            }
+        }
+    }
+
+    if (fromBest)
+        candidates.assign(best->begin(), best->end());
+
+    for (std::vector<uint32>::const_iterator itr = candidates.begin(); itr != candidates.end(); ++itr)
+    {
+        AuctionInfoMap::const_iterator info = _auctions.find(*itr);
+        if (info == _auctions.end() || !Matches(info->second, query))
+            continue;
+
+        if (names)
+        {
+            UNORDERED_MAP<uint32, std::wstring>::const_iterator name = names->names.find(*itr);
+            if (name == names->names.end() || name->second.find(query.name) == std::wstring::npos)
+                continue;
+        }
+
+        result.push_back(*itr);
+    }
+}
+
+void AuctionSearchIndex::AddToBucket(BucketMap& buckets, uint32 key, uint32 auctionId)
+{
+    buckets[key].insert(auctionId);
+}
+
+void AuctionSearchIndex::RemoveFromBucket(BucketMap& buckets, uint32 key, uint32 auctionId)
+{
+    BucketMap::iterator itr = buckets.find(key);
+    if (itr == buckets.end())
+        return;
+
+    itr->second.erase(auctionId);
+    if (itr->second.empty())
+        buckets.erase(itr);
+}
+
+bool AuctionSearchIndex::NarrowTo(BucketMap const& buckets, uint32 key, AuctionIdSet const*& best)
+{
+    if (key == AUCTION_SEARCH_ANY)
+        return true;
+
+    BucketMap::const_iterator itr = buckets.find(key);
+    if (itr == buckets.end())
+        return false;
+
+    if (itr->second.size() < best->size())
+        best = &itr->second;
+
+    return true;
+}
+
+void AuctionSearchIndex::BuildName(AuctionInfo const& info, int locale, std::wstring& name)
+{
+    name.clear();
+
+    ItemTemplate const* proto = sObjectMgr->GetItemTemplate(info.itemEntry);
+    if (!proto || proto->Name1.empty())
+        return;
+
+    std::string utf8name = proto->Name1;
+
+    // local name
+    if (locale >= 0)
+        if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+            ObjectMgr::GetLocaleString(il->Name, locale, utf8name);
+
+    // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
+    //  that matches the search but it may not equal item->GetItemRandomPropertyId()
+    //  used in BuildAuctionInfo() which then causes wrong items to be listed
+    // These are found in ItemRandomProperties.dbc, not ItemRandomSuffix.dbc
+    if (info.randomPropertyId)
+        if (ItemRandomPropertiesEntry const* itemRandProp = sItemRandomPropertiesStore.LookupEntry(info.randomPropertyId))
+            if (itemRandProp->nameSuffix && *itemRandProp->nameSuffix)
+            {
+                utf8name += ' ';
+                utf8name += itemRandProp->nameSuffix;
+            }
+
+    if (!Utf8toWStr(utf8name, name))
+    {
+        name.clear();
+        return;
+    }
+
+    wstrToLower(name);
+}
+
+void AuctionSearchIndex::AddName(NameIndex& index, uint32 auctionId, std::wstring const& name)
+{
+    index.names[auctionId] = name;
+
+    for (size_t start = 0; start < name.size();)
+    {
+        size_t end = name.find(L' ', start);
+        if (end == std::wstring::npos)
+            end = name.size();
+
+        if (end > start)
+            index.words[name.substr(start, end - start)].insert(auctionId);
+
+        start = end + 1;
+    }
+}
+
+void AuctionSearchIndex::RemoveName(NameIndex& index, uint32 auctionId)
+{
+    UNORDERED_MAP<uint32, std::wstring>::iterator itr = index.names.find(auctionId);
+    if (itr == index.names.end())
+        return;
+
+    std::wstring const& name = itr->second;
+    for (size_t start = 0; start < name.size();)
+    {
+        size_t end = name.find(L' ', start);
+        if (end == std::wstring::npos)
+            end = name.size();
+
+        if (end > start)
+        {
+            std::map<std::wstring, AuctionIdSet>::iterator word = index.words.find(name.substr(start, end - start));
+            if (word != index.words.end())
+            {
+                word->second.erase(auctionId);
+                if (word->second.empty())
+                    index.words.erase(word);
+            }
+        }
+
+        start = end + 1;
+    }
+
+    index.names.erase(itr);
+}
+
+AuctionSearchIndex::NameIndex& AuctionSearchIndex::GetNameIndex(int locale)
+{
+    NameIndexMap::iterator itr = _names.find(locale);
+    if (itr != _names.end())
+        return itr->second;
+
+    NameIndex& index = _names[locale];
+    for (AuctionInfoMap::const_iterator info = _auctions.begin(); info != _auctions.end(); ++info)
+    {
+        std::wstring name;
+        BuildName(info->second, locale, name);
+        AddName(index, info->first, name);
+    }
+
+    return index;
+}
+
+bool AuctionSearchIndex::Matches(AuctionInfo const& info, AuctionSearchQuery const& query)
+{
+    if (query.itemClass != AUCTION_SEARCH_ANY && info.itemClass != query.itemClass)
+        return false;
+
+    if (query.itemSubClass != AUCTION_SEARCH_ANY && info.itemSubClass != query.itemSubClass)
+        return false;
+
+    if (query.inventoryType != AUCTION_SEARCH_ANY && info.inventoryType != query.inventoryType)
+        return false;
+
+    if (query.quality != AUCTION_SEARCH_ANY && info.quality != query.quality)
+        return false;
+
+    if (query.levelmin != 0x00 && (info.requiredLevel < query.levelmin || (query.levelmax != 0x00 && info.requiredLevel > query.levelmax)))
+        return false;
+
+    return true;
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _AUCTION_SEARCH_INDEX_H
+#define _AUCTION_SEARCH_INDEX_H
+
+#include "Define.h"
+#include "UnorderedMap.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+struct AuctionEntry;
+class Item;
+
+#define AUCTION_SEARCH_ANY 0xFFFFFFFF
+
+// filters of CMSG_AUCTION_LIST_ITEMS, except "usable" which depends on the player
+struct AuctionSearchQuery
+{
+    AuctionSearchQuery() : itemClass(AUCTION_SEARCH_ANY), itemSubClass(AUCTION_SEARCH_ANY),
+        inventoryType(AUCTION_SEARCH_ANY), quality(AUCTION_SEARCH_ANY), levelmin(0), levelmax(0), locale(-1) { }
+
+    uint32 itemClass;
+    uint32 itemSubClass;
+    uint32 inventoryType;
+    uint32 quality;
+    uint8 levelmin;                                         // 0 for any level
+    uint8 levelmax;                                         // 0 for no upper bound
+    std::wstring name;                                      // lower case, empty for any name
+    int locale;                                             // db locale index of the searching session
+};
+
+/*
+ * Secondary indexes of the auctions of one house, kept up to date by
+ * AuctionHouseObject::AddAuction/RemoveAuction.
+ *
+ * A search starts from the smallest bucket matching its filters (class,
+ * subclass, inventory type, quality, required level range or the name words
+ * containing the searched text) and checks only the auctions in it. The
+ * localized names, with their random property suffix, are built once per
+ * locale on the first search by name in that locale.
+ */
+class AuctionSearchIndex
+{
+    public:
+        typedef std::set<uint32> AuctionIdSet;              // ordered like AuctionsMap
+
+        AuctionSearchIndex() { }
+
+        void Insert(AuctionEntry const* auction, Item const* item);
+        void Remove(uint32 auctionId);
+
+        // ids of the auctions matching the query, in ascending order
+        void Search(AuctionSearchQuery const& query, std::vector<uint32>& result);
+
+    private:
+        struct AuctionInfo
+        {
+            uint32 itemEntry;
+            int32 randomPropertyId;
+            uint32 itemClass;
+            uint32 itemSubClass;
+            uint32 inventoryType;
+            uint32 quality;
+            uint32 requiredLevel;
+        };
+
+        struct NameIndex
+        {
+            UNORDERED_MAP<uint32, std::wstring> names;      // lower case name and suffix
+            std::map<std::wstring, AuctionIdSet> words;
+        };
+
+        typedef UNORDERED_MAP<uint32, AuctionInfo> AuctionInfoMap;
+        typedef UNORDERED_MAP<uint32, AuctionIdSet> BucketMap;
+        typedef UNORDERED_MAP<int, NameIndex> NameIndexMap;
+
+        static void AddToBucket(BucketMap& buckets, uint32 key, uint32 auctionId);
+        static void RemoveFromBucket(BucketMap& buckets, uint32 key, uint32 auctionId);
+        static bool NarrowTo(BucketMap const& buckets, uint32 key, AuctionIdSet const*& best);
+
+        static void BuildName(AuctionInfo const& info, int locale, std::wstring& name);
+        static void AddName(NameIndex& index, uint32 auctionId, std::wstring const& name);
+        static void RemoveName(NameIndex& index, uint32 auctionId);
+
+        NameIndex& GetNameIndex(int locale);
+        static bool Matches(AuctionInfo const& info, AuctionSearchQuery const& query);
+
+        AuctionInfoMap _auctions;
+        AuctionIdSet _all;
+
+        BucketMap _byClass;
+        BucketMap _bySubClass;
+        BucketMap _byInventoryType;
+        BucketMap _byQuality;
+        BucketMap _byLevel;
+
+        NameIndexMap _names;
+};
+
+#endif
@@ -571,12 +571,12 @@ void BattlegroundDG::RespawnFlag(uint32 Team, bool captured)
 {
     if (Team == ALLIANCE)
     {
-        sLog->outDebug(LOG_FILTER_BATTLEGROUND, "Respawn Alliance flag");
+        TC_LOG_DEBUG(LOG_FILTER_BATTLEGROUND, "Respawn Alliance flag");
         m_flagState[BG_TEAM_ALLIANCE] = BG_DG_FLAG_STATE_ON_BASE;
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_BATTLEGROUND, "Respawn Horde flag");
+        TC_LOG_DEBUG(LOG_FILTER_BATTLEGROUND, "Respawn Horde flag");
         m_flagState[BG_TEAM_HORDE] = BG_DG_FLAG_STATE_ON_BASE;
     }
 
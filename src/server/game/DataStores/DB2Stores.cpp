@@ -20,6 +20,9 @@
 #include "SharedDefines.h"
 #include "SpellMgr.h"
 #include "DB2fmt.h"
+#include "DataStoreLoader.h"
+
+#include <ace/Guard_T.h>
 
 #include <map>
 
@@ -59,47 +62,71 @@ struct LocalDB2Data
 };
 
 template<class T>
-inline void LoadDB2(StoreProblemList1& errlist, DB2Storage<T>& storage, const std::string& db2_path, const std::string& filename)
+class DB2LoadJob : public DataStoreLoadJob
+{
+    public:
+        DB2LoadJob(ACE_Thread_Mutex& lock, StoreProblemList1& errlist, DB2Storage<T>& storage, const std::string& db2_path, const std::string& filename) :
+            _lock(lock), _errlist(errlist), _storage(storage), _db2Filename(db2_path + filename) { }
+
+        void Load()
+        {
+            if (_storage.Load(_db2Filename.c_str()))
+                return;
+
+            std::string error = _db2Filename;
+
+            // sort problematic db2 to (1) non compatible and (2) nonexistent
+            if (FILE * f = fopen(_db2Filename.c_str(), "rb"))
+            {
+                char buf[100];
+                snprintf(buf, 100,"(exist, but have %d fields instead " SIZEFMTD ") Wrong client version DBC file?", _storage.GetFieldCount(), strlen(_storage.GetFormat()));
+                error += buf;
+                fclose(f);
+            }
+
+            TRINITY_GUARD(ACE_Thread_Mutex, _lock);
+            _errlist.push_back(error);
+        }
+
+    private:
+        ACE_Thread_Mutex& _lock;
+        StoreProblemList1& _errlist;
+        DB2Storage<T>& _storage;
+        std::string _db2Filename;
+};
+
+template<class T>
+inline void LoadDB2(DataStoreLoader& loader, ACE_Thread_Mutex& lock, StoreProblemList1& errlist, DB2Storage<T>& storage, const std::string& db2_path, const std::string& filename)
 {
     // compatibility format and C++ structure sizes
     ASSERT(DB2FileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDB2_assert_print(DB2FileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
     ++DB2FilesCount;
-
-    std::string db2_filename = db2_path + filename;
-    if (!storage.Load(db2_filename.c_str()))
-    {
-        // sort problematic db2 to (1) non compatible and (2) nonexistent
-        if (FILE * f = fopen(db2_filename.c_str(), "rb"))
-        {
-            char buf[100];
-            snprintf(buf, 100,"(exist, but have %d fields instead " SIZEFMTD ") Wrong client version DBC file?", storage.GetFieldCount(), strlen(storage.GetFormat()));
-            errlist.push_back(db2_filename + buf);
-            fclose(f);
-        }
-        else
-            errlist.push_back(db2_filename);
-    }
+    loader.Queue(new DB2LoadJob<T>(lock, errlist, storage, db2_path, filename));
 }
 
-void LoadDB2Stores(const std::string& dataPath)
+void LoadDB2Stores(const std::string& dataPath, uint32 threads)
 {
     std::string db2Path = dataPath + "dbc/";
 
+    DataStoreLoader loader;
+    ACE_Thread_Mutex lock;                                  // guards bad_db2_files
     StoreProblemList1 bad_db2_files;
 
-    LoadDB2(bad_db2_files, sBattlePetSpeciesStore, db2Path, "BattlePetSpecies.db2");
-    LoadDB2(bad_db2_files, sItemStore, db2Path, "Item.db2");
-    LoadDB2(bad_db2_files, sItemCurrencyCostStore, db2Path, "ItemCurrencyCost.db2");
-    LoadDB2(bad_db2_files, sItemSparseStore, db2Path, "Item-sparse.db2");
-    LoadDB2(bad_db2_files, sItemExtendedCostStore, db2Path, "ItemExtendedCost.db2");
-    LoadDB2(bad_db2_files, sKeyChainStore, db2Path, "KeyChain.db2");
-    LoadDB2(bad_db2_files, sSceneScriptStore, db2Path, "SceneScript.db2");
-    LoadDB2(bad_db2_files, sSceneScriptPackageStore, db2Path, "SceneScriptPackage.db2");
-    LoadDB2(bad_db2_files, sSpellReagentsStore, db2Path, "SpellReagents.db2");                                                 // 17399
-    LoadDB2(bad_db2_files, sItemUpgradeStore, db2Path, "ItemUpgrade.db2");
-    LoadDB2(bad_db2_files, sRulesetItemUpgradeStore, db2Path, "RulesetItemUpgrade.db2");
-    LoadDB2(bad_db2_files, sQuestPackageItemStore, db2Path, "QuestPackageItem.db2");
+    LoadDB2(loader, lock, bad_db2_files, sBattlePetSpeciesStore, db2Path, "BattlePetSpecies.db2");
+    LoadDB2(loader, lock, bad_db2_files, sItemStore, db2Path, "Item.db2");
+    LoadDB2(loader, lock, bad_db2_files, sItemCurrencyCostStore, db2Path, "ItemCurrencyCost.db2");
+    LoadDB2(loader, lock, bad_db2_files, sItemSparseStore, db2Path, "Item-sparse.db2");
+    LoadDB2(loader, lock, bad_db2_files, sItemExtendedCostStore, db2Path, "ItemExtendedCost.db2");
+    LoadDB2(loader, lock, bad_db2_files, sKeyChainStore, db2Path, "KeyChain.db2");
+    LoadDB2(loader, lock, bad_db2_files, sSceneScriptStore, db2Path, "SceneScript.db2");
+    LoadDB2(loader, lock, bad_db2_files, sSceneScriptPackageStore, db2Path, "SceneScriptPackage.db2");
+    LoadDB2(loader, lock, bad_db2_files, sSpellReagentsStore, db2Path, "SpellReagents.db2");                                                 // 17399
+    LoadDB2(loader, lock, bad_db2_files, sItemUpgradeStore, db2Path, "ItemUpgrade.db2");
+    LoadDB2(loader, lock, bad_db2_files, sRulesetItemUpgradeStore, db2Path, "RulesetItemUpgrade.db2");
+    LoadDB2(loader, lock, bad_db2_files, sQuestPackageItemStore, db2Path, "QuestPackageItem.db2");
+
+    loader.Load(threads);
 
     // error checks
     if (bad_db2_files.size() >= DB2FilesCount)
@@ -38,6 +38,7 @@ extern DB2Storage <ItemUpgradeEntry> sItemUpgradeStore;
 extern DB2Storage <RulesetItemUpgradeEntry> sRulesetItemUpgradeStore;
 extern DB2Storage <QuestPackageItemEntry> sQuestPackageItemStore;
 
-void LoadDB2Stores(const std::string& dataPath);
+// threads reading the files, 0 for one per processor
+void LoadDB2Stores(const std::string& dataPath, uint32 threads);
 
 #endif
@@ -22,6 +22,10 @@
 #include "SpellMgr.h"
 #include "DBCfmt.h"
 #include "ItemPrototype.h"
+#include "DataStoreLoader.h"
+
+#include <ace/Guard_T.h>
+
 #include <iostream>
 #include <fstream>
 
@@ -274,61 +278,255 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
     return false;
 }
 
-template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, std::string const* customFormat = NULL, std::string const* customIndexName = NULL)
+// Locales and problems shared by the DBC load jobs
+struct DBCLoadContext
 {
-    // Compatibility format and C++ structure sizes
-    ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
+    DBCLoadContext() : availableDbcLocales(0xFFFFFFFF) { }
 
-    ++DBCFileCount;
-    std::string dbcFilename = dbcPath + filename;
-    SqlDbc * sql = NULL;
-    if (customFormat)
-        sql = new SqlDbc(&filename, customFormat, customIndexName, storage.GetFormat());
+    ACE_Thread_Mutex lock;
+    uint32 availableDbcLocales;                             // bitmask of localeNames, cleared by the first file missing one
+    StoreProblemList errors;
+};
 
-    if (storage.Load(dbcFilename.c_str(), sql))
-    {
-        for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+template<class T>
+class DBCLoadJob : public DataStoreLoadJob
+{
+    public:
+        DBCLoadJob(DBCLoadContext& context, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, std::string const* customFormat, std::string const* customIndexName) :
+            _context(context), _storage(storage), _dbcPath(dbcPath), _filename(filename), _customFormat(customFormat), _customIndexName(customIndexName) { }
+
+        void Load()
         {
-            if (!(availableDbcLocales & (1 << i)))
-                continue;
+            std::string dbcFilename = _dbcPath + _filename;
+            SqlDbc * sql = NULL;
+            if (_customFormat)
+                sql = new SqlDbc(&_filename, _customFormat, _customIndexName, _storage.GetFormat());
 
-            std::string localizedName(dbcPath);
-            localizedName.append(localeNames[i]);
-            localizedName.push_back('/');
-            localizedName.append(filename);
+            if (_storage.Load(dbcFilename.c_str(), sql))
+            {
+                uint32 availableDbcLocales;
+                {
+                    TRINITY_GUARD(ACE_Thread_Mutex, _context.lock);
+                    availableDbcLocales = _context.availableDbcLocales;
+                }
 
-            if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1<<i);                 // Mark as not available for speedup next checks
-        }
-    }
-    else
-    {
-        // Sort problematic dbc to (1) non compatible and (2) non-existed
-        if (FILE* f = fopen(dbcFilename.c_str(), "rb"))
-        {
-            char buf[100];
-            snprintf(buf, 100, " (exists, but has %u fields instead of " SIZEFMTD ") Possible wrong client version.", storage.GetFieldCount(), strlen(storage.GetFormat()));
-            errors.push_back(dbcFilename + buf);
-            fclose(f);
+                for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+                {
+                    if (!(availableDbcLocales & (1 << i)))
+                        continue;
+
+                    std::string localizedName(_dbcPath);
+                    localizedName.append(localeNames[i]);
+                    localizedName.push_back('/');
+                    localizedName.append(_filename);
+
+                    if (!_storage.LoadStringsFrom(localizedName.c_str()))
+                    {
+                        TRINITY_GUARD(ACE_Thread_Mutex, _context.lock);
+                        _context.availableDbcLocales &= ~(1<<i);    // Mark as not available for speedup next checks
+                    }
+                }
+            }
+            else
+            {
+                std::string error = dbcFilename;
+
+                // Sort problematic dbc to (1) non compatible and (2) non-existed
+                if (FILE* f = fopen(dbcFilename.c_str(), "rb"))
+                {
+                    char buf[100];
+                    snprintf(buf, 100, " (exists, but has %u fields instead of " SIZEFMTD ") Possible wrong client version.", _storage.GetFieldCount(), strlen(_storage.GetFormat()));
+                    error += buf;
+                    fclose(f);
+                }
+
+                TRINITY_GUARD(ACE_Thread_Mutex, _context.lock);
+                _context.errors.push_back(error);
+            }
+
+            delete sql;
         }
-        else
-            errors.push_back(dbcFilename);
-    }
 
-    delete sql;
+    private:
+        DBCLoadContext& _context;
+        DBCStorage<T>& _storage;
+        std::string _dbcPath;
+        std::string _filename;
+        std::string const* _customFormat;
+        std::string const* _customIndexName;
+};
+
+template<class T>
+inline void LoadDBC(DataStoreLoader& loader, DBCLoadContext& context, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, std::string const* customFormat = NULL, std::string const* customIndexName = NULL)
+{
+    // Compatibility format and C++ structure sizes
+    ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
+
+    ++DBCFileCount;
+    loader.Queue(new DBCLoadJob<T>(context, storage, dbcPath, filename, customFormat, customIndexName));
 }
 
-void LoadDBCStores(const std::string& dataPath)
+void LoadDBCStores(const std::string& dataPath, uint32 threads)
 {
     uint32 oldMSTime = getMSTime();
 
     std::string dbcPath = dataPath+"dbc/";
 
-    StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaStore,                   dbcPath, "AreaTable.dbc");
+    // Files are read concurrently, the data built from the stores is filled once they are all loaded
+    DataStoreLoader loader;
+    DBCLoadContext context;
+
+    LoadDBC(loader, context, sAreaStore,                   dbcPath, "AreaTable.dbc");
+    LoadDBC(loader, context, sAchievementStore,            dbcPath, "Achievement.dbc", &CustomAchievementfmt, &CustomAchievementIndex);  // 17399
+    LoadDBC(loader, context, sAchievementCriteriaStore,    dbcPath, "Achievement_Criteria.dbc");                                         // 17399
+    LoadDBC(loader, context, sAreaTriggerStore,            dbcPath, "AreaTrigger.dbc");                                                  // 17399
+    LoadDBC(loader, context, sAreaGroupStore,              dbcPath, "AreaGroup.dbc");                                                    // 17399
+    LoadDBC(loader, context, sAreaPOIStore,                dbcPath, "AreaPOI.dbc");                                                      // 17399
+    LoadDBC(loader, context, sAuctionHouseStore,           dbcPath, "AuctionHouse.dbc");                                                 // 17399
+    LoadDBC(loader, context, sArmorLocationStore,          dbcPath, "ArmorLocation.dbc");                                                // 17399
+    LoadDBC(loader, context, sBankBagSlotPricesStore,      dbcPath, "BankBagSlotPrices.dbc");                                            // 17399
+    LoadDBC(loader, context, sBattlemasterListStore,       dbcPath, "BattleMasterList.dbc");                                             // 17399
+    LoadDBC(loader, context, sBarberShopStyleStore,        dbcPath, "BarberShopStyle.dbc");                                              // 17399
+    LoadDBC(loader, context, sCharStartOutfitStore,        dbcPath, "CharStartOutfit.dbc");                                              // 17399
+    LoadDBC(loader, context, sCharTitlesStore,             dbcPath, "CharTitles.dbc");                                                   // 17399
+    LoadDBC(loader, context, sChatChannelsStore,           dbcPath, "ChatChannels.dbc");                                                 // 17399
+    LoadDBC(loader, context, sChrClassesStore,             dbcPath, "ChrClasses.dbc");                                                   // 17399
+    LoadDBC(loader, context, sChrRacesStore,               dbcPath, "ChrRaces.dbc");                                                     // 17399
+    LoadDBC(loader, context, sChrPowerTypesStore,          dbcPath, "ChrClassesXPowerTypes.dbc");                                        // 17399
+    LoadDBC(loader, context, sChrSpecializationsStore,     dbcPath, "ChrSpecialization.dbc");                                            // 17399
+    LoadDBC(loader, context, sCinematicSequencesStore,     dbcPath, "CinematicSequences.dbc");                                           // 17399
+    LoadDBC(loader, context, sCreatureDisplayInfoStore,    dbcPath, "CreatureDisplayInfo.dbc");                                          // 17399
+    LoadDBC(loader, context, sCreatureFamilyStore,         dbcPath, "CreatureFamily.dbc");                                               // 17399
+    LoadDBC(loader, context, sCreatureModelDataStore,      dbcPath, "CreatureModelData.dbc");                                            // 17399
+    LoadDBC(loader, context, sCreatureSpellDataStore,      dbcPath, "CreatureSpellData.dbc");                                            // 17399
+    LoadDBC(loader, context, sCreatureTypeStore,           dbcPath, "CreatureType.dbc");                                                 // 17399
+    LoadDBC(loader, context, sCurrencyTypesStore,          dbcPath, "CurrencyTypes.dbc");                                                // 17399
+    LoadDBC(loader, context, sDestructibleModelDataStore,  dbcPath, "DestructibleModelData.dbc");                                        // 17399
+    LoadDBC(loader, context, sDungeonEncounterStore,       dbcPath, "DungeonEncounter.dbc");                                             // 17399
+    LoadDBC(loader, context, sDurabilityCostsStore,        dbcPath, "DurabilityCosts.dbc");                                              // 17399
+    LoadDBC(loader, context, sDurabilityQualityStore,      dbcPath, "DurabilityQuality.dbc");                                            // 17399
+    LoadDBC(loader, context, sEmotesStore,                 dbcPath, "Emotes.dbc");                                                       // 17399
+    LoadDBC(loader, context, sEmotesTextStore,             dbcPath, "EmotesText.dbc");                                                   // 17399
+    LoadDBC(loader, context, sFactionStore,                dbcPath, "Faction.dbc");                                                      // 17399
+    LoadDBC(loader, context, sFactionTemplateStore,        dbcPath, "FactionTemplate.dbc");                                              // 17399
+    LoadDBC(loader, context, sGameObjectDisplayInfoStore,  dbcPath, "GameObjectDisplayInfo.dbc");                                        // 17399
+    LoadDBC(loader, context, sGemPropertiesStore,          dbcPath, "GemProperties.dbc");                                                // 17399
+    LoadDBC(loader, context, sGlyphPropertiesStore,        dbcPath, "GlyphProperties.dbc");                                              // 17399
+    LoadDBC(loader, context, sGlyphSlotStore,              dbcPath, "GlyphSlot.dbc");                                                    // 17399
+    LoadDBC(loader, context, sGtBarberShopCostBaseStore,   dbcPath, "gtBarberShopCostBase.dbc");                                         // 17399
+    LoadDBC(loader, context, sGtCombatRatingsStore,        dbcPath, "gtCombatRatings.dbc");                                              // 17399
+    LoadDBC(loader, context, sGtChanceToMeleeCritBaseStore,dbcPath, "gtChanceToMeleeCritBase.dbc");                                      // 17399
+    LoadDBC(loader, context, sGtChanceToMeleeCritStore,    dbcPath, "gtChanceToMeleeCrit.dbc");                                          // 17399
+    LoadDBC(loader, context, sGtChanceToSpellCritBaseStore,dbcPath, "gtChanceToSpellCritBase.dbc");                                      // 17399
+    LoadDBC(loader, context, sGtChanceToSpellCritStore,    dbcPath, "gtChanceToSpellCrit.dbc");                                          // 17399
+    LoadDBC(loader, context, sGtOCTClassCombatRatingScalarStore,    dbcPath, "gtOCTClassCombatRatingScalar.dbc");                        // 17399
+    //LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTRegenHPStore,           dbcPath, "gtOCTRegenHP.dbc");                                               // Not used currently
+    LoadDBC(loader, context, sGtOCTHpPerStaminaStore,      dbcPath, "gtOCTHpPerStamina.dbc");                                            //17399
+    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sGtOCTRegenMPStore,           dbcPath, "gtOCTRegenMP.dbc");                                     // Not used currently
+    LoadDBC(loader, context, sGtRegenMPPerSptStore,        dbcPath, "gtRegenMPPerSpt.dbc");                                              //17399
+    LoadDBC(loader, context, sGtSpellScalingStore,         dbcPath, "gtSpellScaling.dbc");                                               //17399
+    LoadDBC(loader, context, sGtOCTBaseHPByClassStore,     dbcPath, "gtOCTBaseHPByClass.dbc");                                           //17399
+    LoadDBC(loader, context, sGtOCTBaseMPByClassStore,     dbcPath, "gtOCTBaseMPByClass.dbc");                                           //17399
+    LoadDBC(loader, context, sGuildPerkSpellsStore,        dbcPath, "GuildPerkSpells.dbc");                                              //17399
+    LoadDBC(loader, context, sHolidaysStore,               dbcPath, "Holidays.dbc");                                                     // 17399
+    LoadDBC(loader, context, sImportPriceArmorStore,       dbcPath, "ImportPriceArmor.dbc");                                             // 17399
+    LoadDBC(loader, context, sImportPriceQualityStore,     dbcPath, "ImportPriceQuality.dbc");                                           // 17399
+    LoadDBC(loader, context, sImportPriceShieldStore,      dbcPath, "ImportPriceShield.dbc");                                            // 17399
+    LoadDBC(loader, context, sImportPriceWeaponStore,      dbcPath, "ImportPriceWeapon.dbc");                                            // 17399
+    LoadDBC(loader, context, sItemPriceBaseStore,          dbcPath, "ItemPriceBase.dbc");                                                // 17399
+    LoadDBC(loader, context, sItemReforgeStore,            dbcPath, "ItemReforge.dbc");                                                  // 17399
+    LoadDBC(loader, context, sItemBagFamilyStore,          dbcPath, "ItemBagFamily.dbc");                                                // 17399
+    LoadDBC(loader, context, sItemClassStore,              dbcPath, "ItemClass.dbc");                                                    // 17399
+    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sItemDisplayInfoStore,        dbcPath, "ItemDisplayInfo.dbc");                                  // Not used currently
+    LoadDBC(loader, context, sItemLimitCategoryStore,      dbcPath, "ItemLimitCategory.dbc");                                            // 17399
+    LoadDBC(loader, context, sItemRandomPropertiesStore,   dbcPath, "ItemRandomProperties.dbc");                                         // 17399
+    LoadDBC(loader, context, sItemRandomSuffixStore,       dbcPath, "ItemRandomSuffix.dbc");                                             // 17399
+    LoadDBC(loader, context, sItemSetStore,                dbcPath, "ItemSet.dbc");                                                      // 17399
+    LoadDBC(loader, context, sItemArmorQualityStore,       dbcPath, "ItemArmorQuality.dbc");                                             // 17399
+    LoadDBC(loader, context, sItemArmorShieldStore,        dbcPath, "ItemArmorShield.dbc");                                              // 17399
+    LoadDBC(loader, context, sItemArmorTotalStore,         dbcPath, "ItemArmorTotal.dbc");                                               // 17399
+    LoadDBC(loader, context, sItemDamageAmmoStore,         dbcPath, "ItemDamageAmmo.dbc");                                               // 17399
+    LoadDBC(loader, context, sItemDamageOneHandStore,      dbcPath, "ItemDamageOneHand.dbc");                                            // 17399
+    LoadDBC(loader, context, sItemDamageOneHandCasterStore,dbcPath, "ItemDamageOneHandCaster.dbc");                                      // 17399
+    LoadDBC(loader, context, sItemDamageRangedStore,       dbcPath, "ItemDamageRanged.dbc");                                             // 17399
+    LoadDBC(loader, context, sItemDamageThrownStore,       dbcPath, "ItemDamageThrown.dbc");                                             // 17399
+    LoadDBC(loader, context, sItemDamageTwoHandStore,      dbcPath, "ItemDamageTwoHand.dbc");                                            // 17399
+    LoadDBC(loader, context, sItemDamageTwoHandCasterStore,dbcPath, "ItemDamageTwoHandCaster.dbc");                                      // 17399
+    LoadDBC(loader, context, sItemDamageWandStore,         dbcPath, "ItemDamageWand.dbc");                                               // 17399
+    LoadDBC(loader, context, sItemDisenchantLootStore,     dbcPath, "ItemDisenchantLoot.dbc");
+    LoadDBC(loader, context, sLFGDungeonStore,             dbcPath, "LfgDungeons.dbc");                                                  // 17399
+    LoadDBC(loader, context, sLiquidTypeStore,             dbcPath, "LiquidType.dbc");                                                   // 17399
+    LoadDBC(loader, context, sLockStore,                   dbcPath, "Lock.dbc");                                                         // 17399
+    LoadDBC(loader, context, sPhaseStores,                 dbcPath, "Phase.dbc");                                                        // 17399
+    LoadDBC(loader, context, sMailTemplateStore,           dbcPath, "MailTemplate.dbc");                                                 // 17399
+    LoadDBC(loader, context, sMapStore,                    dbcPath, "Map.dbc");                                                          // 17399
+    LoadDBC(loader, context, sMapDifficultyStore,          dbcPath, "MapDifficulty.dbc");                                                // 17399
+    LoadDBC(loader, context, sMountCapabilityStore,        dbcPath, "MountCapability.dbc");                                              // 17399
+    LoadDBC(loader, context, sMountTypeStore,              dbcPath, "MountType.dbc");                                                    // 17399
+    LoadDBC(loader, context, sNameGenStore,                dbcPath, "NameGen.dbc");                                                      // 17399
+    LoadDBC(loader, context, sMovieStore,                  dbcPath, "Movie.dbc");                                                        // 17399
+    LoadDBC(loader, context, sOverrideSpellDataStore,      dbcPath, "OverrideSpellData.dbc");                                            // 17399
+    LoadDBC(loader, context, sPvPDifficultyStore,          dbcPath, "PvpDifficulty.dbc");                                                // 17399
+    LoadDBC(loader, context, sQuestXPStore,                dbcPath, "QuestXP.dbc");                                                      // 17399
+    LoadDBC(loader, context, sQuestFactionRewardStore,     dbcPath, "QuestFactionReward.dbc");                                           // 17399
+    LoadDBC(loader, context, sQuestSortStore,              dbcPath, "QuestSort.dbc");                                                    // 17399
+    LoadDBC(loader, context, sQuestPOIBlobStore,           dbcPath, "QuestPOIBlob.dbc");                                                 // 17399
+    LoadDBC(loader, context, sQuestPOIPointStore,          dbcPath, "QuestPOIPoint.dbc");                                                // 17399
+    LoadDBC(loader, context, sRandomPropertiesPointsStore, dbcPath, "RandPropPoints.dbc");                                               // 17399
+    LoadDBC(loader, context, sResearchBranchStore,         dbcPath, "ResearchBranch.dbc");                                               // 17399
+    LoadDBC(loader, context, sResearchProjectStore,        dbcPath, "ResearchProject.dbc");                                              // 17399
+    LoadDBC(loader, context, sResearchSiteStore,        dbcPath, "ResearchSite.dbc");                                                    // 17399
+    LoadDBC(loader, context, sScalingStatDistributionStore,dbcPath, "ScalingStatDistribution.dbc");                                      // 17399
+    LoadDBC(loader, context, sScalingStatValuesStore,      dbcPath, "ScalingStatValues.dbc");                                            // 17399
+    LoadDBC(loader, context, sSkillLineStore,              dbcPath, "SkillLine.dbc");                                                    // 17399
+    LoadDBC(loader, context, sSkillLineAbilityStore,       dbcPath, "SkillLineAbility.dbc");                                             // 17399
+    LoadDBC(loader, context, sSoundEntriesStore,           dbcPath, "SoundEntries.dbc");                                                 // 17399
+    LoadDBC(loader, context, sSpecializationSpellStore,    dbcPath, "SpecializationSpells.dbc");
+    LoadDBC(loader, context, sSpellStore,                  dbcPath, "Spell.dbc"/*, &CustomSpellEntryfmt, &CustomSpellEntryIndex*/);      // 17399
+    LoadDBC(loader, context, sSpellMiscStore,              dbcPath, "SpellMisc.dbc");                                                    // 17399
+    LoadDBC(loader, context, sSpellScalingStore,           dbcPath,"SpellScaling.dbc");                                                  // 17399
+    LoadDBC(loader, context, sSpellTotemsStore,            dbcPath,"SpellTotems.dbc");                                                   // 17399
+    LoadDBC(loader, context, sSpellTargetRestrictionsStore,dbcPath,"SpellTargetRestrictions.dbc");                                       // 17399
+    LoadDBC(loader, context, sSpellPowerStore,             dbcPath,"SpellPower.dbc");                                                    // 17399
+    LoadDBC(loader, context, sSpellLevelsStore,            dbcPath,"SpellLevels.dbc");                                                   // 17399
+    LoadDBC(loader, context, sSpellInterruptsStore,        dbcPath,"SpellInterrupts.dbc");                                               // 17399
+    LoadDBC(loader, context, sSpellEquippedItemsStore,     dbcPath,"SpellEquippedItems.dbc");                                            // 17399
+    LoadDBC(loader, context, sSpellClassOptionsStore,      dbcPath,"SpellClassOptions.dbc");                                             // 17399
+    LoadDBC(loader, context, sSpellCooldownsStore,         dbcPath,"SpellCooldowns.dbc");                                                // 17399
+    LoadDBC(loader, context, sSpellAuraOptionsStore,       dbcPath,"SpellAuraOptions.dbc");                                              // 17399
+    LoadDBC(loader, context, sSpellProcsPerMinuteStore,    dbcPath,"SpellProcsPerMinute.dbc");                                           // 17399
+    LoadDBC(loader, context, sSpellAuraRestrictionsStore,  dbcPath,"SpellAuraRestrictions.dbc");                                         // 17399
+    LoadDBC(loader, context, sSpellCastingRequirementsStore, dbcPath,"SpellCastingRequirements.dbc");                                    // 17399
+    LoadDBC(loader, context, sSpellCategoriesStore,        dbcPath,"SpellCategories.dbc");                                               // 17399
+    LoadDBC(loader, context, sSpellCategoryStores,         dbcPath,"SpellCategory.dbc");                                                 // 17399
+    LoadDBC(loader, context, sSpellEffectStore,            dbcPath,"SpellEffect.dbc");                                                   // 17399
+    LoadDBC(loader, context, sSpellEffectScalingStore,     dbcPath,"SpellEffectScaling.dbc");                                            // 17399
+    LoadDBC(loader, context, sSpellCastTimesStore,         dbcPath, "SpellCastTimes.dbc");                                               // 17399
+    LoadDBC(loader, context, sSpellDurationStore,          dbcPath, "SpellDuration.dbc");                                                // 17399
+    LoadDBC(loader, context, sSpellFocusObjectStore,       dbcPath, "SpellFocusObject.dbc");                                             // 17399
+    LoadDBC(loader, context, sSpellItemEnchantmentStore,   dbcPath, "SpellItemEnchantment.dbc");                                         // 17399
+    LoadDBC(loader, context, sSpellItemEnchantmentConditionStore, dbcPath, "SpellItemEnchantmentCondition.dbc");                         // 17399
+    LoadDBC(loader, context, sSpellRadiusStore,            dbcPath, "SpellRadius.dbc");                                                  // 17399
+    LoadDBC(loader, context, sSpellRangeStore,             dbcPath, "SpellRange.dbc");                                                   // 17399
+    LoadDBC(loader, context, sSpellRuneCostStore,          dbcPath, "SpellRuneCost.dbc");                                                // 17399
+    LoadDBC(loader, context, sSpellShapeshiftStore,        dbcPath, "SpellShapeshift.dbc");                                              // 17399
+    LoadDBC(loader, context, sSpellShapeshiftFormStore,    dbcPath, "SpellShapeshiftForm.dbc");                                          // 17399
+    LoadDBC(loader, context, sSummonPropertiesStore,       dbcPath, "SummonProperties.dbc");                                             // 17399
+    LoadDBC(loader, context, sTalentStore,                 dbcPath, "Talent.dbc");                                                       // 17399
+    LoadDBC(loader, context, sTaxiNodesStore,              dbcPath, "TaxiNodes.dbc");                                                    // 17399
+    LoadDBC(loader, context, sTaxiPathStore,               dbcPath, "TaxiPath.dbc");                                                     // 17399
+    LoadDBC(loader, context, sTaxiPathNodeStore,           dbcPath, "TaxiPathNode.dbc");                                                 // 17399
+    LoadDBC(loader, context, sTotemCategoryStore,          dbcPath, "TotemCategory.dbc");                                                // 17399
+    LoadDBC(loader, context, sTransportAnimationStore,     dbcPath, "TransportAnimation.dbc");                                           // 17399
+    LoadDBC(loader, context, sUnitPowerBarStore,           dbcPath, "UnitPowerBar.dbc");                                                 // 17399
+    LoadDBC(loader, context, sVehicleStore,                dbcPath, "Vehicle.dbc");                                                      // 17399
+    LoadDBC(loader, context, sVehicleSeatStore,            dbcPath, "VehicleSeat.dbc");                                                  // 17399
+    LoadDBC(loader, context, sWMOAreaTableStore,           dbcPath, "WMOAreaTable.dbc");                                                 // 17399
+    LoadDBC(loader, context, sWorldMapAreaStore,           dbcPath, "WorldMapArea.dbc");                                                 // 17399
+    LoadDBC(loader, context, sWorldMapOverlayStore,        dbcPath, "WorldMapOverlay.dbc");                                              // 17399
+    LoadDBC(loader, context, sWorldSafeLocsStore,          dbcPath, "WorldSafeLocs.dbc");                                                // 17399
+
+    loader.Load(threads);
 
     // Must be after sAreaStore loading
     for (uint32 i = 0; i < sAreaStore.GetNumRows(); ++i)           // Areaflag numbered from 0
@@ -344,23 +542,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAchievementStore,            dbcPath, "Achievement.dbc", &CustomAchievementfmt, &CustomAchievementIndex);  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAchievementCriteriaStore,    dbcPath, "Achievement_Criteria.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaTriggerStore,            dbcPath, "AreaTrigger.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaGroupStore,              dbcPath, "AreaGroup.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaPOIStore,                dbcPath, "AreaPOI.dbc");                                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAuctionHouseStore,           dbcPath, "AuctionHouse.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sArmorLocationStore,          dbcPath, "ArmorLocation.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBankBagSlotPricesStore,      dbcPath, "BankBagSlotPrices.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBattlemasterListStore,       dbcPath, "BattleMasterList.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBarberShopStyleStore,        dbcPath, "BarberShopStyle.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharStartOutfitStore,        dbcPath, "CharStartOutfit.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharTitlesStore,             dbcPath, "CharTitles.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChatChannelsStore,           dbcPath, "ChatChannels.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrClassesStore,             dbcPath, "ChrClasses.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrRacesStore,               dbcPath, "ChrRaces.dbc");                                                     // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrPowerTypesStore,          dbcPath, "ChrClassesXPowerTypes.dbc");                                        // 17399
-
     for (uint32 i = 0; i < MAX_CLASSES; ++i)
         for (uint32 j = 0; j < MAX_POWERS; ++j)
             PowersByClass[i][j] = INVALID_POWER_INDEX;
@@ -379,21 +560,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrSpecializationsStore,     dbcPath, "ChrSpecialization.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCinematicSequencesStore,     dbcPath, "CinematicSequences.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureDisplayInfoStore,    dbcPath, "CreatureDisplayInfo.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureFamilyStore,         dbcPath, "CreatureFamily.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureModelDataStore,      dbcPath, "CreatureModelData.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureSpellDataStore,      dbcPath, "CreatureSpellData.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureTypeStore,           dbcPath, "CreatureType.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCurrencyTypesStore,          dbcPath, "CurrencyTypes.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDestructibleModelDataStore,  dbcPath, "DestructibleModelData.dbc");                                        // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDungeonEncounterStore,       dbcPath, "DungeonEncounter.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDurabilityCostsStore,        dbcPath, "DurabilityCosts.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDurabilityQualityStore,      dbcPath, "DurabilityQuality.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesStore,                 dbcPath, "Emotes.dbc");                                                       // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesTextStore,             dbcPath, "EmotesText.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sFactionStore,                dbcPath, "Faction.dbc");                                                      // 17399
     for (uint32 i=0; i < sFactionStore.GetNumRows(); ++i)
     {
         FactionEntry const* faction = sFactionStore.LookupEntry(i);
@@ -404,8 +570,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sFactionTemplateStore,        dbcPath, "FactionTemplate.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGameObjectDisplayInfoStore,  dbcPath, "GameObjectDisplayInfo.dbc");                                        // 17399
     for (uint32 i = 0; i < sGameObjectDisplayInfoStore.GetNumRows(); ++i)
     {
         if (GameObjectDisplayInfoEntry const* info = sGameObjectDisplayInfoStore.LookupEntry(i))
@@ -419,62 +583,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGemPropertiesStore,          dbcPath, "GemProperties.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGlyphPropertiesStore,        dbcPath, "GlyphProperties.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGlyphSlotStore,              dbcPath, "GlyphSlot.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtBarberShopCostBaseStore,   dbcPath, "gtBarberShopCostBase.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtCombatRatingsStore,        dbcPath, "gtCombatRatings.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToMeleeCritBaseStore,dbcPath, "gtChanceToMeleeCritBase.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToMeleeCritStore,    dbcPath, "gtChanceToMeleeCrit.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToSpellCritBaseStore,dbcPath, "gtChanceToSpellCritBase.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToSpellCritStore,    dbcPath, "gtChanceToSpellCrit.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTClassCombatRatingScalarStore,    dbcPath, "gtOCTClassCombatRatingScalar.dbc");                        // 17399
-    //LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTRegenHPStore,           dbcPath, "gtOCTRegenHP.dbc");                                               // Not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTHpPerStaminaStore,      dbcPath, "gtOCTHpPerStamina.dbc");                                            //17399
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sGtOCTRegenMPStore,           dbcPath, "gtOCTRegenMP.dbc");                                     // Not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtRegenMPPerSptStore,        dbcPath, "gtRegenMPPerSpt.dbc");                                              //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtSpellScalingStore,         dbcPath, "gtSpellScaling.dbc");                                               //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTBaseHPByClassStore,     dbcPath, "gtOCTBaseHPByClass.dbc");                                           //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTBaseMPByClassStore,     dbcPath, "gtOCTBaseMPByClass.dbc");                                           //17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGuildPerkSpellsStore,        dbcPath, "GuildPerkSpells.dbc");                                              //17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sHolidaysStore,               dbcPath, "Holidays.dbc");                                                     // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceArmorStore,       dbcPath, "ImportPriceArmor.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceQualityStore,     dbcPath, "ImportPriceQuality.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceShieldStore,      dbcPath, "ImportPriceShield.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sImportPriceWeaponStore,      dbcPath, "ImportPriceWeapon.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemPriceBaseStore,          dbcPath, "ItemPriceBase.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemReforgeStore,            dbcPath, "ItemReforge.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemBagFamilyStore,          dbcPath, "ItemBagFamily.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemClassStore,              dbcPath, "ItemClass.dbc");                                                    // 17399
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sItemDisplayInfoStore,        dbcPath, "ItemDisplayInfo.dbc");                                  // Not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemLimitCategoryStore,      dbcPath, "ItemLimitCategory.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemRandomPropertiesStore,   dbcPath, "ItemRandomProperties.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemRandomSuffixStore,       dbcPath, "ItemRandomSuffix.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemSetStore,                dbcPath, "ItemSet.dbc");                                                      // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemArmorQualityStore,       dbcPath, "ItemArmorQuality.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemArmorShieldStore,        dbcPath, "ItemArmorShield.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemArmorTotalStore,         dbcPath, "ItemArmorTotal.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageAmmoStore,         dbcPath, "ItemDamageAmmo.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageOneHandStore,      dbcPath, "ItemDamageOneHand.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageOneHandCasterStore,dbcPath, "ItemDamageOneHandCaster.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageRangedStore,       dbcPath, "ItemDamageRanged.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageThrownStore,       dbcPath, "ItemDamageThrown.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageTwoHandStore,      dbcPath, "ItemDamageTwoHand.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageTwoHandCasterStore,dbcPath, "ItemDamageTwoHandCaster.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDamageWandStore,         dbcPath, "ItemDamageWand.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemDisenchantLootStore,     dbcPath, "ItemDisenchantLoot.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLFGDungeonStore,             dbcPath, "LfgDungeons.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLiquidTypeStore,             dbcPath, "LiquidType.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLockStore,                   dbcPath, "Lock.dbc");                                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sPhaseStores,                 dbcPath, "Phase.dbc");                                                        // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMailTemplateStore,           dbcPath, "MailTemplate.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMapStore,                    dbcPath, "Map.dbc");                                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMapDifficultyStore,          dbcPath, "MapDifficulty.dbc");                                                // 17399
-
     // Fill Map Difficulty data.
     sMapDifficultyMap[MAKE_PAIR32(0, 0)] = MapDifficulty(0, 0, false);                                                                                      // Map 0 is missingg from MapDifficulty.dbc use this till its ported to sql
     for (uint32 i = 0; i < sMapDifficultyStore.GetNumRows(); ++i)
@@ -482,37 +590,16 @@ void LoadDBCStores(const std::string& dataPath)
             sMapDifficultyMap[MAKE_PAIR32(entry->MapId, entry->Difficulty)] = MapDifficulty(entry->resetTime, entry->maxPlayers, entry->areaTriggerText[0] > 0);
     sMapDifficultyStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMountCapabilityStore,        dbcPath, "MountCapability.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMountTypeStore,              dbcPath, "MountType.dbc");                                                    // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sNameGenStore,                dbcPath, "NameGen.dbc");                                                      // 17399
     for (uint32 i = 0; i < sNameGenStore.GetNumRows(); ++i)
         if (NameGenEntry const* entry = sNameGenStore.LookupEntry(i))
             sGenNameVectoArraysMap[entry->race].stringVectorArray[entry->gender].push_back(std::string(entry->name));
     sNameGenStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMovieStore,                  dbcPath, "Movie.dbc");                                                        // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sOverrideSpellDataStore,      dbcPath, "OverrideSpellData.dbc");                                            // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sPvPDifficultyStore,          dbcPath, "PvpDifficulty.dbc");                                                // 17399
     for (uint32 i = 0; i < sPvPDifficultyStore.GetNumRows(); ++i)
         if (PvPDifficultyEntry const* entry = sPvPDifficultyStore.LookupEntry(i))
             if (entry->bracketId > MAX_BATTLEGROUND_BRACKETS)
                 ASSERT(false && "Need update MAX_BATTLEGROUND_BRACKETS by DBC data");
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestXPStore,                dbcPath, "QuestXP.dbc");                                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestFactionRewardStore,     dbcPath, "QuestFactionReward.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestSortStore,              dbcPath, "QuestSort.dbc");                                                    // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestPOIBlobStore,           dbcPath, "QuestPOIBlob.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestPOIPointStore,          dbcPath, "QuestPOIPoint.dbc");                                                // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sRandomPropertiesPointsStore, dbcPath, "RandPropPoints.dbc");                                               // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sResearchBranchStore,         dbcPath, "ResearchBranch.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sResearchProjectStore,        dbcPath, "ResearchProject.dbc");                                              // 17399
-
     for (uint32 i =0; i < sResearchProjectStore.GetNumRows(); ++i)
     {
         ResearchProjectEntry const* rp = sResearchProjectStore.LookupEntry(i);
@@ -524,8 +611,6 @@ void LoadDBCStores(const std::string& dataPath)
     }
     //sResearchProjectStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sResearchSiteStore,        dbcPath, "ResearchSite.dbc");                                                    // 17399
-
     for (uint32 i = 0; i < sResearchSiteStore.GetNumRows(); ++i)
     {
         ResearchSiteEntry const* rs = sResearchSiteStore.LookupEntry(i);
@@ -544,15 +629,6 @@ void LoadDBCStores(const std::string& dataPath)
     }
     //sResearchSiteStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sScalingStatDistributionStore,dbcPath, "ScalingStatDistribution.dbc");                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sScalingStatValuesStore,      dbcPath, "ScalingStatValues.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillLineStore,              dbcPath, "SkillLine.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillLineAbilityStore,       dbcPath, "SkillLineAbility.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSoundEntriesStore,           dbcPath, "SoundEntries.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpecializationSpellStore,    dbcPath, "SpecializationSpells.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellStore,                  dbcPath, "Spell.dbc"/*, &CustomSpellEntryfmt, &CustomSpellEntryIndex*/);      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellMiscStore,              dbcPath, "SpellMisc.dbc");                                                    // 17399
-
     for (uint32 i = 1; i < sSpellStore.GetNumRows(); ++i)
     {
         SpellCategoriesEntry const* spell = sSpellCategoriesStore.LookupEntry(i);
@@ -594,24 +670,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellScalingStore,           dbcPath,"SpellScaling.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellTotemsStore,            dbcPath,"SpellTotems.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellTargetRestrictionsStore,dbcPath,"SpellTargetRestrictions.dbc");                                       // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellPowerStore,             dbcPath,"SpellPower.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellLevelsStore,            dbcPath,"SpellLevels.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellInterruptsStore,        dbcPath,"SpellInterrupts.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellEquippedItemsStore,     dbcPath,"SpellEquippedItems.dbc");                                            // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellClassOptionsStore,      dbcPath,"SpellClassOptions.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCooldownsStore,         dbcPath,"SpellCooldowns.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellAuraOptionsStore,       dbcPath,"SpellAuraOptions.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellProcsPerMinuteStore,    dbcPath,"SpellProcsPerMinute.dbc");                                           // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellAuraRestrictionsStore,  dbcPath,"SpellAuraRestrictions.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCastingRequirementsStore, dbcPath,"SpellCastingRequirements.dbc");                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCategoriesStore,        dbcPath,"SpellCategories.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCategoryStores,         dbcPath,"SpellCategory.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellEffectStore,            dbcPath,"SpellEffect.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellEffectScalingStore,     dbcPath,"SpellEffectScaling.dbc");                                            // 17399
-
     for (uint32 i = 1; i < sSpellEffectStore.GetNumRows(); ++i)
     {
         if (SpellEffectEntry const *spellEffect = sSpellEffectStore.LookupEntry(i))
@@ -628,18 +686,6 @@ void LoadDBCStores(const std::string& dataPath)
                     sSpellSkillingList.push_back(spell);
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCastTimesStore,         dbcPath, "SpellCastTimes.dbc");                                               // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellDurationStore,          dbcPath, "SpellDuration.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellFocusObjectStore,       dbcPath, "SpellFocusObject.dbc");                                             // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellItemEnchantmentStore,   dbcPath, "SpellItemEnchantment.dbc");                                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellItemEnchantmentConditionStore, dbcPath, "SpellItemEnchantmentCondition.dbc");                         // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRadiusStore,            dbcPath, "SpellRadius.dbc");                                                  // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRangeStore,             dbcPath, "SpellRange.dbc");                                                   // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRuneCostStore,          dbcPath, "SpellRuneCost.dbc");                                                // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellShapeshiftStore,        dbcPath, "SpellShapeshift.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellShapeshiftFormStore,    dbcPath, "SpellShapeshiftForm.dbc");                                          // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSummonPropertiesStore,       dbcPath, "SummonProperties.dbc");                                             // 17399
-
     // Since MOP, we count 7 entries with slot = -1, we must set them at 0, if not, crash !
     for (uint32 i = 0; i < sSummonPropertiesStore.GetNumRows(); ++i)
     {
@@ -650,16 +696,12 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTalentStore,                 dbcPath, "Talent.dbc");                                                       // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiNodesStore,              dbcPath, "TaxiNodes.dbc");                                                    // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiPathStore,               dbcPath, "TaxiPath.dbc");                                                     // 17399
     for (uint32 i = 1; i < sTaxiPathStore.GetNumRows(); ++i)
         if (TaxiPathEntry const* entry = sTaxiPathStore.LookupEntry(i))
             sTaxiPathSetBySource[entry->from][entry->to] = TaxiPathBySourceAndDestination(entry->ID, entry->price);
     uint32 pathCount = sTaxiPathStore.GetNumRows();
 
     //## TaxiPathNode.dbc ## Loaded only for initialization different structures
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiPathNodeStore,           dbcPath, "TaxiPathNode.dbc");                                                 // 17399
     // Calculate path nodes count
     std::vector<uint32> pathLength;
     pathLength.resize(pathCount);                           // 0 and some other indexes not used
@@ -737,40 +779,28 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTotemCategoryStore,          dbcPath, "TotemCategory.dbc");                                                // 17399
-
     // Load GameObject Transports
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTransportAnimationStore,     dbcPath, "TransportAnimation.dbc");                                           // 17399
     for (uint32 i = 0; i < sTransportAnimationStore.GetNumRows(); ++i)
         if (TransportAnimationEntry const* anim = sTransportAnimationStore.LookupEntry(i))
             sTransportAnimationsByEntry[anim->TransportEntry][anim->TimeSeg] = anim;
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sUnitPowerBarStore,           dbcPath, "UnitPowerBar.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sVehicleStore,                dbcPath, "Vehicle.dbc");                                                      // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sVehicleSeatStore,            dbcPath, "VehicleSeat.dbc");                                                  // 17399
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWMOAreaTableStore,           dbcPath, "WMOAreaTable.dbc");                                                 // 17399
     for (uint32 i = 0; i < sWMOAreaTableStore.GetNumRows(); ++i)
         if (WMOAreaTableEntry const* entry = sWMOAreaTableStore.LookupEntry(i))
             sWMOAreaInfoByTripple.insert(WMOAreaInfoByTripple::value_type(WMOAreaTableTripple(entry->rootId, entry->adtId, entry->groupId), entry));
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldMapAreaStore,           dbcPath, "WorldMapArea.dbc");                                                 // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldMapOverlayStore,        dbcPath, "WorldMapOverlay.dbc");                                              // 17399
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldSafeLocsStore,          dbcPath, "WorldSafeLocs.dbc");                                                // 17399
-
     // error checks
-    if (bad_dbc_files.size() >= DBCFileCount)
+    if (context.errors.size() >= DBCFileCount)
     {
         sLog->outError(LOG_FILTER_GENERAL, "Incorrect DataDir value in worldserver.conf or ALL required *.dbc files (%d) not found by path: %sdbc", DBCFileCount, dataPath.c_str());
         exit(1);
     }
-    else if (!bad_dbc_files.empty())
+    else if (!context.errors.empty())
     {
         std::string str;
-        for (StoreProblemList::iterator i = bad_dbc_files.begin(); i != bad_dbc_files.end(); ++i)
+        for (StoreProblemList::iterator i = context.errors.begin(); i != context.errors.end(); ++i)
             str += *i + "\n";
 
-        sLog->outError(LOG_FILTER_GENERAL, "Some required *.dbc files (%u from %d) not found or not compatible:\n%s", (uint32)bad_dbc_files.size(), DBCFileCount, str.c_str());
+        sLog->outError(LOG_FILTER_GENERAL, "Some required *.dbc files (%u from %d) not found or not compatible:\n%s", (uint32)context.errors.size(), DBCFileCount, str.c_str());
         exit(1);
     }
 
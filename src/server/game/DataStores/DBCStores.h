@@ -239,6 +239,7 @@ extern DBCStorage <WorldMapAreaEntry>            sWorldMapAreaStore; //-- use Zo
 extern DBCStorage <WorldMapOverlayEntry>         sWorldMapOverlayStore;
 extern DBCStorage <WorldSafeLocsEntry>           sWorldSafeLocsStore;
 
-void LoadDBCStores(const std::string& dataPath);
+// threads reading the files, 0 for one per processor
+void LoadDBCStores(const std::string& dataPath, uint32 threads);
 
 #endif
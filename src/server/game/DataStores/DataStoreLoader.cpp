@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DataStoreLoader.h"
+#include "Log.h"
+#include "Common.h"
+
+#include <ace/Guard_T.h>
+#include <ace/OS_NS_unistd.h>
+
+#include <algorithm>
+
+DataStoreLoader::DataStoreLoader() : m_next(0)
+{
+}
+
+DataStoreLoader::~DataStoreLoader()
+{
+    for (std::vector<DataStoreLoadJob*>::iterator itr = m_jobs.begin(); itr != m_jobs.end(); ++itr)
+        delete *itr;
+}
+
+void DataStoreLoader::Load(uint32 threads)
+{
+    if (!threads)
+        threads = uint32(std::max(ACE_OS::num_processors(), long(1)));
+
+    if (threads > m_jobs.size())
+        threads = uint32(m_jobs.size());
+
+    m_next = 0;
+
+    if (threads > 1)
+    {
+        if (activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(threads)) != -1)
+        {
+            wait();
+            return;
+        }
+
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "DataStoreLoader: can't start %u threads, loading the stores serially.", threads);
+    }
+
+    svc();
+}
+
+DataStoreLoadJob* DataStoreLoader::Next()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    if (m_next >= m_jobs.size())
+        return NULL;
+
+    return m_jobs[m_next++];
+}
+
+int DataStoreLoader::svc()
+{
+    while (DataStoreLoadJob* job = Next())
+        job->Load();
+
+    return 0;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATASTORE_LOADER_H_INCLUDED
+#define _DATASTORE_LOADER_H_INCLUDED
+
+#include <ace/Task.h>
+#include <ace/Thread_Mutex.h>
+
+#include "Define.h"
+
+#include <vector>
+
+// One store file to read, the jobs of a DataStoreLoader touch distinct stores
+class DataStoreLoadJob
+{
+    public:
+        virtual ~DataStoreLoadJob() { }
+
+        virtual void Load() = 0;
+};
+
+/*
+ * Startup worker pool reading the DBC and DB2 files concurrently. The stores
+ * are queued first, then Load() returns once every file is read; the data
+ * built from several stores is filled afterwards by the calling thread.
+ */
+class DataStoreLoader : protected ACE_Task_Base
+{
+    public:
+
+        DataStoreLoader();
+        virtual ~DataStoreLoader();
+
+        // takes ownership of the job
+        void Queue(DataStoreLoadJob* job) { m_jobs.push_back(job); }
+
+        // 0 threads: one per processor, 1: the calling thread reads every file
+        void Load(uint32 threads);
+
+        virtual int svc();
+
+    private:
+
+        DataStoreLoadJob* Next();
+
+        ACE_Thread_Mutex m_lock;
+        std::vector<DataStoreLoadJob*> m_jobs;
+        size_t m_next;                                      // first job not taken by a worker
+};
+
+#endif //_DATASTORE_LOADER_H_INCLUDED
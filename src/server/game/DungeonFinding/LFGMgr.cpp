@@ -32,6 +32,49 @@
 #include "Group.h"
 #include "Player.h"
 
+LfgGuidTuple::LfgGuidTuple(uint64 const* _guids, uint8 _size, LfgType _type): size(_size), type(_type)
+{
+    ASSERT(size <= LFG_MAX_MATCH_QUEUES);
+    std::copy(_guids, _guids + size, guids);
+    std::sort(guids, guids + size);
+}
+
+bool LfgGuidTuple::operator==(LfgGuidTuple const& other) const
+{
+    return size == other.size && type == other.type && std::equal(guids, guids + size, other.guids);
+}
+
+bool LfgGuidTuple::Contains(uint64 guid) const
+{
+    return std::binary_search(guids, guids + size, guid);
+}
+
+uint64 LfgGuidTuple::Hash() const
+{
+    // FNV-1a over the type and the guids
+    uint64 hash = UI64LIT(14695981039346656037);
+    hash = (hash ^ uint64(type)) * UI64LIT(1099511628211);
+    for (uint8 i = 0; i < size; ++i)
+        hash = (hash ^ guids[i]) * UI64LIT(1099511628211);
+    return hash;
+}
+
+static bool HasCommonDungeon(LfgDungeonSet const& first, LfgDungeonSet const& second)
+{
+    LfgDungeonSet::const_iterator itFirst = first.begin();
+    LfgDungeonSet::const_iterator itSecond = second.begin();
+    while (itFirst != first.end() && itSecond != second.end())
+    {
+        if (*itFirst < *itSecond)
+            ++itFirst;
+        else if (*itSecond < *itFirst)
+            ++itSecond;
+        else
+            return true;
+    }
+    return false;
+}
+
 LFGMgr::LFGMgr(): m_update(true), m_QueueTimer(0), m_lfgProposalId(1),
 m_WaitTimeAvg(-1), m_WaitTimeTank(-1), m_WaitTimeHealer(-1), m_WaitTimeDps(-1),
 m_NumWaitTimeAvg(0), m_NumWaitTimeTank(0), m_NumWaitTimeHealer(0), m_NumWaitTimeDps(0)
@@ -286,12 +329,11 @@ void LFGMgr::Update(uint32 diff)
         while (!newToQueue.empty())
         {
             uint64 frontguid = newToQueue.front();
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Update: QueueId %u: checking [" UI64FMTD "] newToQueue(%u), currentQueue(%u)", queueId, frontguid, uint32(newToQueue.size()), uint32(currentQueue.size()));
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::Update: QueueId %u: checking [" UI64FMTD "] newToQueue(%u), currentQueue(%u)", queueId, frontguid, uint32(newToQueue.size()), uint32(currentQueue.size()));
             firstNew.push_back(frontguid);
             newToQueue.pop_front();
             uint8 alreadyInQueue = 0;
-            LfgGuidList temporalList = currentQueue;
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, TYPEID_DUNGEON)) // Group found!
+            if (LfgProposal* pProposal = FindNewGroups(firstNew, currentQueue, TYPEID_DUNGEON)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
@@ -328,11 +370,10 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-                m_CompatibleMap.clear();
+                ClearCompatibles();
             }
 
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_SUBTYPEID_RAID)) // Group found!
+            if (LfgProposal* pProposal = FindNewGroups(firstNew, currentQueue, LFG_SUBTYPEID_RAID)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
@@ -369,11 +410,10 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
-                m_CompatibleMap.clear();
+                ClearCompatibles();
             }
 
-            if (LfgProposal* pProposal = FindNewGroups(firstNew, temporalList, LFG_SUBTYPEID_SCENARIO)) // Group found!
+            if (LfgProposal* pProposal = FindNewGroups(firstNew, currentQueue, LFG_SUBTYPEID_SCENARIO)) // Group found!
             {
                 // Remove groups in the proposal from new and current queues (not from queue map)
                 for (LfgGuidList::const_iterator itQueue = pProposal->queues.begin(); itQueue != pProposal->queues.end(); ++itQueue)
@@ -410,7 +450,7 @@ void LFGMgr::Update(uint32 diff)
             {
                 if (std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end()) //already in queue?
                     ++alreadyInQueue; //currentQueue.push_back(frontguid);         // Lfg group not found, add this group to the queue.
-                temporalList = currentQueue;
+                ClearCompatibles();
             }
 
             if (alreadyInQueue == 3 && std::find(currentQueue.begin(), currentQueue.end(), frontguid) == currentQueue.end())
@@ -485,13 +525,16 @@ void LFGMgr::AddToQueue(uint64 guid, uint8 queueId)
     if (sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP))
         queueId = 0;
 
+    // roles and dungeons may have changed since it was last queued
+    RemoveFromCompatibles(guid);
+
     LfgGuidList& list = m_newToQueue[queueId];
     if (std::find(list.begin(), list.end(), guid) != list.end())
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::AddToQueue: [" UI64FMTD "] already in new queue. ignoring", guid);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::AddToQueue: [" UI64FMTD "] already in new queue. ignoring", guid);
     else
     {
         list.push_back(guid);
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::AddToQueue: [" UI64FMTD "] added to m_newToQueue (size: %u)", guid, uint32(list.size()));
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::AddToQueue: [" UI64FMTD "] added to m_newToQueue (size: %u)", guid, uint32(list.size()));
     }
 }
 
@@ -516,12 +559,12 @@ bool LFGMgr::RemoveFromQueue(uint64 guid)
     {
         delete it->second;
         m_QueueInfoMap.erase(it);
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveFromQueue: [" UI64FMTD "] removed", guid);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveFromQueue: [" UI64FMTD "] removed", guid);
         return true;
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveFromQueue: [" UI64FMTD "] not in queue", guid);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveFromQueue: [" UI64FMTD "] not in queue", guid);
         return false;
     }
 
@@ -787,7 +830,7 @@ void LFGMgr::Join(Player* player, uint8 roles, const LfgDungeonSet& selectedDung
     // Can't join. Send result
     if (joinData.result != LFG_JOIN_OK)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Join: [" UI64FMTD "] joining with %u members. result: %u", guid, grp ? grp->GetMembersCount() : 1, joinData.result);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::Join: [" UI64FMTD "] joining with %u members. result: %u", guid, grp ? grp->GetMembersCount() : 1, joinData.result);
         if (!dungeons.empty())                             // Only should show lockmap when have no dungeons available
             joinData.lockmap.clear();
         player->GetSession()->SendLfgJoinResult(player->GetGUID(), joinData);
@@ -797,7 +840,7 @@ void LFGMgr::Join(Player* player, uint8 roles, const LfgDungeonSet& selectedDung
     // FIXME - Raid browser not supported yet
     if (isRaid)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Join: [" UI64FMTD "] trying to join raid browser and it's disabled.", guid);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::Join: [" UI64FMTD "] trying to join raid browser and it's disabled.", guid);
         return;
     }
 
@@ -880,7 +923,7 @@ void LFGMgr::Join(Player* player, uint8 roles, const LfgDungeonSet& selectedDung
         }
         AddToQueue(guid, uint8(player->GetTeam()));
     }
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Join: [" UI64FMTD "] joined with %u members. dungeons: %u", guid, grp ? grp->GetMembersCount() : 1, uint8(dungeons.size()));
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::Join: [" UI64FMTD "] joined with %u members. dungeons: %u", guid, grp ? grp->GetMembersCount() : 1, uint8(dungeons.size()));
 }
 
 /**
@@ -898,7 +941,7 @@ void LFGMgr::Leave(Player* player, Group* grp /* = NULL*/)
     uint64 guid = grp ? grp->GetGUID() : player->GetGUID();
     LfgState state = GetState(guid);
 
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::Leave: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::Leave: [" UI64FMTD "]", guid);
     switch (state)
     {
         case LFG_STATE_QUEUED:
@@ -981,31 +1024,138 @@ void LFGMgr::OfferContinue(Group* grp)
    @param[in]     all List of all other guids in main queue to match against
    @return Pointer to proposal, if match is found
 */
-LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType type)
+LfgProposal* LFGMgr::FindNewGroups(LfgGuidList const& check, LfgGuidList const& all, LfgType type)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::FindNewGroup: (%s) - all(%s)", ConcatenateGuids(check).c_str(), ConcatenateGuids(all).c_str());
 
-    uint8 maxGroupSize = 5;
-    if (type == LFG_SUBTYPEID_RAID)
-        maxGroupSize = 25;
-    if (type == LFG_SUBTYPEID_SCENARIO)
-        maxGroupSize = 3;
+    uint8 maxGroupSize = GetMaxGroupSize(type);
+    if (check.empty() || check.size() > maxGroupSize)
+        return NULL;
+
+    uint64 guids[LFG_MAX_MATCH_QUEUES];
+    uint8 checkSize = 0;
+    LfgMatchCandidate checkRoles;
+    GetMatchCandidate(0, checkRoles);
+    for (LfgGuidList::const_iterator it = check.begin(); it != check.end(); ++it)
+    {
+        guids[checkSize++] = *it;
 
+        LfgMatchCandidate candidate;
+        if (GetMatchCandidate(*it, candidate))
+        {
+            checkRoles.players += candidate.players;
+            checkRoles.tanks += candidate.tanks;
+            checkRoles.healers += candidate.healers;
+            checkRoles.dps += candidate.dps;
+        }
+    }
+
+    uint8 tanksNeeded, healersNeeded, dpsNeeded;
+    GetNeededRoles(type, tanksNeeded, healersNeeded, dpsNeeded);
+
+    // Only queues sharing a dungeon with the new one and not bringing more single role players than needed can be part of a match
+    LfgQueueInfo const* newInfo = GetLfgQueueInfo(check.front());
+    LfgMatchCandidateList candidates;
+    candidates.reserve(all.size());
+    for (LfgGuidList::const_iterator it = all.begin(); it != all.end(); ++it)
+    {
+        LfgMatchCandidate candidate;
+        if (GetMatchCandidate(*it, candidate))              // Not queued anymore, CheckCompatibility will clean it
+        {
+            if (candidate.players > maxGroupSize || candidate.tanks > tanksNeeded || candidate.healers > healersNeeded || candidate.dps > dpsNeeded)
+                continue;
+
+            if (newInfo && !HasCommonDungeon(newInfo->dungeons, GetLfgQueueInfo(*it)->dungeons))
+                continue;
+        }
+
+        candidates.push_back(candidate);
+    }
+
+    size_t next = 0;
+    return FindNewGroups(guids, checkSize, checkRoles, candidates, next, type);
+}
+
+/**
+   Tries to extend a compatible list of guids with the candidates, in order. The candidates are
+   consumed as the queue was: one tried at any depth is not tried again, so a search costs at
+   most one compatibility check per candidate.
+
+   @param[in, out] check Guids trying to match, room for LFG_MAX_MATCH_QUEUES
+   @param[in]     checkRoles Sum of the players and single role players of check
+   @param[in]     candidates Queued groups to match against
+   @param[in, out] next First candidate not tried yet, shared by all the depths
+   @return Pointer to proposal, if match is found
+*/
+LfgProposal* LFGMgr::FindNewGroups(uint64* check, uint8 checkSize, LfgMatchCandidate const& checkRoles, LfgMatchCandidateList const& candidates, size_t& next, LfgType type)
+{
     LfgProposal* pProposal = NULL;
-    if (check.empty() || check.size() > maxGroupSize || !CheckCompatibility(check, pProposal, type))
+    if (!CheckCompatibility(check, checkSize, pProposal, type))
         return NULL;
 
+    uint8 maxGroupSize = GetMaxGroupSize(type);
+    uint8 tanksNeeded, healersNeeded, dpsNeeded;
+    GetNeededRoles(type, tanksNeeded, healersNeeded, dpsNeeded);
+
     // Try to match with queued groups
-    while (!pProposal && !all.empty())
+    while (!pProposal && checkSize < maxGroupSize && next < candidates.size())
     {
-        check.push_back(all.front());
-        all.pop_front();
-        pProposal = FindNewGroups(check, all, type);
-        check.pop_back();
+        LfgMatchCandidate const& candidate = candidates[next++];
+
+        LfgMatchCandidate roles = checkRoles;
+        roles.players += candidate.players;
+        roles.tanks += candidate.tanks;
+        roles.healers += candidate.healers;
+        roles.dps += candidate.dps;
+        if (roles.players > maxGroupSize || roles.tanks > tanksNeeded || roles.healers > healersNeeded || roles.dps > dpsNeeded)
+            continue;
+
+        check[checkSize] = candidate.guid;
+        pProposal = FindNewGroups(check, checkSize + 1, roles, candidates, next, type);
     }
     return pProposal;
 }
 
+/**
+   Gets the number of players of a queued guid and how many of them can only take one role
+
+   @param[in]     guid Player or group guid
+   @param[out]    candidate Players and single role players of guid, all 0 if not queued
+   @return true if guid is queued
+*/
+bool LFGMgr::GetMatchCandidate(uint64 guid, LfgMatchCandidate& candidate) const
+{
+    candidate.guid = guid;
+    candidate.players = 0;
+    candidate.tanks = 0;
+    candidate.healers = 0;
+    candidate.dps = 0;
+
+    LfgQueueInfo const* queue = GetLfgQueueInfo(guid);
+    if (!queue)
+        return false;
+
+    candidate.players = uint8(queue->roles.size());
+    for (LfgRolesMap::const_iterator it = queue->roles.begin(); it != queue->roles.end(); ++it)
+    {
+        switch (it->second & ~ROLE_LEADER)
+        {
+            case ROLE_TANK:
+                ++candidate.tanks;
+                break;
+            case ROLE_HEALER:
+                ++candidate.healers;
+                break;
+            case ROLE_DAMAGE:
+                ++candidate.dps;
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
 /**
    Check compatibilities between groups
 
@@ -1013,50 +1163,45 @@ LfgProposal* LFGMgr::FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType
    @param[out]    pProposal Proposal found if groups are compatibles and Match
    @return true if group are compatibles
 */
-bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgType type)
+bool LFGMgr::CheckCompatibility(uint64 const* check, uint8 checkSize, LfgProposal*& pProposal, LfgType type)
 {
     if (pProposal)                                         // Do not check anything if we already have a proposal
         return false;
 
-    uint8 maxGroupSize = 5;
-    if (type == LFG_SUBTYPEID_RAID)
-        maxGroupSize = 25;
-    if (type == LFG_SUBTYPEID_SCENARIO)
-        maxGroupSize = 3;
+    uint8 maxGroupSize = GetMaxGroupSize(type);
 
-    std::string strGuids = ConcatenateGuids(check);
+    std::string strGuids;
+    if (sLog->ShouldLog(LOG_FILTER_LFG, LOG_LEVEL_DEBUG))
+        strGuids = ConcatenateGuids(check, checkSize);
 
-    if (check.size() > maxGroupSize || check.empty())
+    if (checkSize > maxGroupSize || !checkSize)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s): Size wrong - Not compatibles", strGuids.c_str());
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s): Size wrong - Not compatibles", strGuids.c_str());
         return false;
     }
 
-    if (check.size() == 1 && IS_PLAYER_GUID(check.front())) // Player joining dungeon... compatible
+    if (checkSize == 1 && IS_PLAYER_GUID(check[0])) // Player joining dungeon... compatible
         return true;
 
     // Previously cached?
-    LfgAnswer answer = GetCompatibles(strGuids);
+    LfgGuidTuple key(check, checkSize, type);
+    LfgAnswer answer = GetCompatibles(key);
     if (answer != LFG_ANSWER_PENDING)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) compatibles (cached): %d", strGuids.c_str(), answer);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) compatibles (cached): %d", strGuids.c_str(), answer);
         return bool(answer);
     }
 
     // Check all but new compatiblitity
-    if (check.size() > 2)
+    if (checkSize > 2)
     {
-        uint64 frontGuid = check.front();
-        check.pop_front();
-
         // Check all-but-new compatibilities (New, A, B, C, D) --> check(A, B, C, D)
-        if (!CheckCompatibility(check, pProposal, type))          // Group not compatible
+        if (!CheckCompatibility(check + 1, checkSize - 1, pProposal, type))          // Group not compatible
         {
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) not compatibles (%s not compatibles)", strGuids.c_str(), ConcatenateGuids(check).c_str());
-            SetCompatibles(strGuids, false);
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) not compatibles (%s not compatibles)", strGuids.c_str(), ConcatenateGuids(check + 1, checkSize - 1).c_str());
+            SetCompatibles(key, false);
             return false;
         }
-        check.push_front(frontGuid);
         // all-but-new compatibles, now check with new
     }
 
@@ -1064,9 +1209,9 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     uint8 numLfgGroups = 0;
     uint32 groupLowGuid = 0;
     LfgQueueInfoMap pqInfoMap;
-    for (LfgGuidList::const_iterator it = check.begin(); it != check.end() && numLfgGroups < 2 && numPlayers <= maxGroupSize; ++it)
+    for (uint8 i = 0; i < checkSize && numLfgGroups < 2 && numPlayers <= maxGroupSize; ++i)
     {
-        uint64 guid = (*it);
+        uint64 guid = check[i];
         LfgQueueInfoMap::iterator itQueue = m_QueueInfoMap.find(guid);
         if (itQueue == m_QueueInfoMap.end() || GetState(guid) != LFG_STATE_QUEUED)
         {
@@ -1094,17 +1239,17 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
         }
     }
 
-    if (check.size() == 1 && numPlayers != maxGroupSize)   // Single group with less than MAXGROUPSIZE - Compatibles
+    if (checkSize == 1 && numPlayers != maxGroupSize)   // Single group with less than MAXGROUPSIZE - Compatibles
         return true;
 
     // Do not match - groups already in a lfgDungeon or too much players
     if (numLfgGroups > 1 || numPlayers > maxGroupSize)
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(key, false);
         if (numLfgGroups > 1)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) More than one Lfggroup (%u)", strGuids.c_str(), numLfgGroups);
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) More than one Lfggroup (%u)", strGuids.c_str(), numLfgGroups);
         else
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Too much players (%u)", strGuids.c_str(), numPlayers);
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Too much players (%u)", strGuids.c_str(), numPlayers);
         return false;
     }
 
@@ -1127,11 +1272,15 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
         return false;
 
     PlayerSet players;
+    bool offline = false;
     for (LfgRolesMap::const_iterator it = rolesMap.begin(); it != rolesMap.end(); ++it)
     {
         Player* player = ObjectAccessor::FindPlayer(it->first);
         if (!player)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Warning! [" UI64FMTD "] offline! Marking as not compatibles!", strGuids.c_str(), it->first);
+        {
+            offline = true;
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Warning! [" UI64FMTD "] offline! Marking as not compatibles!", strGuids.c_str(), it->first);
+        }
         else
         {
             for (PlayerSet::const_iterator itPlayer = players.begin(); itPlayer != players.end() && player; ++itPlayer)
@@ -1139,7 +1288,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
                 // Do not form a group with ignoring candidates
                 if (player->GetSocial()->HasIgnore((*itPlayer)->GetGUIDLow()) || (*itPlayer)->GetSocial()->HasIgnore(player->GetGUIDLow()))
                 {
-                    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Players [" UI64FMTD "] and [" UI64FMTD "] ignoring", strGuids.c_str(), (*itPlayer)->GetGUID(), player->GetGUID());
+                    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Players [" UI64FMTD "] and [" UI64FMTD "] ignoring", strGuids.c_str(), (*itPlayer)->GetGUID(), player->GetGUID());
                     player = NULL;
                 }
             }
@@ -1153,8 +1302,9 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     if (players.size() != numPlayers || !CheckGroupRoles(rolesMap, type))
     {
         if (players.size() == numPlayers)
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Roles not compatible", strGuids.c_str());
-        SetCompatibles(strGuids, false);
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Roles not compatible", strGuids.c_str());
+        if (!offline)                                      // may be back on next update
+            SetCompatibles(key, false);
         return false;
     }
 
@@ -1180,15 +1330,15 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
 
     if (compatibleDungeons.empty())
     {
-        SetCompatibles(strGuids, false);
+        SetCompatibles(key, false);
         return false;
     }
-    SetCompatibles(strGuids, true);
+    SetCompatibles(key, true);
 
     // ----- Group is compatible, if we have MAXGROUPSIZE members then match is found
     if (numPlayers != maxGroupSize)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Compatibles but not match. Players(%u)", strGuids.c_str(), numPlayers);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) Compatibles but not match. Players(%u)", strGuids.c_str(), numPlayers);
         uint8 Tanks_Needed = LFG_TANKS_NEEDED;
         uint8 Healers_Needed = LFG_HEALERS_NEEDED;
         uint8 Dps_Needed = LFG_DPS_NEEDED;
@@ -1251,7 +1401,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
         }
         return true;
     }
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) MATCH! Group formed", strGuids.c_str());
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::CheckCompatibility: (%s) MATCH! Group formed", strGuids.c_str());
 
     // GROUP FORMED!
     // TODO - Improve algorithm to select proper group based on Item Level
@@ -1263,7 +1413,7 @@ bool LFGMgr::CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgT
     pProposal = new LfgProposal(SkyMistCore::Containers::SelectRandomContainerElement(compatibleDungeons));
     pProposal->cancelTime = time_t(time(NULL)) + LFG_TIME_PROPOSAL;
     pProposal->state = LFG_PROPOSAL_INITIATING;
-    pProposal->queues = check;
+    pProposal->queues.assign(check, check + checkSize);
     pProposal->groupLowGuid = groupLowGuid;
 
     // Assign new roles to players and assign new leader
@@ -1454,44 +1604,73 @@ void LFGMgr::UpdateRoleCheck(uint64 gguid, uint64 guid /* = 0 */, uint8 roles /*
 */
 void LFGMgr::RemoveFromCompatibles(uint64 guid)
 {
-    std::stringstream out;
-    out << guid;
-    std::string strGuid = out.str();
+    LfgCompatibleKeyMap::iterator itKeys = m_CompatibleKeys.find(guid);
+    if (itKeys == m_CompatibleKeys.end())
+        return;
 
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveFromCompatibles: Removing [" UI64FMTD "]", guid);
-    for (LfgCompatibleMap::iterator itNext = m_CompatibleMap.begin(); itNext != m_CompatibleMap.end();)
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveFromCompatibles: Removing [" UI64FMTD "]", guid);
+    for (std::vector<uint64>::const_iterator itHash = itKeys->second.begin(); itHash != itKeys->second.end(); ++itHash)
     {
-        LfgCompatibleMap::iterator it = itNext++;
-        if (it->first.find(strGuid) != std::string::npos)  // Found, remove it
-            m_CompatibleMap.erase(it);
+        // other members keep the hash, erasing it again for them finds nothing
+        std::pair<LfgCompatibleMap::iterator, LfgCompatibleMap::iterator> range = m_CompatibleMap.equal_range(*itHash);
+        for (LfgCompatibleMap::iterator itNext = range.first; itNext != range.second;)
+        {
+            LfgCompatibleMap::iterator it = itNext++;
+            if (it->second.queues.Contains(guid))
+                m_CompatibleMap.erase(it);
+        }
     }
+
+    m_CompatibleKeys.erase(itKeys);
+}
+
+/**
+   Drops the whole compatible cache, it only serves the search of the current new queuer
+*/
+void LFGMgr::ClearCompatibles()
+{
+    m_CompatibleMap.clear();
+    m_CompatibleKeys.clear();
 }
 
 /**
    Stores the compatibility of a list of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     key Sorted guids
    @param[in]     compatibles Compatibles or not
 */
-void LFGMgr::SetCompatibles(std::string key, bool compatibles)
+void LFGMgr::SetCompatibles(LfgGuidTuple const& key, bool compatibles)
 {
-    m_CompatibleMap[key] = LfgAnswer(compatibles);
+    uint64 hash = key.Hash();
+    std::pair<LfgCompatibleMap::iterator, LfgCompatibleMap::iterator> range = m_CompatibleMap.equal_range(hash);
+    for (LfgCompatibleMap::iterator it = range.first; it != range.second; ++it)
+    {
+        if (it->second.queues == key)
+        {
+            it->second.answer = LfgAnswer(compatibles);
+            return;
+        }
+    }
+
+    m_CompatibleMap.insert(std::make_pair(hash, LfgCompatibleEntry(key, LfgAnswer(compatibles))));
+    for (uint8 i = 0; i < key.size; ++i)
+        m_CompatibleKeys[key.guids[i]].push_back(hash);
 }
 
 /**
    Get the compatibility of a group of guids
 
-   @param[in]     key String concatenation of guids (| used as separator)
+   @param[in]     key Sorted guids
    @return 1 (Compatibles), 0 (Not compatibles), -1 (Not set)
 */
-LfgAnswer LFGMgr::GetCompatibles(std::string key)
+LfgAnswer LFGMgr::GetCompatibles(LfgGuidTuple const& key) const
 {
-    LfgAnswer answer = LFG_ANSWER_PENDING;
-    LfgCompatibleMap::iterator it = m_CompatibleMap.find(key);
-    if (it != m_CompatibleMap.end())
-        answer = it->second;
+    std::pair<LfgCompatibleMap::const_iterator, LfgCompatibleMap::const_iterator> range = m_CompatibleMap.equal_range(key.Hash());
+    for (LfgCompatibleMap::const_iterator it = range.first; it != range.second; ++it)
+        if (it->second.queues == key)
+            return it->second.answer;
 
-    return answer;
+    return LFG_ANSWER_PENDING;
 }
 
 /**
@@ -1646,7 +1825,7 @@ void LFGMgr::UpdateProposal(uint32 proposalId, uint64 guid, bool accept)
     LfgProposalPlayer* ppPlayer = itProposalPlayer->second;
 
     ppPlayer->accept = LfgAnswer(accept);
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::UpdateProposal: Player [" UI64FMTD "] of proposal %u selected: %u", guid, proposalId, accept);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::UpdateProposal: Player [" UI64FMTD "] of proposal %u selected: %u", guid, proposalId, accept);
     if (!accept)
     {
         RemoveProposal(itProposal, LFG_UPDATETYPE_PROPOSAL_DECLINED);
@@ -1827,7 +2006,7 @@ void LFGMgr::RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType t
     LfgProposal* pProposal = itProposal->second;
     pProposal->state = LFG_PROPOSAL_FAILED;
 
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: Proposal %u, state FAILED, UpdateType %u", itProposal->first, type);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: Proposal %u, state FAILED, UpdateType %u", itProposal->first, type);
     // Mark all people that didn't answered as no accept
     if (type == LFG_UPDATETYPE_PROPOSAL_FAILED)
         for (LfgProposalPlayerMap::const_iterator it = pProposal->players.begin(); it != pProposal->players.end(); ++it)
@@ -1871,12 +2050,12 @@ void LFGMgr::RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType t
             if (it->second->accept == LFG_ANSWER_DENY)
             {
                 updateData.updateType = type;
-                sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: [" UI64FMTD "] didn't accept. Removing from queue and compatible cache", guid);
+                TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: [" UI64FMTD "] didn't accept. Removing from queue and compatible cache", guid);
             }
             else
             {
                 updateData.updateType = LFG_UPDATETYPE_REMOVED_FROM_QUEUE;
-                sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: [" UI64FMTD "] in same group that someone that didn't accept. Removing from queue and compatible cache", guid);
+                TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: [" UI64FMTD "] in same group that someone that didn't accept. Removing from queue and compatible cache", guid);
             }
             ClearState(guid);
             if (grp)
@@ -1889,7 +2068,7 @@ void LFGMgr::RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType t
         }
         else
         {
-            sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: Readding [" UI64FMTD "] to queue.", guid);
+            TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveProposal: Readding [" UI64FMTD "] to queue.", guid);
             SetState(guid, LFG_STATE_QUEUED);
             if (grp)
             {
@@ -2049,7 +2228,7 @@ void LFGMgr::UpdateBoot(Player* player, bool accept)
 */
 void LFGMgr::TeleportPlayer(Player* player, bool out, bool fromOpcode /*= false*/)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::TeleportPlayer: [" UI64FMTD "] is being teleported %s", player->GetGUID(), out ? "out" : "in");
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::TeleportPlayer: [" UI64FMTD "] is being teleported %s", player->GetGUID(), out ? "out" : "in");
 
     LfgTeleportError error = LFG_TELEPORTERROR_OK;
     Group* grp = player->GetGroup();
@@ -2280,7 +2459,7 @@ void LFGMgr::RewardDungeonDoneFor(const uint32 dungeonId, Player* player)
     Group* group = player->GetGroup();
     if (!group || !group->isLFGGroup())
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] is not in a group or not a LFGGroup. Ignoring", player->GetGUID());
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] is not in a group or not a LFGGroup. Ignoring", player->GetGUID());
         return;
     }
 
@@ -2289,13 +2468,13 @@ void LFGMgr::RewardDungeonDoneFor(const uint32 dungeonId, Player* player)
     uint32 gDungeonId = GetDungeon(gguid);
     if (gDungeonId != dungeonId)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] Finished dungeon %u but group queued for %u. Ignoring", guid, dungeonId, gDungeonId);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] Finished dungeon %u but group queued for %u. Ignoring", guid, dungeonId, gDungeonId);
         return;
     }
 
     if (GetState(guid) == LFG_STATE_FINISHED_DUNGEON)
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] Already rewarded player. Ignoring", guid);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] Already rewarded player. Ignoring", guid);
         return;
     }
 
@@ -2311,7 +2490,7 @@ void LFGMgr::RewardDungeonDoneFor(const uint32 dungeonId, Player* player)
     LFGDungeonEntry const* dungeon = sLFGDungeonStore.LookupEntry(rDungeonId);
     if (!dungeon || (dungeon->type != TYPEID_RANDOM_DUNGEON && !(dungeon->flags & LFG_FLAG_SEASONAL)))
     {
-        sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] dungeon %u is not random nor seasonal", guid, rDungeonId);
+        TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] dungeon %u is not random nor seasonal", guid, rDungeonId);
         return;
     }
 
@@ -2345,7 +2524,7 @@ void LFGMgr::RewardDungeonDoneFor(const uint32 dungeonId, Player* player)
     }
 
     // Give rewards
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] done dungeon %u, %s previously done.", player->GetGUID(), GetDungeon(gguid), index > 0 ? " " : " not");
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RewardDungeonDoneFor: [" UI64FMTD "] done dungeon %u, %s previously done.", player->GetGUID(), GetDungeon(gguid), index > 0 ? " " : " not");
     player->GetSession()->SendLfgPlayerReward(dungeon->Entry(), GetDungeon(gguid, false), index, reward, qReward);
 }
 
@@ -2438,7 +2617,7 @@ LfgType LFGMgr::GetDungeonType(uint32 dungeonId)
    @param[in]     check list of guids
    @returns Concatenated string
 */
-std::string LFGMgr::ConcatenateGuids(LfgGuidList check)
+std::string LFGMgr::ConcatenateGuids(LfgGuidList const& check)
 {
     if (check.empty())
         return "";
@@ -2451,6 +2630,53 @@ std::string LFGMgr::ConcatenateGuids(LfgGuidList check)
     return o.str();
 }
 
+std::string LFGMgr::ConcatenateGuids(uint64 const* check, uint8 checkSize)
+{
+    if (!checkSize)
+        return "";
+
+    std::ostringstream o;
+    o << check[0];
+    for (uint8 i = 1; i < checkSize; ++i)
+        o << '|' << check[i];
+    return o.str();
+}
+
+uint8 LFGMgr::GetMaxGroupSize(LfgType type)
+{
+    switch (type)
+    {
+        case LFG_SUBTYPEID_RAID:
+            return 25;
+        case LFG_SUBTYPEID_SCENARIO:
+            return 3;
+        default:
+            return 5;
+    }
+}
+
+void LFGMgr::GetNeededRoles(LfgType type, uint8& tanks, uint8& healers, uint8& dps)
+{
+    switch (type)
+    {
+        case LFG_SUBTYPEID_RAID:
+            tanks = 2;
+            healers = 6;
+            dps = 17;
+            break;
+        case LFG_SUBTYPEID_SCENARIO:
+            tanks = 0;
+            healers = 0;
+            dps = 3;
+            break;
+        default:
+            tanks = 1;
+            healers = 1;
+            dps = 3;
+            break;
+    }
+}
+
 HolidayIds LFGMgr::GetDungeonSeason(uint32 dungeonId)
 {
     HolidayIds holiday = HOLIDAY_NONE;
@@ -2488,7 +2714,7 @@ HolidayIds LFGMgr::GetDungeonSeason(uint32 dungeonId)
 
 LfgState LFGMgr::GetState(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetState: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetState: [" UI64FMTD "]", guid);
     if (IS_GROUP(guid))
         return m_Groups[guid].GetState();
     else
@@ -2497,19 +2723,19 @@ LfgState LFGMgr::GetState(uint64 guid)
 
 uint32 LFGMgr::GetDungeon(uint64 guid, bool asId /*= true*/)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetDungeon: [" UI64FMTD "] asId: %u", guid, asId);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetDungeon: [" UI64FMTD "] asId: %u", guid, asId);
     return m_Groups[guid].GetDungeon(asId);
 }
 
 uint8 LFGMgr::GetRoles(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetRoles: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetRoles: [" UI64FMTD "]", guid);
     return m_Players[guid].GetRoles();
 }
 
 const std::string& LFGMgr::GetComment(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetComment: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetComment: [" UI64FMTD "]", guid);
     return m_Players[guid].GetComment();
 }
 
@@ -2525,43 +2751,43 @@ bool LFGMgr::IsTeleported(uint64 pguid)
 
 const LfgDungeonSet& LFGMgr::GetSelectedDungeons(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetSelectedDungeons: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetSelectedDungeons: [" UI64FMTD "]", guid);
     return m_Players[guid].GetSelectedDungeons();
 }
 
 const LfgLockMap& LFGMgr::GetLockedDungeons(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetLockedDungeons: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetLockedDungeons: [" UI64FMTD "]", guid);
     return m_Players[guid].GetLockedDungeons();
 }
 
 uint8 LFGMgr::GetKicksLeft(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetKicksLeft: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetKicksLeft: [" UI64FMTD "]", guid);
     return m_Groups[guid].GetKicksLeft();
 }
 
 uint8 LFGMgr::GetVotesNeeded(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::GetVotesNeeded: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::GetVotesNeeded: [" UI64FMTD "]", guid);
     return m_Groups[guid].GetVotesNeeded();
 }
 
 void LFGMgr::RestoreState(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RestoreState: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RestoreState: [" UI64FMTD "]", guid);
     m_Groups[guid].RestoreState();
 }
 
 void LFGMgr::ClearState(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::ClearState: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::ClearState: [" UI64FMTD "]", guid);
     m_Players[guid].ClearState();
 }
 
 void LFGMgr::SetState(uint64 guid, LfgState state)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::SetState: [" UI64FMTD "] state %u", guid, state);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::SetState: [" UI64FMTD "] state %u", guid, state);
     if (IS_GROUP(guid))
         m_Groups[guid].SetState(state);
     else
@@ -2570,43 +2796,43 @@ void LFGMgr::SetState(uint64 guid, LfgState state)
 
 void LFGMgr::SetDungeon(uint64 guid, uint32 dungeon)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::SetDungeon: [" UI64FMTD "] dungeon %u", guid, dungeon);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::SetDungeon: [" UI64FMTD "] dungeon %u", guid, dungeon);
     m_Groups[guid].SetDungeon(dungeon);
 }
 
 void LFGMgr::SetRoles(uint64 guid, uint8 roles)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::SetRoles: [" UI64FMTD "] roles: %u", guid, roles);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::SetRoles: [" UI64FMTD "] roles: %u", guid, roles);
     m_Players[guid].SetRoles(roles);
 }
 
 void LFGMgr::SetComment(uint64 guid, const std::string& comment)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::SetComment: [" UI64FMTD "] comment: %s", guid, comment.c_str());
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::SetComment: [" UI64FMTD "] comment: %s", guid, comment.c_str());
     m_Players[guid].SetComment(comment);
 }
 
 void LFGMgr::SetSelectedDungeons(uint64 guid, const LfgDungeonSet& dungeons)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::SetSelectedDungeons: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::SetSelectedDungeons: [" UI64FMTD "]", guid);
     m_Players[guid].SetSelectedDungeons(dungeons);
 }
 
 void LFGMgr::SetLockedDungeons(uint64 guid, const LfgLockMap& lock)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::SetLockedDungeons: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::SetLockedDungeons: [" UI64FMTD "]", guid);
     m_Players[guid].SetLockedDungeons(lock);
 }
 
 void LFGMgr::DecreaseKicksLeft(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::DecreaseKicksLeft: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::DecreaseKicksLeft: [" UI64FMTD "]", guid);
     m_Groups[guid].DecreaseKicksLeft();
 }
 
 void LFGMgr::RemovePlayerData(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemovePlayerData: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemovePlayerData: [" UI64FMTD "]", guid);
     LfgPlayerDataMap::iterator it = m_Players.find(guid);
     if (it != m_Players.end())
         m_Players.erase(it);
@@ -2614,7 +2840,7 @@ void LFGMgr::RemovePlayerData(uint64 guid)
 
 void LFGMgr::RemoveGroupData(uint64 guid)
 {
-    sLog->outDebug(LOG_FILTER_LFG, "LFGMgr::RemoveGroupData: [" UI64FMTD "]", guid);
+    TC_LOG_DEBUG(LOG_FILTER_LFG, "LFGMgr::RemoveGroupData: [" UI64FMTD "]", guid);
     LfgGroupDataMap::iterator it = m_Groups.find(guid);
     if (it != m_Groups.end())
         m_Groups.erase(it);
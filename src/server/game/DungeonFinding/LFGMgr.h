@@ -24,6 +24,8 @@
 #include "LockedMap.h"
 #include "LFGPlayerData.h"
 
+#include <vector>
+
 class LfgGroupData;
 class LfgPlayerData;
 class Group;
@@ -147,7 +149,6 @@ typedef std::set<Player*> PlayerSet;
 typedef std::list<Player*> LfgPlayerList;
 typedef std::multimap<uint32, LfgReward const*> LfgRewardMap;
 typedef std::pair<LfgRewardMap::const_iterator, LfgRewardMap::const_iterator> LfgRewardMapBounds;
-typedef std::map<std::string, LfgAnswer> LfgCompatibleMap;
 typedef std::map<uint64, LfgDungeonSet> LfgDungeonMap;
 typedef std::map<uint64, uint8> LfgRolesMap;
 typedef std::map<uint64, LfgAnswer> LfgAnswerMap;
@@ -160,6 +161,45 @@ typedef std::map<uint64, LfgGroupData> LfgGroupDataMap;
 typedef std::map<uint32, Position> LfgEntrancePositionMap;
 typedef ACE_Based::LockedMap<uint64, LfgPlayerData> LfgPlayerDataMap;
 
+#define LFG_MAX_MATCH_QUEUES 25                            ///< Raid size, a match never has more queues than players
+
+/// Queue guids of a possible match, sorted, so any order of the same queues gives the same key
+struct LfgGuidTuple
+{
+    LfgGuidTuple(uint64 const* _guids, uint8 _size, LfgType _type);
+
+    bool operator==(LfgGuidTuple const& other) const;
+    bool Contains(uint64 guid) const;
+    uint64 Hash() const;
+
+    uint64 guids[LFG_MAX_MATCH_QUEUES];
+    uint8 size;
+    LfgType type;
+};
+
+/// Cached compatibility of a tuple
+struct LfgCompatibleEntry
+{
+    LfgCompatibleEntry(LfgGuidTuple const& _queues, LfgAnswer _answer): queues(_queues), answer(_answer) {}
+    LfgGuidTuple queues;
+    LfgAnswer answer;
+};
+
+typedef UNORDERED_MULTIMAP<uint64, LfgCompatibleEntry> LfgCompatibleMap;              ///< By LfgGuidTuple::Hash()
+typedef UNORDERED_MAP<uint64, std::vector<uint64> > LfgCompatibleKeyMap;             ///< Queue guid -> hashes of the entries containing it
+
+/// Queued guid able to join a match, with the players that can only take one role
+struct LfgMatchCandidate
+{
+    uint64 guid;
+    uint8 players;
+    uint8 tanks;
+    uint8 healers;
+    uint8 dps;
+};
+
+typedef std::vector<LfgMatchCandidate> LfgMatchCandidateList;
+
 // Data needed by SMSG_LFG_JOIN_RESULT
 struct LfgJoinResultData
 {
@@ -356,18 +396,24 @@ class LFGMgr
         void RemoveProposal(LfgProposalMap::iterator itProposal, LfgUpdateType type);
 
         // Group Matching
-        LfgProposal* FindNewGroups(LfgGuidList& check, LfgGuidList& all, LfgType type);
+        LfgProposal* FindNewGroups(LfgGuidList const& check, LfgGuidList const& all, LfgType type);
+        LfgProposal* FindNewGroups(uint64* check, uint8 checkSize, LfgMatchCandidate const& checkRoles, LfgMatchCandidateList const& candidates, size_t& next, LfgType type);
+        bool GetMatchCandidate(uint64 guid, LfgMatchCandidate& candidate) const;
         bool CheckGroupRoles(LfgRolesMap &groles, LfgType type, bool removeLeaderFlag = true);
-        bool CheckCompatibility(LfgGuidList check, LfgProposal*& pProposal, LfgType type);
+        bool CheckCompatibility(uint64 const* check, uint8 checkSize, LfgProposal*& pProposal, LfgType type);
         void GetCompatibleDungeons(LfgDungeonSet& dungeons, const PlayerSet& players, LfgLockPartyMap& lockMap);
-        void SetCompatibles(std::string concatenatedGuids, bool compatibles);
-        LfgAnswer GetCompatibles(std::string concatenatedGuids);
+        void SetCompatibles(LfgGuidTuple const& key, bool compatibles);
+        LfgAnswer GetCompatibles(LfgGuidTuple const& key) const;
         void RemoveFromCompatibles(uint64 guid);
+        void ClearCompatibles();
+        static uint8 GetMaxGroupSize(LfgType type);
+        static void GetNeededRoles(LfgType type, uint8& tanks, uint8& healers, uint8& dps);
 
         // Generic
         const LfgDungeonSet& GetDungeonsByRandom(uint32 randomdungeon, bool check = false);
         LfgType GetDungeonType(uint32 dungeon);
-        std::string ConcatenateGuids(LfgGuidList check);
+        std::string ConcatenateGuids(LfgGuidList const& check);
+        std::string ConcatenateGuids(uint64 const* check, uint8 checkSize);
 
         // General variables
         bool m_update;                                     ///< Doing an update?
@@ -390,6 +436,7 @@ class LFGMgr
         LfgGuidListMap m_currentQueue;                     ///< Ordered list. Used to find groups
         LfgGuidListMap m_newToQueue;                       ///< New groups to add to queue
         LfgCompatibleMap m_CompatibleMap;                  ///< Compatible dungeons
+        LfgCompatibleKeyMap m_CompatibleKeys;              ///< Cache entries of each queued guid, to drop them when it leaves
         LfgGuidList m_teleport;                            ///< Players being teleported
         // Rolecheck - Proposal - Vote Kicks
         LfgRoleCheckMap m_RoleChecks;                      ///< Current Role checks
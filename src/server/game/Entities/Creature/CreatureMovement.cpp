@@ -102,7 +102,7 @@ void Creature::SetPosition(float x, float y, float z, float o)
     // Prevent crash when a bad coord is sent by the client.
     if (!SkyMistCore::IsValidMapCoord(x, y, z, o))
     {
-        sLog->outDebug(LOG_FILTER_UNITS, "Creature::SetPosition(%f, %f, %f) .. bad coordinates!", x, y, z);
+        TC_LOG_DEBUG(LOG_FILTER_UNITS, "Creature::SetPosition(%f, %f, %f) .. bad coordinates!", x, y, z);
         return;
     }
 
@@ -1286,7 +1286,7 @@ void GameObject::Use(Unit* user)
 
                 if (info->goober.eventId)
                 {
-                    sLog->outDebug(LOG_FILTER_MAPSCRIPTS, "Goober ScriptStart id %u for GO entry %u (GUID %u).", info->goober.eventId, GetEntry(), GetDBTableGUIDLow());
+                    TC_LOG_DEBUG(LOG_FILTER_MAPSCRIPTS, "Goober ScriptStart id %u for GO entry %u (GUID %u).", info->goober.eventId, GetEntry(), GetDBTableGUIDLow());
                     GetMap()->ScriptsStart(sEventScripts, info->goober.eventId, player, this);
                     EventInform(info->goober.eventId);
                 }
@@ -1385,7 +1385,7 @@ void GameObject::Use(Unit* user)
 
                     int32 roll = irand(1, 100);
 
-                    sLog->outDebug(LOG_FILTER_GENERAL, "Fishing check (skill: %i zone min skill: %i chance %i roll: %i", skill, zone_skill, chance, roll);
+                    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Fishing check (skill: %i zone min skill: %i chance %i roll: %i", skill, zone_skill, chance, roll);
 
                     // but you will likely cause junk in areas that require a high fishing skill (not yet implemented)
                     if (chance >= roll)
@@ -1700,7 +1700,7 @@ void GameObject::Use(Unit* user)
         if (user->GetTypeId() != TYPEID_PLAYER || !sOutdoorPvPMgr->HandleCustomSpell(user->ToPlayer(), spellId, this))
             sLog->outError(LOG_FILTER_GENERAL, "WORLD: unknown spell id %u at use action for gameobject (Entry: %u GoType: %u)", spellId, GetEntry(), GetGoType());
         else
-            sLog->outDebug(LOG_FILTER_OUTDOORPVP, "WORLD: %u non-dbc spell was handled by OutdoorPvP", spellId);
+            TC_LOG_DEBUG(LOG_FILTER_OUTDOORPVP, "WORLD: %u non-dbc spell was handled by OutdoorPvP", spellId);
         return;
     }
 
@@ -2228,7 +2228,9 @@ Player* GameObject::GetLootRecipient() const
 {
     if (!m_lootRecipient)
         return NULL;
-    return ObjectAccessor::FindPlayer(m_lootRecipient);
+
+    // only on this map, the kill rewards of a recipient who left would be written from another map's update
+    return ObjectAccessor::GetPlayer(*this, m_lootRecipient);
 }
 
 Group* GameObject::GetLootRecipientGroup() const
@@ -2284,7 +2286,6 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
         return;
 
     bool forcedFlags = GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo()->chest.groupLootRules && HasLootRecipient();
-    bool targetIsGM = target->isGameMaster();
 
     ByteBuffer fieldBuffer;
 
@@ -2296,47 +2297,19 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
+    BuildValuesUpdateMask(updateType, flags, visibleFlag, _fieldNotifyFlags, updateMask);
+
+    if (forcedFlags)
+        updateMask.SetBit(GAMEOBJECT_FLAGS);
+    updateMask.SetBit(OBJECT_FIELD_DYNAMIC_FLAGS);
+    updateMask.SetBit(GAMEOBJECT_BYTES_1);
+
     for (uint16 index = 0; index < m_valuesCount; ++index)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changedFields[index] : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == GAMEOBJECT_FLAGS && forcedFlags) || index == OBJECT_FIELD_DYNAMIC_FLAGS || index == GAMEOBJECT_BYTES_1)
-
+        if (updateMask.GetBit(index))
         {
-            updateMask.SetBit(index);
-
-            if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
-            {
-                uint16 dynFlags = 0;
-                switch (GetGoType())
-                {
-                    case GAMEOBJECT_TYPE_CHEST:
-                    case GAMEOBJECT_TYPE_GOOBER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
-                        else if (targetIsGM)
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_GENERIC:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_SPARKLE;
-                        break;
-                }
-
-                fieldBuffer << uint16(dynFlags);
-                fieldBuffer << uint16(-1);
-            }
-            else if (index == GAMEOBJECT_FLAGS)
-            {
-                uint32 flags = m_uint32Values[GAMEOBJECT_FLAGS];
-                if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
-                {
-                    if (GetGOInfo()->chest.groupLootRules && (!IsLootAllowedFor(target) || GetOwner() && GetOwner()->ToCreature() && !target->CanLootWeeklyBoss(GetOwner()->ToCreature())))
-                        flags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
-                }
-
-                fieldBuffer << flags;
-            }
+            if (IsViewerDependentField(index))
+                fieldBuffer << GetViewerDependentFieldValue(index, target);
             else if (index == GAMEOBJECT_BYTES_1)
             {
                 if (GetGoType() == GAMEOBJECT_TYPE_TRANSPORT && !IsDynTransport() && (m_updateFlag & UPDATEFLAG_TRANSPORT_ARR))
@@ -2353,3 +2326,47 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
 }
+
+bool GameObject::IsViewerDependentField(uint16 index) const
+{
+    return index == OBJECT_FIELD_DYNAMIC_FLAGS || index == GAMEOBJECT_FLAGS;
+}
+
+uint32 GameObject::GetViewerDependentFieldValue(uint16 index, Player* target) const
+{
+    if (index == OBJECT_FIELD_DYNAMIC_FLAGS)
+    {
+        uint16 dynFlags = 0;
+        switch (GetGoType())
+        {
+            case GAMEOBJECT_TYPE_CHEST:
+            case GAMEOBJECT_TYPE_GOOBER:
+                if (ActivateToQuest(target))
+                    dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
+                else if (target->isGameMaster())
+                    dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                break;
+            case GAMEOBJECT_TYPE_GENERIC:
+                if (ActivateToQuest(target))
+                    dynFlags |= GO_DYNFLAG_LO_SPARKLE;
+                break;
+        }
+
+        // dynamic flags in the low half, path progress (unused, -1) in the high half
+        return uint32(dynFlags) | (uint32(uint16(-1)) << 16);
+    }
+
+    if (index == GAMEOBJECT_FLAGS)
+    {
+        uint32 flags = m_uint32Values[GAMEOBJECT_FLAGS];
+        if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
+        {
+            if (GetGOInfo()->chest.groupLootRules && (!IsLootAllowedFor(target) || GetOwner() && GetOwner()->ToCreature() && !target->CanLootWeeklyBoss(GetOwner()->ToCreature())))
+                flags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
+        }
+
+        return flags;
+    }
+
+    return m_uint32Values[index];
+}
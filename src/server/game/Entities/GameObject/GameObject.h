@@ -671,6 +671,8 @@ class GameObject : public WorldObject, public GridObject<GameObject>
         ~GameObject();
         
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
+        bool IsViewerDependentField(uint16 index) const;
+        uint32 GetViewerDependentFieldValue(uint16 index, Player* target) const;
 
         void AddToWorld();
         void RemoveFromWorld();
@@ -79,7 +79,6 @@ Object::Object() : m_PackGUID(sizeof(uint64)+1)
     m_objectType        = TYPEMASK_OBJECT;
 
     m_uint32Values      = NULL;
-    _changedFields      = NULL;
     _dynamicFields      = NULL;
     m_valuesCount       = 0;
     _dynamicTabCount    = 0;
@@ -87,6 +86,7 @@ Object::Object() : m_PackGUID(sizeof(uint64)+1)
 
     m_inWorld           = false;
     m_objectUpdated     = false;
+    m_objectUpdateMap   = NULL;
 
     m_PackGUID.appendPackGUID(0);
 }
@@ -120,11 +120,10 @@ Object::~Object()
     {
         sLog->outFatal(LOG_FILTER_GENERAL, "Object::~Object - guid=" UI64FMTD ", typeid=%d, entry=%u deleted but still in update list!!", GetGUID(), GetTypeId(), GetEntry());
         //ASSERT(false);
-        sObjectAccessor->RemoveUpdateObject(this);
+        RemoveFromObjectUpdate();
     }
 
     delete [] m_uint32Values;
-    delete [] _changedFields;
     delete [] _dynamicFields;
 }
 
@@ -133,8 +132,7 @@ void Object::_InitValues()
     m_uint32Values = new uint32[m_valuesCount];
     memset(m_uint32Values, 0, m_valuesCount*sizeof(uint32));
 
-    _changedFields = new bool[m_valuesCount];
-    memset(_changedFields, 0, m_valuesCount*sizeof(bool));
+    _changedFields.SetCount(m_valuesCount);
 
     _dynamicFields = new DynamicFields[_dynamicTabCount];
 
@@ -272,13 +270,18 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target) c
 {
     ByteBuffer buf(500);
 
+    BuildValuesUpdateBlock(buf, target);
+
+    data->AddUpdateBlock(buf);
+}
+
+void Object::BuildValuesUpdateBlock(ByteBuffer& buf, Player* target) const
+{
     buf << uint8(UPDATETYPE_VALUES);
     buf.append(GetPackGUID());
 
     BuildValuesUpdate(UPDATETYPE_VALUES, &buf, target);
     BuildDynamicValuesUpdate(&buf);
-
-    data->AddUpdateBlock(buf);
 }
 
 void Object::BuildOutOfRangeUpdateBlock(UpdateData* data) const
@@ -333,31 +336,50 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     uint32* flags = NULL;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    int sendedCount = 0;
+    BuildValuesUpdateMask(updateType, flags, visibleFlag, _fieldNotifyFlags, updateMask);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changedFields[index] : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
+        uint32 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        for (UpdateMask::ClientUpdateMaskType bits = updateMask.GetBlock(block); bits; bits >>= 1, ++index)
+            if (bits & 1)
+                fieldBuffer << m_uint32Values[index];
+    }
+
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+    data->append(fieldBuffer);
+}
+
+void Object::BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 forcedFlag, UpdateMask& updateMask) const
+{
+    UpdateFieldFlagMask const& flagMask = GetUpdateFieldFlagMask(flags);
+
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
+    {
+        UpdateMask::ClientUpdateMaskType bits = flagMask.GetBlock(block, forcedFlag);
+        UpdateMask::ClientUpdateMaskType visible = flagMask.GetBlock(block, visibleFlag);
 
-            ++sendedCount;
+        if (updateType == UPDATETYPE_VALUES)
+            bits |= _changedFields.GetBlock(block) & visible;
+        else
+        {
+            // create blocks carry every visible field that is set
+            uint32 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS;
+            for (UpdateMask::ClientUpdateMaskType bit = 1; visible; visible >>= 1, bit <<= 1, ++index)
+                if ((visible & 1) && m_uint32Values[index])
+                    bits |= bit;
         }
+
+        updateMask.SetBlock(block, bits);
     }
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    // the flags tables may be longer than this object, mask out the fields it doesn't have
+    if (uint32 tail = m_valuesCount % UpdateMask::CLIENT_UPDATE_MASK_BITS)
     {
-        if (updateMask.GetBit(index))
-            --sendedCount;
+        uint32 last = updateMask.GetBlockCount() - 1;
+        updateMask.SetBlock(last, updateMask.GetBlock(last) & ((UpdateMask::ClientUpdateMaskType(1) << tail) - 1));
     }
-
-    ASSERT(sendedCount == 0);
-
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
 }
 
 void Object::BuildDynamicValuesUpdate(ByteBuffer* data) const
@@ -422,7 +444,7 @@ void Object::BuildDynamicValuesUpdate(ByteBuffer* data) const
 
 void Object::ClearUpdateMask(bool remove)
 {
-    memset(_changedFields, 0, m_valuesCount * sizeof(bool));
+    _changedFields.Clear();
     
     if (m_objectUpdated)
     {
@@ -431,13 +453,36 @@ void Object::ClearUpdateMask(bool remove)
                 _dynamicFields[i].ClearMask();
 
         if (remove)
-            sObjectAccessor->RemoveUpdateObject(this);
+            RemoveFromObjectUpdate();
 
         m_objectUpdated = false;
+        m_objectUpdateMap = NULL;
+    }
+}
+
+void Object::AddToObjectUpdateIfNeeded()
+{
+    if (!m_inWorld || m_objectUpdated)
+        return;
+
+    if (Map* map = GetObjectUpdateMap())
+    {
+        map->AddUpdateObject(this);
+        m_objectUpdateMap = map;
+        m_objectUpdated = true;
+    }
+}
+
+void Object::RemoveFromObjectUpdate()
+{
+    if (m_objectUpdateMap)
+    {
+        m_objectUpdateMap->RemoveUpdateObject(this);
+        m_objectUpdateMap = NULL;
     }
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateCache* cache) const
 {
     UpdateDataMapType::iterator iter = data_map.find(player);
 
@@ -448,7 +493,59 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) cons
         iter = p.first;
     }
 
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    if (!cache)
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+        return;
+    }
+
+    uint32* flags = NULL;
+    uint32 visibleFlag = GetUpdateFieldData(player, flags);
+
+    for (ValuesUpdateCache::const_iterator itr = cache->begin(); itr != cache->end(); ++itr)
+    {
+        if (itr->visibleFlag != visibleFlag)
+            continue;
+
+        if (itr->viewerFields.empty())
+        {
+            iter->second.AddUpdateBlock(itr->block);
+            return;
+        }
+
+        ByteBuffer buf(itr->block);
+        for (std::vector<std::pair<uint32, uint16> >::const_iterator field = itr->viewerFields.begin(); field != itr->viewerFields.end(); ++field)
+            buf.put<uint32>(field->first, GetViewerDependentFieldValue(field->second, player));
+
+        iter->second.AddUpdateBlock(buf);
+        return;
+    }
+
+    // first viewer of this visibility class, build the block and remember where the viewer dependent values are
+    cache->push_back(ValuesUpdateCacheEntry(visibleFlag));
+    ValuesUpdateCacheEntry& entry = cache->back();
+    BuildValuesUpdateBlock(entry.block, player);
+
+    size_t maskPos = 1 + GetPackGUID().size();
+    uint8 blockCount = entry.block.read<uint8>(maskPos++);
+    size_t fieldPos = maskPos + blockCount * sizeof(UpdateMask::ClientUpdateMaskType);
+    for (uint8 i = 0; i < blockCount; ++i)
+    {
+        UpdateMask::ClientUpdateMaskType maskPart = entry.block.read<UpdateMask::ClientUpdateMaskType>(maskPos + i * sizeof(UpdateMask::ClientUpdateMaskType));
+        for (uint32 j = 0; maskPart; ++j, maskPart >>= 1)
+        {
+            if (!(maskPart & 1))
+                continue;
+
+            uint16 index = uint16(i * UpdateMask::CLIENT_UPDATE_MASK_BITS + j);
+            if (IsViewerDependentField(index))
+                entry.viewerFields.push_back(std::make_pair(uint32(fieldPos), index));
+
+            fieldPos += sizeof(uint32);
+        }
+    }
+
+    iter->second.AddUpdateBlock(entry.block);
 }
 
 void Object::_LoadIntoDataField(char const* data, uint32 startOffset, uint32 count)
@@ -464,7 +561,7 @@ void Object::_LoadIntoDataField(char const* data, uint32 startOffset, uint32 cou
     for (uint32 index = 0; index < count; ++index)
     {
         m_uint32Values[startOffset + index] = atol(tokens[index]);
-        _changedFields[startOffset + index] = true;
+        _changedFields.Set(startOffset + index);
     }
 }
 
@@ -532,13 +629,9 @@ void Object::SetInt32Value(uint16 index, int32 value)
     if (m_int32Values[index] != value)
     {
         m_int32Values[index] = value;
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -549,13 +642,9 @@ void Object::SetUInt32Value(uint16 index, uint32 value)
     if (m_uint32Values[index] != value)
     {
         m_uint32Values[index] = value;
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -564,7 +653,7 @@ void Object::UpdateInt32Value(uint16 index, int32 value)
     ASSERT(index < m_valuesCount || PrintIndexError(index, true));
 
     m_uint32Values[index] = value;
-    _changedFields[index] = true;
+    _changedFields.Set(index);
 }
 
 void Object::UpdateUInt32Value(uint16 index, uint32 value)
@@ -572,7 +661,7 @@ void Object::UpdateUInt32Value(uint16 index, uint32 value)
     ASSERT(index < m_valuesCount || PrintIndexError(index, true));
 
     m_uint32Values[index] = value;
-    _changedFields[index] = true;
+    _changedFields.Set(index);
 }
 
 void Object::SetUInt64Value(uint16 index, uint64 value)
@@ -582,14 +671,10 @@ void Object::SetUInt64Value(uint16 index, uint64 value)
     {
         m_uint32Values[index] = PAIR64_LOPART(value);
         m_uint32Values[index + 1] = PAIR64_HIPART(value);
-        _changedFields[index] = true;
-        _changedFields[index + 1] = true;
+        _changedFields.Set(index);
+        _changedFields.Set(index + 1);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -600,14 +685,10 @@ bool Object::AddUInt64Value(uint16 index, uint64 value)
     {
         m_uint32Values[index] = PAIR64_LOPART(value);
         m_uint32Values[index + 1] = PAIR64_HIPART(value);
-        _changedFields[index] = true;
-        _changedFields[index + 1] = true;
+        _changedFields.Set(index);
+        _changedFields.Set(index + 1);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
 
         return true;
     }
@@ -622,14 +703,10 @@ bool Object::RemoveUInt64Value(uint16 index, uint64 value)
     {
         m_uint32Values[index] = 0;
         m_uint32Values[index + 1] = 0;
-        _changedFields[index] = true;
-        _changedFields[index + 1] = true;
+        _changedFields.Set(index);
+        _changedFields.Set(index + 1);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
 
         return true;
     }
@@ -644,13 +721,9 @@ void Object::SetFloatValue(uint16 index, float value)
     if (m_floatValues[index] != value)
     {
         m_floatValues[index] = value;
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -668,13 +741,9 @@ void Object::SetByteValue(uint16 index, uint8 offset, uint8 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFF) << (offset * 8));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 8));
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -692,13 +761,9 @@ void Object::SetUInt16Value(uint16 index, uint8 offset, uint16 value)
     {
         m_uint32Values[index] &= ~uint32(uint32(0xFFFF) << (offset * 16));
         m_uint32Values[index] |= uint32(uint32(value) << (offset * 16));
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -759,13 +824,9 @@ void Object::SetFlag(uint16 index, uint32 newFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -774,13 +835,9 @@ void Object::SetFixedFlag(uint16 index, uint32 newFlag)
     ASSERT(index < m_valuesCount || PrintIndexError(index, true));
 
     m_uint32Values[index] = newFlag;
-    _changedFields[index] = true;
+    _changedFields.Set(index);
 
-    if (m_inWorld && !m_objectUpdated)
-    {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
-    }
+    AddToObjectUpdateIfNeeded();
 }
 
 void Object::RemoveFlag(uint16 index, uint32 oldFlag)
@@ -794,13 +851,9 @@ void Object::RemoveFlag(uint16 index, uint32 oldFlag)
     if (oldval != newval)
     {
         m_uint32Values[index] = newval;
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -817,13 +870,9 @@ void Object::SetByteFlag(uint16 index, uint8 offset, uint8 newFlag)
     if (!(uint8(m_uint32Values[index] >> (offset * 8)) & newFlag))
     {
         m_uint32Values[index] |= uint32(uint32(newFlag) << (offset * 8));
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -840,13 +889,9 @@ void Object::RemoveByteFlag(uint16 index, uint8 offset, uint8 oldFlag)
     if (uint8(m_uint32Values[index] >> (offset * 8)) & oldFlag)
     {
         m_uint32Values[index] &= ~uint32(uint32(oldFlag) << (offset * 8));
-        _changedFields[index] = true;
+        _changedFields.Set(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -861,11 +906,7 @@ void Object::SetDynamicUInt32Value(uint32 tab, uint16 index, uint32 value)
         fields.SetValue(index, value);
         fields.MarkAsChanged(index);
 
-        if (m_inWorld && !m_objectUpdated)
-        {
-            sObjectAccessor->AddUpdateObject(this);
-            m_objectUpdated = true;
-        }
+        AddToObjectUpdateIfNeeded();
     }
 }
 
@@ -1299,12 +1340,8 @@ void WorldObject::SendPlaySound(uint32 Sound, bool OnlySelf)
 
 void Object::ForceValuesUpdateAtIndex(uint32 i)
 {
-    _changedFields[i] = true;
-    if (m_inWorld && !m_objectUpdated)
-    {
-        sObjectAccessor->AddUpdateObject(this);
-        m_objectUpdated = true;
-    }
+    _changedFields.Set(i);
+    AddToObjectUpdateIfNeeded();
 }
 
 namespace SkyMistCore
@@ -2249,6 +2286,7 @@ struct WorldObjectChangeAccumulator
     UpdateDataMapType& i_updateDatas;
     WorldObject& i_object;
     std::set<uint64> plr_list;
+    ValuesUpdateCache i_valuesCache;
     WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d) : i_updateDatas(d), i_object(obj) {}
     void Visit(PlayerMapType &m)
     {
@@ -2306,7 +2344,7 @@ struct WorldObjectChangeAccumulator
         // Only send update once to a player
         if (plr_list.find(player->GetGUID()) == plr_list.end() && player->HaveAtClient(&i_object))
         {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, &i_valuesCache);
             plr_list.insert(player->GetGUID());
         }
     }
@@ -22,11 +22,13 @@
 #include "Common.h"
 #include "UpdateFields.h"
 #include "UpdateData.h"
+#include "UpdateMask.h"
 #include "GridReference.h"
 #include "ObjectDefines.h"
 #include "ObjectMovement.h"
 #include "GridDefines.h"
 #include "Map.h"
+#include <list>
 #include <set>
 #include <string>
 #include <sstream>
@@ -123,6 +125,20 @@ class Transport;
 
 typedef UNORDERED_MAP<Player*, UpdateData> UpdateDataMapType;
 
+// Values update block of an object shared by every viewer with the same visibility flags,
+// fields whose value depends on the viewer are patched in place for each of them
+struct ValuesUpdateCacheEntry
+{
+    explicit ValuesUpdateCacheEntry(uint32 flag) : visibleFlag(flag), block(500) { }
+
+    uint32 visibleFlag;
+    ByteBuffer block;
+    std::vector<std::pair<uint32 /*offset*/, uint16 /*index*/> > viewerFields;
+};
+
+// only valid during a single BuildUpdate pass, the blocks contain the changed fields of that pass
+typedef std::list<ValuesUpdateCacheEntry> ValuesUpdateCache;
+
 class DynamicFields
 {
 public:
@@ -380,7 +396,11 @@ class Object
         virtual bool hasQuest(uint32 /* quest_id */) const { return false; }
         virtual bool hasInvolvedQuest(uint32 /* quest_id */) const { return false; }
         virtual void BuildUpdate(UpdateDataMapType&) {}
-        void BuildFieldsUpdate(Player*, UpdateDataMapType &) const;
+        void BuildFieldsUpdate(Player*, UpdateDataMapType &, ValuesUpdateCache* cache = NULL) const;
+
+        // map whose SendObjectUpdates() builds the value updates of this object
+        virtual Map* GetObjectUpdateMap() const { return NULL; }
+        void RemoveFromObjectUpdate();
 
         void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
         void RemoveFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags &= ~flag; }
@@ -419,10 +439,18 @@ class Object
 
         uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
 
+        void AddToObjectUpdateIfNeeded();
+
         bool IsUpdateFieldVisible(uint32 flags, bool isSelf, bool isOwner, bool isItemOwner, bool isPartyMember) const;
 
         void BuildMovementUpdate(ByteBuffer * data, uint16 flags) const;
         virtual void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
+        void BuildValuesUpdateBlock(ByteBuffer& buf, Player* target) const;
+        void BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 forcedFlag, UpdateMask& updateMask) const;
+
+        // fields sent with a different value to each viewer, their values are never shared between viewers
+        virtual bool IsViewerDependentField(uint16 /*index*/) const { return false; }
+        virtual uint32 GetViewerDependentFieldValue(uint16 index, Player* /*target*/) const { return m_uint32Values[index]; }
         void BuildDynamicValuesUpdate(ByteBuffer* data) const;
 
         uint16 m_objectType;
@@ -437,13 +465,14 @@ class Object
             float  *m_floatValues;
         };
 
-        bool* _changedFields;
+        UpdateFieldChangeMask _changedFields;
 
         uint16 m_valuesCount;
 
         uint16 _fieldNotifyFlags;
 
         bool m_objectUpdated;
+        Map* m_objectUpdateMap;
 
         DynamicFields* _dynamicFields;
         uint32 _dynamicTabCount;
@@ -664,6 +693,7 @@ class WorldObject : public Object, public WorldLocation
         virtual void ResetMap();
         Map* GetMap() const  { return m_currMap; }
         Map* FindMap() const { return m_currMap; }
+        Map* GetObjectUpdateMap() const { return m_currMap; }
         //used to check all object's GetMap() calls when object is not in world!
 
         //this function should be removed in nearest time...
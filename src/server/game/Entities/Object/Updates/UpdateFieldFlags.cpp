@@ -16,6 +16,7 @@
  */
 
 #include "UpdateFieldFlags.h"
+#include "Errors.h"
 
 uint32 ItemUpdateFieldFlags[CONTAINER_END] =
 {
@@ -2253,3 +2254,38 @@ uint32 AreaTriggerUpdateFieldFlags[AREATRIGGER_END] =
     UF_FLAG_PUBLIC,                                         // AREATRIGGER_SPELLVISUALID
     UF_FLAG_PUBLIC,                                         // AREATRIGGER_FIELD_EXPLICIT_SCALE
 };
+
+UpdateFieldFlagMask::UpdateFieldFlagMask(uint32 const* flags, uint32 count)
+{
+    for (uint32 bit = 0; bit < MAX_UF_FLAG_BITS; ++bit)
+        _blocks[bit].resize((count + 31) / 32, 0);
+
+    for (uint32 index = 0; index < count; ++index)
+        for (uint32 bit = 0; bit < MAX_UF_FLAG_BITS; ++bit)
+            if (flags[index] & (1 << bit))
+                _blocks[bit][index / 32] |= 1 << (index % 32);
+}
+
+UpdateFieldFlagMask const& GetUpdateFieldFlagMask(uint32 const* flags)
+{
+    static UpdateFieldFlagMask const itemMask(ItemUpdateFieldFlags, CONTAINER_END);
+    static UpdateFieldFlagMask const unitMask(UnitUpdateFieldFlags, PLAYER_END);
+    static UpdateFieldFlagMask const gameObjectMask(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+    static UpdateFieldFlagMask const dynamicObjectMask(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+    static UpdateFieldFlagMask const corpseMask(CorpseUpdateFieldFlags, CORPSE_END);
+    static UpdateFieldFlagMask const areaTriggerMask(AreaTriggerUpdateFieldFlags, AREATRIGGER_END);
+
+    if (flags == UnitUpdateFieldFlags)
+        return unitMask;
+    if (flags == ItemUpdateFieldFlags)
+        return itemMask;
+    if (flags == GameObjectUpdateFieldFlags)
+        return gameObjectMask;
+    if (flags == DynamicObjectUpdateFieldFlags)
+        return dynamicObjectMask;
+    if (flags == CorpseUpdateFieldFlags)
+        return corpseMask;
+
+    ASSERT(flags == AreaTriggerUpdateFieldFlags);
+    return areaTriggerMask;
+}
@@ -21,6 +21,8 @@
 #include "UpdateFields.h"
 #include "Define.h"
 
+#include <vector>
+
 enum UpdatefieldFlags
 {
     UF_FLAG_NONE         = 0x000,
@@ -43,4 +45,29 @@ extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 extern uint32 AreaTriggerUpdateFieldFlags[AREATRIGGER_END];
 
+#define MAX_UF_FLAG_BITS 10
+
+/// Fields of one of the tables above grouped by flag, 32 fields per block in client update mask layout
+class UpdateFieldFlagMask
+{
+    public:
+        UpdateFieldFlagMask(uint32 const* flags, uint32 count);
+
+        /// Fields of the block having at least one of the given flags
+        uint32 GetBlock(uint32 block, uint32 flags) const
+        {
+            uint32 fields = 0;
+            for (uint32 bit = 0; flags && bit < MAX_UF_FLAG_BITS; ++bit, flags >>= 1)
+                if (flags & 1)
+                    fields |= _blocks[bit][block];
+
+            return fields;
+        }
+
+    private:
+        std::vector<uint32> _blocks[MAX_UF_FLAG_BITS];
+};
+
+UpdateFieldFlagMask const& GetUpdateFieldFlagMask(uint32 const* flags);
+
 #endif // _UPDATEFIELDFLAGS_H
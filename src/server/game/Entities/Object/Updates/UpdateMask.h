@@ -23,6 +23,8 @@
 #include "Errors.h"
 #include "ByteBuffer.h"
 
+#include <vector>
+
 class UpdateMask
 {
     public:
@@ -39,26 +41,22 @@ class UpdateMask
         UpdateMask(UpdateMask const& right) : _bits(NULL)
         {
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+            memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         ~UpdateMask() { delete[] _bits; }
 
-        void SetBit(uint32 index) { _bits[index] = 1; }
-        void UnsetBit(uint32 index) { _bits[index] = 0; }
-        bool GetBit(uint32 index) const { return _bits[index] != 0; }
+        void SetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+        void UnsetBit(uint32 index) { _bits[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+        bool GetBit(uint32 index) const { return (_bits[index / CLIENT_UPDATE_MASK_BITS] & (ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS))) != 0; }
+
+        ClientUpdateMaskType GetBlock(uint32 block) const { return _bits[block]; }
+        void SetBlock(uint32 block, ClientUpdateMaskType value) { _bits[block] = value; }
 
         void AppendToPacket(ByteBuffer* data)
         {
             for (uint32 i = 0; i < GetBlockCount(); ++i)
-            {
-                ClientUpdateMaskType maskPart = 0;
-                for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                    if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                        maskPart |= 1 << j;
-
-                *data << maskPart;
-            }
+                *data << _bits[i];
         }
 
         uint32 GetBlockCount() const { return _blockCount; }
@@ -71,14 +69,14 @@ class UpdateMask
             _fieldCount = valuesCount;
             _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            _bits = new ClientUpdateMaskType[_blockCount];
+            memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         void Clear()
         {
             if (_bits)
-                memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+                memset(_bits, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         UpdateMask& operator=(UpdateMask const& right)
@@ -87,14 +85,14 @@ class UpdateMask
                 return *this;
 
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            memcpy(_bits, right._bits, sizeof(ClientUpdateMaskType) * _blockCount);
             return *this;
         }
 
         UpdateMask& operator&=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] &= right._bits[i];
 
             return *this;
@@ -103,7 +101,7 @@ class UpdateMask
         UpdateMask& operator|=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
+            for (uint32 i = 0; i < right._blockCount; ++i)
                 _bits[i] |= right._bits[i];
 
             return *this;
@@ -119,7 +117,63 @@ class UpdateMask
     private:
         uint32 _fieldCount;
         uint32 _blockCount;
-        uint8* _bits;
+        ClientUpdateMaskType* _bits;
+};
+
+/// Changed values fields of an object: a bit per field in client mask layout plus the list of changed indexes,
+/// so that setting, testing and clearing only cost the number of changed fields
+class UpdateFieldChangeMask
+{
+    public:
+        UpdateFieldChangeMask() : _blockCount(0), _bits(NULL) { }
+        ~UpdateFieldChangeMask() { delete[] _bits; }
+
+        void SetCount(uint32 valuesCount)
+        {
+            delete[] _bits;
+
+            _blockCount = (valuesCount + UpdateMask::CLIENT_UPDATE_MASK_BITS - 1) / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+            _bits = new UpdateMask::ClientUpdateMaskType[_blockCount];
+            memset(_bits, 0, sizeof(UpdateMask::ClientUpdateMaskType) * _blockCount);
+            _changed.clear();
+        }
+
+        void Set(uint16 index)
+        {
+            UpdateMask::ClientUpdateMaskType& block = _bits[index / UpdateMask::CLIENT_UPDATE_MASK_BITS];
+            UpdateMask::ClientUpdateMaskType bit = UpdateMask::ClientUpdateMaskType(1) << (index % UpdateMask::CLIENT_UPDATE_MASK_BITS);
+            if (block & bit)
+                return;
+
+            block |= bit;
+            _changed.push_back(index);
+        }
+
+        bool Test(uint16 index) const
+        {
+            return (_bits[index / UpdateMask::CLIENT_UPDATE_MASK_BITS] & (UpdateMask::ClientUpdateMaskType(1) << (index % UpdateMask::CLIENT_UPDATE_MASK_BITS))) != 0;
+        }
+
+        void Clear()
+        {
+            for (std::vector<uint16>::const_iterator itr = _changed.begin(); itr != _changed.end(); ++itr)
+                _bits[*itr / UpdateMask::CLIENT_UPDATE_MASK_BITS] = 0;
+
+            _changed.clear();
+        }
+
+        bool Empty() const { return _changed.empty(); }
+        uint32 GetBlockCount() const { return _blockCount; }
+        UpdateMask::ClientUpdateMaskType GetBlock(uint32 block) const { return _bits[block]; }
+        std::vector<uint16> const& GetChangedIndexes() const { return _changed; }
+
+    private:
+        UpdateFieldChangeMask(UpdateFieldChangeMask const&);
+        UpdateFieldChangeMask& operator=(UpdateFieldChangeMask const&);
+
+        uint32 _blockCount;
+        UpdateMask::ClientUpdateMaskType* _bits;
+        std::vector<uint16> _changed;
 };
 
 #endif
@@ -96,7 +96,7 @@ void Pet::RemoveFromWorld()
     }
 }
 
-bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool current, PetSlot slotID, bool stampeded, PetLoginQueryHolder* holder, bool login)
+bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool current, PetSlot slotID, bool stampeded, PetLoginQueryHolder* holder)
 {
     m_loading = true;
 
@@ -373,7 +373,9 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
         spellCooldownResult = holder->GetPreparedResult(PET_LOGIN_QUERY_LOADSPELLCOOLDOWN);
     }
 
-    _LoadAuras(auraResult, auraEffectResult, timediff, login);
+    // with a holder, everything was prefetched
+    bool prefetched = holder != NULL;
+    _LoadAuras(auraResult, auraEffectResult, timediff, prefetched);
 
     if (owner->GetTypeId() == TYPEID_PLAYER && owner->ToPlayer()->InArena())
         RemoveArenaAuras();
@@ -383,8 +385,8 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
     {
         m_charmInfo->LoadPetActionBar(fields[12].GetString());
 
-        _LoadSpells(spellResult, login);
-        _LoadSpellCooldowns(spellCooldownResult, login);
+        _LoadSpells(spellResult, prefetched);
+        _LoadSpellCooldowns(spellCooldownResult, prefetched);
         LearnPetPassives();
         InitLevelupSpellsForLevel();
         CastPetAuras(current);
@@ -392,7 +394,7 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
 
     CleanupActionBar();                                     // remove unknown spells from action bar after load
 
-    sLog->outDebug(LOG_FILTER_PETS, "New Pet has guid %u", GetGUIDLow());
+    TC_LOG_DEBUG(LOG_FILTER_PETS, "New Pet has guid %u", GetGUIDLow());
 
     owner->PetSpellInitialize();
 
@@ -403,10 +405,16 @@ bool Pet::LoadPetFromDB(Player* owner, uint32 petentry, uint32 petnumber, bool c
 
     if (getPetType() == HUNTER_PET)
     {
-        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PET_DECLINED_NAME);
-        stmt->setUInt32(0, owner->GetGUIDLow());
-        stmt->setUInt32(1, GetCharmInfo()->GetPetNumber());
-        PreparedQueryResult result = CharacterDatabase.Query(stmt);
+        PreparedQueryResult result;
+        if (holder)
+            result = holder->GetPreparedResult(PET_LOGIN_QUERY_LOADDECLINEDNAME);
+        else
+        {
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PET_DECLINED_NAME);
+            stmt->setUInt32(0, owner->GetGUIDLow());
+            stmt->setUInt32(1, GetCharmInfo()->GetPetNumber());
+            result = CharacterDatabase.Query(stmt);
+        }
 
         if (result)
         {
@@ -916,7 +924,7 @@ bool Pet::CreateBaseAtCreatureInfo(CreatureTemplate const* cinfo, Unit* owner)
 
 bool Pet::CreateBaseAtTamed(CreatureTemplate const* cinfo, Map* map, uint32 phaseMask)
 {
-    sLog->outDebug(LOG_FILTER_PETS, "Pet::CreateBaseForTamed");
+    TC_LOG_DEBUG(LOG_FILTER_PETS, "Pet::CreateBaseForTamed");
     uint32 guid=sObjectMgr->GenerateLowGuid(HIGHGUID_PET);
     uint32 pet_number = sObjectMgr->GeneratePetNumber();
     if (!Create(guid, map, phaseMask, cinfo->Entry, pet_number))
@@ -1500,7 +1508,7 @@ uint32 Pet::GetCurrentFoodBenefitLevel(uint32 itemlevel)
         return 0;                                             // food too low level
 }
 
-void Pet::_LoadSpellCooldowns(PreparedQueryResult resultCooldown, bool login)
+void Pet::_LoadSpellCooldowns(PreparedQueryResult resultCooldown, bool prefetched)
 {
     m_CreatureSpellCooldowns.clear();
     m_CreatureCategoryCooldowns.clear();
@@ -1508,7 +1516,7 @@ void Pet::_LoadSpellCooldowns(PreparedQueryResult resultCooldown, bool login)
     PreparedQueryResult result = resultCooldown;
     Player* owner = GetOwner() ? GetOwner()->ToPlayer() : NULL;
 
-    if (!login)
+    if (!prefetched)
     {
         PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PET_SPELL_COOLDOWN);
         stmt->setUInt32(0, m_charmInfo->GetPetNumber());
@@ -1561,7 +1569,7 @@ void Pet::_LoadSpellCooldowns(PreparedQueryResult resultCooldown, bool login)
 
             _AddCreatureSpellCooldown(spell_id, db_time);
 
-            sLog->outDebug(LOG_FILTER_PETS, "Pet (Number: %u) spell %u cooldown loaded (%u secs).", m_charmInfo->GetPetNumber(), spell_id, uint32(db_time-curTime));
+            TC_LOG_DEBUG(LOG_FILTER_PETS, "Pet (Number: %u) spell %u cooldown loaded (%u secs).", m_charmInfo->GetPetNumber(), spell_id, uint32(db_time-curTime));
         }
         while (result->NextRow());
     }
@@ -1593,11 +1601,11 @@ void Pet::_SaveSpellCooldowns(SQLTransaction& trans)
     }
 }
 
-void Pet::_LoadSpells(PreparedQueryResult resultSpell, bool login)
+void Pet::_LoadSpells(PreparedQueryResult resultSpell, bool prefetched)
 {
     PreparedQueryResult result = resultSpell;
 
-    if (!login)
+    if (!prefetched)
     {
         PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PET_SPELL);
         stmt->setUInt32(0, m_charmInfo->GetPetNumber());
@@ -1665,14 +1673,14 @@ void Pet::_SaveSpells(SQLTransaction& trans)
     }
 }
 
-void Pet::_LoadAuras(PreparedQueryResult auraResult, PreparedQueryResult auraEffectResult, uint32 timediff, bool login)
+void Pet::_LoadAuras(PreparedQueryResult auraResult, PreparedQueryResult auraEffectResult, uint32 timediff, bool prefetched)
 {
-    sLog->outDebug(LOG_FILTER_PETS, "Loading auras for pet %u", GetGUIDLow());
+    TC_LOG_DEBUG(LOG_FILTER_PETS, "Loading auras for pet %u", GetGUIDLow());
     
     PreparedQueryResult result = auraResult;
     PreparedQueryResult resultEffect = auraEffectResult;
 
-    if (!login)
+    if (!prefetched)
     {
         PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PET_AURA);
         stmt->setUInt32(0, m_charmInfo->GetPetNumber());
@@ -66,6 +66,7 @@ class PlayerSocial;
 class SpellCastTargets;
 class UpdateMask;
 class PhaseMgr;
+class AnticheatSampleRing;
 
 typedef std::deque<Mail*> PlayerMails;
 
@@ -920,16 +921,18 @@ enum PlayerLoginQueryIndex
     MAX_PLAYER_LOGIN_QUERY
 };
 
+// Without result of the pet row, the holder also selects it by pet number
 class PetLoginQueryHolder : public SQLQueryHolder
 {
     private:
+        uint32 m_ownerGuid;
         uint32 m_guid;
         PreparedQueryResult m_petResult;
     public:
-        PetLoginQueryHolder(uint32 guid, PreparedQueryResult result)
-            : m_guid(guid), m_petResult(result) { }
+        PetLoginQueryHolder(uint32 ownerGuid, uint32 guid, PreparedQueryResult result = PreparedQueryResult())
+            : m_ownerGuid(ownerGuid), m_guid(guid), m_petResult(result) { }
         uint32 GetGuid() const { return m_guid; }
-        PreparedQueryResult GetPetResult() const { return m_petResult; }
+        PreparedQueryResult GetPetResult();
         bool Initialize();
 };
 
@@ -939,7 +942,9 @@ enum PetLoginQueryIndex
     PET_LOGIN_QUERY_LOADAURAEFFECT                  = 1,
     PET_LOGIN_QUERY_LOADSPELL                       = 2,
     PET_LOGIN_QUERY_LOADSPELLCOOLDOWN               = 3,
-    MAX_PET_LOGIN_QUERY                             = 4
+    PET_LOGIN_QUERY_LOADDECLINEDNAME                = 4,
+    PET_LOGIN_QUERY_LOADPET                         = 5,    // last, only queued without pet result
+    MAX_PET_LOGIN_QUERY                             = 6
 };
 
 enum PlayerDelayedOperations
@@ -1307,7 +1312,9 @@ class Player : public Unit, public GridObject<Player>
 
         SceneMgr& GetSceneMgr() { return m_sceneMgr; }
 
-        //AnticheatData anticheatData;
+        // movement samples of the anticheat analyzer, NULL while not logged in
+        AnticheatSampleRing* GetAnticheatSamples() const { return m_anticheatSamples; }
+        void SetAnticheatSamples(AnticheatSampleRing* samples) { m_anticheatSamples = samples; }
 
         void CleanupsBeforeDelete(bool finalCleanup = true);
 
@@ -1628,6 +1635,8 @@ class Player : public Unit, public GridObject<Player>
         void SendItemDurations();
         void LoadCorpse();
         void LoadPet(PreparedQueryResult result);
+        // loads the pet from the character database without blocking, the pet appears once its data arrived
+        bool LoadPetAsync(uint32 petNumber, PetType petType, bool revive);
 
         bool AddItem(uint32 itemId, uint32 count, uint32* noSpaceForCount = NULL);
 
@@ -3067,6 +3076,7 @@ class Player : public Unit, public GridObject<Player>
         void HandleStoreItemCallback(PreparedQueryResult result);
         void HandleStoreLevelCallback(PreparedQueryResult result);
         void HandleStoreGoldCallback(PreparedQueryResult result);
+        void HandlePetLoadCallback(PetLoginQueryHolder* holder);
 
         void CheckSpellAreaOnQuestStatusChange(uint32 quest_id);
 
@@ -3415,6 +3425,8 @@ class Player : public Unit, public GridObject<Player>
         uint32 m_lastFallTime;
         float  m_lastFallZ;
 
+        AnticheatSampleRing* m_anticheatSamples;
+
         int32 m_MirrorTimer[MAX_TIMERS];
         uint8 m_MirrorTimerFlags;
         uint8 m_MirrorTimerFlagsLast;
@@ -3477,6 +3489,10 @@ class Player : public Unit, public GridObject<Player>
         PreparedQueryResultFuture _storeLevelCallback;
         PreparedQueryResultFuture _petPreloadCallback;
         QueryResultHolderFuture _petLoginCallback;
+        QueryResultHolderFuture _petLoadCallback;
+        uint32 _petLoadNumber;                          // pet of _petLoadCallback, 0 if none
+        PetType _petLoadType;
+        bool _petLoadRevive;                            // resurrected at full health once loaded
 
         SkyMistCore::SpellChargesTracker spellChargesTracker_;
 
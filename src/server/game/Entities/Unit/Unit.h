@@ -1207,6 +1207,33 @@ enum Stagger
 
 struct SpellProcEventEntry;                                 // used only privately
 
+enum AuraModifierCacheFlags
+{
+    AURA_MOD_CACHE_TOTAL            = 0x01,
+    AURA_MOD_CACHE_MULTIPLIER       = 0x02,
+    AURA_MOD_CACHE_MAX_POSITIVE     = 0x04,
+    AURA_MOD_CACHE_MAX_NEGATIVE     = 0x08
+};
+
+// Aggregates of the effects of one aura type on a unit, computed on first use
+// and dropped when an effect of that type is applied, removed or changes amount
+struct AuraModifierCache
+{
+    AuraModifierCache() : flags(0), total(0), multiplier(1.0f), maxPositive(0), maxNegative(0) { }
+
+    uint8 flags;                                            // AuraModifierCacheFlags
+    int32 total;
+    float multiplier;
+    int32 maxPositive;
+    int32 maxNegative;
+
+    // by misc mask / misc value asked since the last change, few per type
+    std::vector<std::pair<uint32, int32> > totalByMiscMask;
+    std::vector<std::pair<uint32, float> > multiplierByMiscMask;
+    std::vector<std::pair<int32, int32> > totalByMiscValue;
+    std::vector<std::pair<int32, float> > multiplierByMiscValue;
+};
+
 class Unit : public WorldObject
 {
     public:
@@ -1795,6 +1822,7 @@ class Unit : public WorldObject
         void _RemoveNoStackAurasDueToAura(AuraPtr aura);
         bool _IsNoStackAuraDueToAura(AuraPtr appliedAura, AuraPtr existingAura) const;
         void _RegisterAuraEffect(AuraEffectPtr aurEff, bool apply);
+        void InvalidateAuraModifierCache(AuraType type) { m_auraModifierCache.erase(type); }
 
         // m_ownedAuras container management
         AuraMap      & GetOwnedAuras()       { return m_ownedAuras; }
@@ -2335,6 +2363,8 @@ class Unit : public WorldObject
         explicit Unit (bool isWorldObject);
         
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const;
+        bool IsViewerDependentField(uint16 index) const;
+        uint32 GetViewerDependentFieldValue(uint16 index, Player* target) const;
 
         UnitAI* i_AI, *i_disabledAI;
 
@@ -2376,6 +2406,7 @@ class Unit : public WorldObject
         uint32 m_removedAurasCount;
 
         AuraEffectList m_modAuras[TOTAL_AURAS];
+        mutable UNORDERED_MAP<uint32, AuraModifierCache> m_auraModifierCache;    // by AuraType, see GetTotalAuraModifier
         AuraList m_scAuras;                        // casted singlecast auras
         AuraApplicationList m_interruptableAuras;             // auras which have interrupt mask applied on unit
         AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
@@ -62,7 +62,7 @@
 #include "Vehicle.h"
 #include "World.h"
 #include "WorldPacket.h"
-#include "MovementStructures.h"
+#include "MovementCodec.h"
 #include "WorldSession.h"
 
 #include <math.h>
@@ -305,8 +305,8 @@ bool Unit::IsSplineEnabled() const
 
 void Unit::WriteMovementInfo(WorldPacket &data, ExtraMovementStatusElement* extras) const
 {
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(data.GetOpcode());
-    if (!sequence)
+    MovementCodec const* codec = GetMovementCodec(data.GetOpcode());
+    if (!codec)
     {
         //sLog->outError(LOG_FILTER_NETWORKIO, "WorldSession::WriteMovementInfo: No movement sequence found for opcode 0x%04X", uint32(data.GetOpcode()));
         return;
@@ -314,214 +314,20 @@ void Unit::WriteMovementInfo(WorldPacket &data, ExtraMovementStatusElement* extr
 
     MovementInfo const* mi = &m_movementInfo;
 
-    bool hasMovementFlags = mi->GetMovementFlags() != 0;
-    bool hasMovementFlags2 = mi->GetExtraMovementFlags() != 0;
-    bool hasTransportData = mi->t_guid != 0LL;
-    bool hasSpline = IsSplineEnabled();
+    MovementWriteState state(data, mi, extras);
+    state.hasMovementFlags = mi->GetMovementFlags() != 0;
+    state.hasMovementFlags2 = mi->GetExtraMovementFlags() != 0;
+    state.hasTransportData = mi->t_guid != 0LL;
+    state.hasSpline = IsSplineEnabled();
 
     // Fix player movement visibility during being CC-ed.
-    if (GetTypeId() == TYPEID_PLAYER && IsInCC() && !hasSpline)
-        hasSpline = true;
+    if (GetTypeId() == TYPEID_PLAYER && IsInCC() && !state.hasSpline)
+        state.hasSpline = true;
 
-    ObjectGuid guid = mi->guid;
-    ObjectGuid tguid = mi->t_guid;
+    state.guid = mi->guid;
+    state.tguid = mi->t_guid;
 
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-        if (element == MSEEnd)
-            break;
-
-        if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
-        {
-            data.WriteBit(guid[element - MSEHasGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSEHasTransportGuidByte0 &&
-            element <= MSEHasTransportGuidByte7)
-        {
-            if (hasTransportData)
-                data.WriteBit(tguid[element - MSEHasTransportGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
-        {
-            data.WriteByteSeq(guid[element - MSEGuidByte0]);
-            continue;
-        }
-
-        if (element >= MSETransportGuidByte0 &&
-            element <= MSETransportGuidByte7)
-        {
-            if (hasTransportData)
-                data.WriteByteSeq(tguid[element - MSETransportGuidByte0]);
-            continue;
-        }
-
-        switch (element)
-        {
-            case MSEExtraElement:
-                extras->WriteNextElement(data);
-                break;
-            case MSEUnkUIntCount:
-                data.WriteBits(0, 22);
-                break;
-            case MSEUnkUIntLoop:
-                for (uint8 m = 0; m < 0; ++m)
-                {
-                    data << uint32(0);
-                }
-                break;
-            case MSECounter:
-                data << uint32(0); // movement counter
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            case MSEHasMovementFlags:
-                data.WriteBit(!hasMovementFlags);
-                break;
-            case MSEHasMovementFlags2:
-                data.WriteBit(!hasMovementFlags2);
-                break;
-            case MSEHasTimestamp:
-                data.WriteBit(!mi->time);
-                break;
-            case MSEHasOrientation:
-                data.WriteBit(!mi->pos.HasOrientation());
-                break;
-            case MSEHasTransportData:
-                data.WriteBit(hasTransportData);
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    data.WriteBit(mi->has_t_time2);
-                break;
-            case MSEHasTransportTime3:
-                if (hasTransportData)
-                    data.WriteBit(mi->has_t_time3);
-                break;
-            case MSEHasPitch:
-                data.WriteBit(!mi->HavePitch);
-                break;
-            case MSEHasFallData:
-                data.WriteBit(mi->hasFallData);
-                break;
-            case MSEHasFallDirection:
-                if (mi->hasFallData)
-                    data.WriteBit(mi->hasFallDirection);
-                break;
-            case MSEHasSplineElevation:
-                data.WriteBit(!mi->HaveSplineElevation);
-                break;
-            case MSEHasSpline:
-                data.WriteBit(hasSpline);
-                break;
-            case MSEMovementFlags:
-                if (hasMovementFlags)
-                    data.WriteBits(mi->flags, 30);
-                break;
-            case MSEMovementFlags2:
-                if (hasMovementFlags2)
-                    data.WriteBits(mi->flags2, 13);
-                break;
-            case MSETimestamp:
-                if (mi->time)
-                    data << mi->time;
-                break;
-            case MSEPositionX:
-                data << mi->pos.m_positionX;
-                break;
-            case MSEPositionY:
-                data << mi->pos.m_positionY;
-                break;
-            case MSEPositionZ:
-                data << mi->pos.m_positionZ;
-                break;
-            case MSEOrientation:
-                if (mi->pos.HasOrientation())
-                    data << mi->pos.GetOrientation();
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data << mi->t_pos.m_positionX;
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data << mi->t_pos.m_positionY;
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data << mi->t_pos.m_positionZ;
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    data << mi->t_pos.GetOrientation();
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data << mi->t_seat;
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data << mi->t_time;
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && mi->has_t_time2)
-                    data << mi->t_time2;
-                break;
-            case MSETransportTime3:
-                if (hasTransportData && mi->has_t_time3)
-                    data << mi->t_time3;
-                break;
-            case MSEPitch:
-                if (mi->HavePitch)
-                    data << mi->pitch;
-                break;
-            case MSEFallTime:
-                if (mi->hasFallData)
-                    data << mi->fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (mi->hasFallData)
-                    data << mi->j_zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data << mi->j_cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data << mi->j_sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (mi->hasFallData && mi->hasFallDirection)
-                    data << mi->j_xyspeed;
-                break;
-            case MSESplineElevation:
-                if (mi->HaveSplineElevation)
-                    data << mi->splineElevation;
-                break;
-            case MSEZeroBit:
-                data.WriteBit(0);
-                break;
-            case MSEOneBit:
-                data.WriteBit(1);
-                break;
-            case MSEHasUnkTime:
-                data.WriteBit(!mi->Alive32);
-                break;
-            case MSEUnkTime:
-                if (mi->Alive32)
-                    data << mi->Alive32;
-                break;
-            default:
-                ASSERT(false && "Incorrect sequence element detected at WriteMovementInfo");
-                break;
-        }
-    }
+    codec->Write(state);
 }
 
 void Unit::MonsterMoveWithSpeed(float x, float y, float z, float speed)
@@ -230,19 +230,6 @@ class ObjectAccessor
 
         static void SaveAllPlayers();
 
-        //non-static functions
-        void AddUpdateObject(Object* obj)
-        {
-            TRINITY_GUARD(ACE_Thread_Mutex, i_objectLock);
-            i_objects.insert(obj);
-        }
-
-        void RemoveUpdateObject(Object* obj)
-        {
-            TRINITY_GUARD(ACE_Thread_Mutex, i_objectLock);
-            i_objects.erase(obj);
-        }
-
         //Thread safe
         Corpse* GetCorpseForPlayerGUID(uint64 guid);
         void RemoveCorpse(Corpse* corpse);
@@ -251,7 +238,6 @@ class ObjectAccessor
         Corpse* ConvertCorpseForPlayer(uint64 player_guid, bool insignia = false);
 
         //Thread unsafe
-        void Update(uint32 diff);
         void RemoveOldCorpses();
         void UnloadAll();
 
@@ -263,10 +249,8 @@ class ObjectAccessor
         typedef UNORDERED_MAP<uint64, Corpse*> Player2CorpsesMapType;
         typedef UNORDERED_MAP<Player*, UpdateData>::value_type UpdateDataValueType;
 
-        std::set<Object*> i_objects;
         Player2CorpsesMapType i_player2corpse;
 
-        ACE_Thread_Mutex i_objectLock;
         ACE_RW_Thread_Mutex i_corpseLock;
 };
 
@@ -28,8 +28,12 @@
 #include "CellImpl.h"
 #include "SpellInfo.h"
 
+#include <ace/TSS_T.h>
+
 using namespace SkyMistCore;
 
+static ACE_TSS<WorldObjectPositionBatch> threadPositionBatch;
+
 void VisibleNotifier::SendToSelf()
 {
     // at this moment i_clientGUIDs have guids that not iterate at grid level checks
@@ -275,6 +279,46 @@ bool AnyDeadUnitSpellTargetInRangeCheck::operator()(Creature* u)
     return AnyDeadUnitObjectInRangeCheck::operator()(u) && i_check(u);
 }
 
+WorldObjectPositionBatch* WorldObjectPositionBatch::Acquire()
+{
+    WorldObjectPositionBatch* batch = threadPositionBatch;
+    if (batch->busy)
+        return NULL;
+
+    batch->busy = true;
+    return batch;
+}
+
+void WorldObjectPositionBatch::FilterRange(Position const* center, float range)
+{
+    size_t count = objects.size();
+    inRange.resize(count);
+    if (!count)
+        return;
+
+    float const cx = center->GetPositionX();
+    float const cy = center->GetPositionY();
+    float const cz = center->GetPositionZ();
+    // the check tests the range again, the margin only keeps float rounding from rejecting objects at the border
+    float const maxDist = range + 0.01f;
+
+    float const* px = &x[0];
+    float const* py = &y[0];
+    float const* pz = &z[0];
+    float const* psize = &size[0];
+    uint8* result = &inRange[0];
+
+    // no branch and no call in the loop body, the compiler vectorizes it
+    for (size_t i = 0; i < count; ++i)
+    {
+        float dx = px[i] - cx;
+        float dy = py[i] - cy;
+        float dz = pz[i] - cz;
+        float dist = maxDist + psize[i];
+        result[i] = uint8(dx * dx + dy * dy + dz * dz < dist * dist);
+    }
+}
+
 template void ObjectUpdater::Visit<GameObject>(GameObjectMapType &);
 template void ObjectUpdater::Visit<DynamicObject>(DynamicObjectMapType &);
 template void ObjectUpdater::Visit<AreaTrigger>(AreaTriggerMapType &);
@@ -268,6 +268,64 @@ namespace SkyMistCore
         template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
     };
 
+    // Objects of one cell container with their positions laid out by coordinate,
+    // so the range test runs as one flat loop before any per object check
+    struct WorldObjectPositionBatch
+    {
+        WorldObjectPositionBatch() : busy(false) {}
+
+        // batch of the calling thread, or NULL if a search of this thread already uses it
+        static WorldObjectPositionBatch* Acquire();
+        void Release() { busy = false; }
+
+        template<class T> void Fill(GridRefManager<T> &m);
+        // inRange[i] is set for the objects which may be within range of center (object size included)
+        void FilterRange(Position const* center, float range);
+
+        std::vector<WorldObject*> objects;
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+        std::vector<float> size;
+        std::vector<uint8> inRange;
+        bool busy;
+    };
+
+    // WorldObjectListSearcher for checks with a range around a position (spell area, cone, chain checks):
+    // the check is only called for the objects passing the batched range test
+    template<class Check>
+    struct WorldObjectRangeListSearcher
+    {
+        uint32 i_mapTypeMask;
+        std::vector<WorldObject*> &i_objects;
+        Check& i_check;
+        Position const* i_center;
+        float i_range;
+        WorldObjectPositionBatch* i_batch;
+        WorldObjectPositionBatch i_ownBatch;                // nested search only
+
+        WorldObjectRangeListSearcher(std::vector<WorldObject*> &objects, Check & check, Position const* center, float range, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
+            : i_mapTypeMask(mapTypeMask), i_objects(objects), i_check(check), i_center(center), i_range(range), i_batch(WorldObjectPositionBatch::Acquire())
+        {
+            if (!i_batch)
+                i_batch = &i_ownBatch;
+        }
+
+        ~WorldObjectRangeListSearcher() { i_batch->Release(); }
+
+        void Visit(PlayerMapType &m) { VisitInRange(m, GRID_MAP_TYPE_MASK_PLAYER); }
+        void Visit(CreatureMapType &m) { VisitInRange(m, GRID_MAP_TYPE_MASK_CREATURE); }
+        void Visit(CorpseMapType &m) { VisitInRange(m, GRID_MAP_TYPE_MASK_CORPSE); }
+        void Visit(GameObjectMapType &m) { VisitInRange(m, GRID_MAP_TYPE_MASK_GAMEOBJECT); }
+        void Visit(DynamicObjectMapType &m) { VisitInRange(m, GRID_MAP_TYPE_MASK_DYNAMICOBJECT); }
+        void Visit(AreaTriggerMapType &m) { VisitInRange(m, GRID_MAP_TYPE_MASK_AREATRIGGER); }
+
+        template<class NOT_INTERESTED> void Visit(GridRefManager<NOT_INTERESTED> &) {}
+
+        private:
+            template<class T> void VisitInRange(GridRefManager<T> &m, uint32 typeMask);
+    };
+
     template<class Do>
     struct WorldObjectWorker
     {
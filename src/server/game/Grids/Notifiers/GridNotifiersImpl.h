@@ -348,6 +348,41 @@ void SkyMistCore::WorldObjectListSearcher<Check>::Visit(AreaTriggerMapType &m)
             i_objects.push_back(itr->getSource());
 }
 
+template<class T>
+void SkyMistCore::WorldObjectPositionBatch::Fill(GridRefManager<T> &m)
+{
+    objects.clear();
+    x.clear();
+    y.clear();
+    z.clear();
+    size.clear();
+
+    for (typename GridRefManager<T>::iterator itr = m.begin(); itr != m.end(); ++itr)
+    {
+        T* object = itr->getSource();
+        objects.push_back(object);
+        x.push_back(object->GetPositionX());
+        y.push_back(object->GetPositionY());
+        z.push_back(object->GetPositionZ());
+        size.push_back(object->GetObjectSize());
+    }
+}
+
+template<class Check>
+template<class T>
+void SkyMistCore::WorldObjectRangeListSearcher<Check>::VisitInRange(GridRefManager<T> &m, uint32 typeMask)
+{
+    if (!(i_mapTypeMask & typeMask) || m.isEmpty())
+        return;
+
+    i_batch->Fill(m);
+    i_batch->FilterRange(i_center, i_range);
+
+    for (size_t i = 0; i < i_batch->objects.size(); ++i)
+        if (i_batch->inRange[i] && i_check(i_batch->objects[i]))
+            i_objects.push_back(i_batch->objects[i]);
+}
+
 // Gameobject searchers
 
 template<class Check>
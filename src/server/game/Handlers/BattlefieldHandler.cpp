@@ -337,7 +337,7 @@ void WorldSession::HandleBfQueueRequest(WorldPacket& recvData)
 
 void WorldSession::HandleBfPortOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_BATTLEFIELD_PORT Message");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_BATTLEFIELD_PORT Message");
 }
 
 void WorldSession::HandleBfExitQueueRequest(WorldPacket& recvData)
@@ -22,7 +22,7 @@
 
 void WorldSession::HandleJoinChannel(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     uint32 channelId;
     uint32 channelLength = 0;
@@ -78,7 +78,7 @@ void WorldSession::HandleJoinChannel(WorldPacket& recvPacket)
 
 void WorldSession::HandleLeaveChannel(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     uint32 channelId;
     std::string channelname;
@@ -104,7 +104,7 @@ void WorldSession::HandleLeaveChannel(WorldPacket& recvPacket)
 
 void WorldSession::HandleChannelList(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     uint32 length = recvPacket.ReadBits(7);
 
@@ -129,7 +129,7 @@ void WorldSession::HandleChannelPassword(WorldPacket& recvPacket)
     else
         timeLastChannelPassCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     uint32 passLength = recvPacket.ReadBits(7);
     uint32 nameLength = recvPacket.ReadBits(7);
@@ -153,7 +153,7 @@ void WorldSession::HandleChannelSetOwner(WorldPacket& recvPacket)
     else
        timeLastChannelSetownerCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     uint32 channelLength = recvPacket.ReadBits(7);
     uint32 nameLength = recvPacket.ReadBits(9);
@@ -180,7 +180,7 @@ void WorldSession::HandleChannelModerator(WorldPacket& recvPacket)
     else
        timeLastChannelModerCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t channelLength = recvPacket.ReadBits(7);
     size_t nameLength = recvPacket.ReadBits(9);
@@ -207,7 +207,7 @@ void WorldSession::HandleChannelUnmoderator(WorldPacket& recvPacket)
     else
        timeLastChannelUnmoderCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t channelLength = recvPacket.ReadBits(7);
     size_t nameLength = recvPacket.ReadBits(9);
@@ -234,7 +234,7 @@ void WorldSession::HandleChannelMute(WorldPacket& recvPacket)
     else
         timeLastChannelMuteCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t nameLength = recvPacket.ReadBits(9);
     size_t channelLength = recvPacket.ReadBits(7);
@@ -261,7 +261,7 @@ void WorldSession::HandleChannelUnmute(WorldPacket& recvPacket)
     else
        timeLastChannelUnmuteCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t nameLength = recvPacket.ReadBits(9);
     size_t channelLength = recvPacket.ReadBits(7);
@@ -288,7 +288,7 @@ void WorldSession::HandleChannelInvite(WorldPacket& recvPacket)
     else
        timeLastChannelInviteCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t nameLength = recvPacket.ReadBits(9);
     size_t channelLength = recvPacket.ReadBits(7);
@@ -318,7 +318,7 @@ void WorldSession::HandleChannelKick(WorldPacket& recvPacket)
     else
        timeLastChannelKickCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t channelLength = recvPacket.ReadBits(7);
     size_t nameLength = recvPacket.ReadBits(9);
@@ -345,7 +345,7 @@ void WorldSession::HandleChannelBan(WorldPacket& recvPacket)
     else
        timeLastChannelBanCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
     uint32 channelLength, nameLength;
     std::string channelname, otp;
 
@@ -374,7 +374,7 @@ void WorldSession::HandleChannelUnban(WorldPacket& recvPacket)
     else
        timeLastChannelUnbanCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     size_t nameLength = recvPacket.ReadBits(9);
     size_t channelLength = recvPacket.ReadBits(7);
@@ -401,7 +401,7 @@ void WorldSession::HandleChannelAnnouncements(WorldPacket& recvPacket)
     else
        timeLastChannelAnnounceCommand = now;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     uint32 length = recvPacket.ReadBits(7);
 
@@ -416,7 +416,7 @@ void WorldSession::HandleChannelAnnouncements(WorldPacket& recvPacket)
 
 void WorldSession::HandleGetChannelMemberCount(WorldPacket &recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     std::string channelname;
 
@@ -439,7 +439,7 @@ void WorldSession::HandleGetChannelMemberCount(WorldPacket &recvPacket)
 
 void WorldSession::HandleSetChannelWatch(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Opcode %u", recvPacket.GetOpcode());
 
     std::string channelname;
 
@@ -38,7 +38,7 @@ void WorldSession::HandleAttackSwingOpcode(WorldPacket& recvData)
     uint8 bytesOrder[8] = { 1, 2, 5, 7, 0, 3, 6, 4 };
     recvData.ReadBytesSeq(guid, bytesOrder);
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_ATTACKSWING Message guidlow:%u guidhigh:%u", GUID_LOPART(guid), GUID_HIPART(guid));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Recvd CMSG_ATTACKSWING Message guidlow:%u guidhigh:%u", GUID_LOPART(guid), GUID_HIPART(guid));
 
     Unit* pEnemy = ObjectAccessor::GetUnit(*_player, guid);
 
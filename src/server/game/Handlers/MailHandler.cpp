@@ -334,7 +334,7 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
 // Called when mail is read
 void WorldSession::HandleMailMarkAsRead(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_MARK_AS_READ");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_MARK_AS_READ");
 
     ObjectGuid mailbox;
     uint32 mailId;
@@ -374,7 +374,7 @@ void WorldSession::HandleMailMarkAsRead(WorldPacket& recvData)
 // Called when client deletes mail
 void WorldSession::HandleMailDelete(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_DELETE");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_DELETE");
 
     uint32 mailId;
     recvData.read_skip<uint32>();
@@ -399,7 +399,7 @@ void WorldSession::HandleMailDelete(WorldPacket& recvData)
 
 void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_RETURN_TO_SENDER");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_RETURN_TO_SENDER");
 
     ObjectGuid owner;
     uint32 mailId;
@@ -471,7 +471,7 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
 // Called when player takes item attached in mail
 void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_ITEM");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_ITEM");
 
     ObjectGuid mailbox;
     uint32 mailId;
@@ -580,7 +580,7 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 
 void WorldSession::HandleMailTakeMoney(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_MONEY");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_TAKE_MONEY");
 
     ObjectGuid mailbox;
     uint64 money;
@@ -634,7 +634,7 @@ void WorldSession::HandleMailTakeMoney(WorldPacket& recvData)
 // Called when player lists his received mails
 void WorldSession::HandleGetMailList(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_GET_MAIL_LIST");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_GET_MAIL_LIST");
 
     ObjectGuid mailBoxGuid;
 
@@ -824,7 +824,7 @@ void WorldSession::HandleGetMailList(WorldPacket& recvData)
 // Used when player copies mail body to his inventory
 void WorldSession::HandleMailCreateTextItem(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_CREATE_TEXT_ITEM");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: CMSG_MAIL_CREATE_TEXT_ITEM");
 
     ObjectGuid mailbox;
     uint32 mailId;
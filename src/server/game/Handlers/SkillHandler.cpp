@@ -91,7 +91,7 @@ void WorldSession::HandleLearnTalents(WorldPacket& recvData)
 
 void WorldSession::HandleTalentWipeConfirmOpcode(WorldPacket& recvData)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "CMSG_CONFIRM_RESPEC_WIPE");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "CMSG_CONFIRM_RESPEC_WIPE");
 
     uint8 specializationReset = recvData.read<uint8>();
 
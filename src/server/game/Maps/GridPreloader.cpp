@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPreloader.h"
+#include "Map.h"
+#include "NavTile.h"
+#include "World.h"
+#include "VMapFactory.h"
+#include "VMapManager2.h"
+#include "Timer.h"
+#include "Log.h"
+
+#include <ace/Guard_T.h>
+
+PreloadedGrid::~PreloadedGrid()
+{
+    delete gridMap;
+    delete navTile;
+
+    if (!vmapModels.empty())
+        static_cast<VMAP::VMapManager2*>(VMAP::VMapFactory::createOrGetVMapManager())->releasePreloadedModels(vmapModels);
+}
+
+GridPreloader::GridPreloader():
+m_lock(), m_condition(m_lock), m_activated(false), m_shutdown(false)
+{
+}
+
+GridPreloader::~GridPreloader()
+{
+    deactivate();
+}
+
+int GridPreloader::activate(size_t num_threads)
+{
+    if (m_activated || num_threads < 1)
+        return -1;
+
+    m_shutdown = false;
+
+    if (ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(num_threads)) == -1)
+        return -1;
+
+    m_activated = true;
+    return 0;
+}
+
+int GridPreloader::deactivate()
+{
+    if (!m_activated)
+        return -1;
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        m_shutdown = true;
+        m_condition.broadcast();
+    }
+
+    ACE_Task_Base::wait();
+    m_activated = false;
+
+    // workers are gone, nobody else touches the entries
+    for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+        delete itr->second.grid;
+
+    m_entries.clear();
+    m_queue.clear();
+    return 0;
+}
+
+void GridPreloader::Request(uint32 mapId, int gx, int gy)
+{
+    if (!m_activated)
+        return;
+
+    uint32 key = MakeKey(mapId, gx, gy);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    if (m_entries.size() >= GRID_PRELOAD_MAX_PENDING || m_entries.find(key) != m_entries.end())
+        return;
+
+    m_entries[key] = Entry();
+    m_queue.push_back(key);
+    ++m_stats.requests;
+    m_condition.signal();
+}
+
+PreloadedGrid* GridPreloader::Take(uint32 mapId, int gx, int gy)
+{
+    if (!m_activated)
+        return NULL;
+
+    uint32 key = MakeKey(mapId, gx, gy);
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    EntryMap::iterator itr = m_entries.find(key);
+    if (itr == m_entries.end())
+    {
+        ++m_stats.misses;
+        return NULL;
+    }
+
+    PreloadedGrid* grid = NULL;
+    switch (itr->second.state)
+    {
+        case PRELOAD_READY:
+            grid = itr->second.grid;
+            m_entries.erase(itr);
+            ++m_stats.hits;
+            break;
+        case PRELOAD_QUEUED:
+            m_entries.erase(itr);                           // key left in the queue is skipped
+            ++m_stats.late;
+            break;
+        case PRELOAD_LOADING:
+            itr->second.state = PRELOAD_CANCELLED;
+            ++m_stats.late;
+            break;
+        case PRELOAD_CANCELLED:
+            break;
+    }
+
+    return grid;
+}
+
+void GridPreloader::Update()
+{
+    if (!m_activated)
+        return;
+
+    std::vector<PreloadedGrid*> expired;
+    uint32 now = getMSTime();
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        for (EntryMap::iterator itr = m_entries.begin(); itr != m_entries.end();)
+        {
+            if (itr->second.state == PRELOAD_READY && getMSTimeDiff(itr->second.grid->readyTime, now) > GRID_PRELOAD_EXPIRY)
+            {
+                expired.push_back(itr->second.grid);
+                m_entries.erase(itr++);
+            }
+            else
+                ++itr;
+        }
+    }
+
+    for (std::vector<PreloadedGrid*>::const_iterator itr = expired.begin(); itr != expired.end(); ++itr)
+    {
+        delete *itr;
+        ++m_stats.expired;
+    }
+}
+
+void GridPreloader::Load(uint32 key, PreloadedGrid& grid)
+{
+    uint32 mapId = key >> 12;
+    int gx = int((key >> 6) & 63);
+    int gy = int(key & 63);
+
+    std::string const& dataPath = sWorld->GetDataPath();
+    char fileName[512];
+
+    snprintf(fileName, sizeof(fileName), "%smaps/%03u%02u%02u.map", dataPath.c_str(), mapId, gx, gy);
+    grid.gridMap = new GridMap();
+    if (!grid.gridMap->loadData(fileName))
+    {
+        // let the map load it again and report the error
+        delete grid.gridMap;
+        grid.gridMap = NULL;
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_ENABLE_MMAPS))
+    {
+        snprintf(fileName, sizeof(fileName), "%smmaps/%03u%02u%02u.mmtile", dataPath.c_str(), mapId, gx, gy);
+        grid.navTile = new NavTile();
+        if (!grid.navTile->loadData(fileName, mapId, gx, gy))
+        {
+            delete grid.navTile;
+            grid.navTile = NULL;
+        }
+    }
+
+    VMAP::VMapManager2* vmgr = static_cast<VMAP::VMapManager2*>(VMAP::VMapFactory::createOrGetVMapManager());
+    vmgr->preloadMapTile((dataPath + "vmaps").c_str(), mapId, gx, gy, grid.vmapModels);
+}
+
+int GridPreloader::svc()
+{
+    for (;;)
+    {
+        uint32 key;
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            while (m_queue.empty() && !m_shutdown)
+                m_condition.wait();
+
+            if (m_shutdown)
+                break;
+
+            key = m_queue.front();
+            m_queue.pop_front();
+
+            EntryMap::iterator itr = m_entries.find(key);
+            if (itr == m_entries.end() || itr->second.state != PRELOAD_QUEUED)
+                continue;
+
+            itr->second.state = PRELOAD_LOADING;
+        }
+
+        PreloadedGrid* grid = new PreloadedGrid();
+        Load(key, *grid);
+        grid->readyTime = getMSTime();
+
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            EntryMap::iterator itr = m_entries.find(key);
+            if (itr != m_entries.end() && itr->second.state == PRELOAD_LOADING)
+            {
+                itr->second.state = PRELOAD_READY;
+                itr->second.grid = grid;
+                continue;
+            }
+
+            // the map loaded the grid itself in the meantime
+            if (itr != m_entries.end())
+                m_entries.erase(itr);
+        }
+
+        delete grid;
+    }
+
+    return 0;
+}
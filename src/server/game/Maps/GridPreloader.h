@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRID_PRELOADER_H_INCLUDED
+#define _GRID_PRELOADER_H_INCLUDED
+
+#include <ace/Task.h>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+#include <ace/Atomic_Op.h>
+
+#include "Define.h"
+#include "UnorderedMap.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+class GridMap;
+class NavTile;
+
+// time a preloaded grid waits for its map before being dropped, in milliseconds
+#define GRID_PRELOAD_EXPIRY         60000
+// upper bound of queued and ready grids
+#define GRID_PRELOAD_MAX_PENDING    256
+
+// files of one grid read ahead of its activation, owned by the map once taken
+struct PreloadedGrid
+{
+    PreloadedGrid() : gridMap(NULL), navTile(NULL), readyTime(0) { }
+    ~PreloadedGrid();                                       // frees what the map did not take
+
+    GridMap* gridMap;
+    NavTile* navTile;
+    std::vector<std::string> vmapModels;                    // model instances held for the vmap tile
+    uint32 readyTime;
+};
+
+struct GridPreloadStats
+{
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> requests;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> hits;             // grid was ready when its map loaded it
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> late;             // requested, but still queued or loading
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> misses;           // never predicted
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> expired;          // loaded for nothing
+};
+
+/*
+ * Background loading of the terrain (.map), navigation (.mmtile) and collision
+ * (.vmtile models) files of grids players are about to enter.
+ *
+ * Maps request grids ahead of their players (Map::PreloadGridsAhead) and take
+ * the result in LoadMapAndVMap, leaving only the in memory work (vmap tree
+ * insertion and object spawning) to the map thread. Grids are keyed by base map,
+ * instances get them through their parent like any GridMap.
+ */
+class GridPreloader : protected ACE_Task_Base
+{
+    public:
+
+        GridPreloader();
+        virtual ~GridPreloader();
+
+        int activate(size_t num_threads);
+
+        int deactivate();
+
+        bool activated() const { return m_activated; }
+
+        // queues a grid, ignored if it is already queued, loading or ready
+        void Request(uint32 mapId, int gx, int gy);
+
+        // hands the preloaded grid to the map loading it, NULL if it was not ready
+        PreloadedGrid* Take(uint32 mapId, int gx, int gy);
+
+        // drops grids nobody came for, called from the world thread
+        void Update();
+
+        GridPreloadStats& GetStats() { return m_stats; }
+
+        virtual int svc();
+
+    private:
+        enum EntryState
+        {
+            PRELOAD_QUEUED,
+            PRELOAD_LOADING,
+            PRELOAD_CANCELLED,                              // taken while loading, result is thrown away
+            PRELOAD_READY
+        };
+
+        struct Entry
+        {
+            Entry() : state(PRELOAD_QUEUED), grid(NULL) { }
+
+            EntryState state;
+            PreloadedGrid* grid;
+        };
+
+        typedef UNORDERED_MAP<uint32, Entry> EntryMap;
+
+        static uint32 MakeKey(uint32 mapId, int gx, int gy) { return (mapId << 12) | (uint32(gx) << 6) | uint32(gy); }
+        static void Load(uint32 key, PreloadedGrid& grid);
+
+        ACE_Thread_Mutex m_lock;
+        ACE_Condition_Thread_Mutex m_condition;
+        std::deque<uint32> m_queue;
+        EntryMap m_entries;
+
+        bool m_activated;
+        bool m_shutdown;
+
+        GridPreloadStats m_stats;
+};
+
+#endif //_GRID_PRELOADER_H_INCLUDED
@@ -32,9 +32,11 @@
 #include "MapRefManager.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
+#include "MovementRelay.h"
 
 #include <bitset>
 #include <list>
+#include <vector>
 
 class Unit;
 class WorldPacket;
@@ -52,6 +54,9 @@ struct Position;
 class Battleground;
 class MapInstanced;
 class InstanceMap;
+class NavTile;
+class PathCache;
+class ACE_Mem_Map;
 namespace SkyMistCore { struct ObjectUpdater; }
 
 struct ScriptAction
@@ -151,31 +156,39 @@ enum InstanceLockTypes
     INSTANCE_LOCK_LOOT_BASED     // Used for: All LFR raids, Flex raids, SOO, Normal / Heroic diff raids in WOD.
 };
 
+/*
+ * Terrain of one map grid, read in place from the memory mapped .map file.
+ *
+ * The mapping is read only and shared, every instance of the map uses the base
+ * map's GridMap and the OS keeps a single copy of the pages for all processes
+ * using the same data directory. Only sections not aligned for their element
+ * type are copied to the heap.
+ */
 class GridMap
 {
     uint32  _flags;
     union{
-        float* m_V9;
-        uint16* m_uint16_V9;
-        uint8* m_uint8_V9;
+        float const* m_V9;
+        uint16 const* m_uint16_V9;
+        uint8 const* m_uint8_V9;
     };
     union{
-        float* m_V8;
-        uint16* m_uint16_V8;
-        uint8* m_uint8_V8;
+        float const* m_V8;
+        uint16 const* m_uint16_V8;
+        uint8 const* m_uint8_V8;
     };
     // Height level data
     float _gridHeight;
     float _gridIntHeightMultiplier;
 
     // Area data
-    uint16* _areaMap;
+    uint16 const* _areaMap;
 
     // Liquid data
     float _liquidLevel;
-    uint16* _liquidEntry;
-    uint8* _liquidFlags;
-    float* _liquidMap;
+    uint16 const* _liquidEntry;
+    uint8 const* _liquidFlags;
+    float const* _liquidMap;
     uint16 _gridArea;
     uint16 _liquidType;
     uint8 _liquidOffX;
@@ -183,10 +196,19 @@ class GridMap
     uint8 _liquidWidth;
     uint8 _liquidHeight;
 
+    // File data
+    ACE_Mem_Map* _mappedFile;
+    uint8* _fileBuffer;                                     // only used when the file can't be mapped
+    uint8 const* _fileData;
+    size_t _fileSize;
+    std::vector<uint8*> _alignedCopies;
+
+    bool mapFile(char const* filename);
+    template<class T> T const* getArray(uint32 offset, uint32 count);
 
-    bool loadAreaData(FILE* in, uint32 offset, uint32 size);
-    bool loadHeihgtData(FILE* in, uint32 offset, uint32 size);
-    bool loadLiquidData(FILE* in, uint32 offset, uint32 size);
+    bool loadAreaData(uint32 offset, uint32 size);
+    bool loadHeihgtData(uint32 offset, uint32 size);
+    bool loadLiquidData(uint32 offset, uint32 size);
 
     // Get height functions and pointers
     typedef float (GridMap::*GetHeightPtr) (float x, float y) const;
@@ -397,19 +419,45 @@ class Map : public GridRefManager<NGridType>
         void UpdateObjectVisibility(WorldObject* obj, Cell cell, CellCoord cellpair);
         void UpdateObjectsVisibilityFor(Player* player, Cell cell, CellCoord cellpair);
 
+        // navigation data of a loaded grid, NULL if the grid has no tile (see PathGenerator)
+        NavTile const* GetNavTile(uint32 gx, uint32 gy) const { return NavTiles[gx][gy]; }
+        PathCache& GetPathCache() { return *_pathCache; }
+
         void resetMarkedCells() { marked_cells.reset(); }
         bool isCellMarked(uint32 pCellId) { return marked_cells.test(pCellId); }
         void markCell(uint32 pCellId) { marked_cells.set(pCellId); }
 
+        // duration of the last Update() in ms, maintained by MapUpdater for scheduling
+        uint32 GetLastUpdateTime() const { return m_lastUpdateTime; }
+        void SetLastUpdateTime(uint32 time) { m_lastUpdateTime = time; }
+
         bool HavePlayers() const { return !m_mapRefManager.isEmpty(); }
         uint32 GetPlayersCountExceptGMs() const;
         bool ActiveObjectsNearGrid(NGridType const& ngrid) const;
 
+        // objects with pending value changes, their update blocks are built by SendObjectUpdates() on the map thread,
+        // so the values of an object in world are only written by the update of its own map or by the world thread
+        void AddUpdateObject(Object* obj)
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, _updateObjectsLock);
+            _updateObjects.insert(obj);
+        }
+
+        void RemoveUpdateObject(Object* obj)
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, _updateObjectsLock);
+            _updateObjects.erase(obj);
+        }
+
+        void SendObjectUpdates();
+
         void AddWorldObject(WorldObject* obj) { i_worldObjects.insert(obj); }
         void RemoveWorldObject(WorldObject* obj) { i_worldObjects.erase(obj); }
 
         void SendToPlayers(WorldPacket const* data) const;
 
+        MovementRelay& GetMovementRelay() { return _movementRelay; }
+
         typedef MapRefManager PlayerList;
         PlayerList const& GetPlayers() const { return m_mapRefManager; }
 
@@ -494,6 +542,7 @@ class Map : public GridRefManager<NGridType>
         void LoadMapAndVMap(int gx, int gy);
         void LoadVMap(int gx, int gy);
         void LoadMap(int gx, int gy, bool reload = false);
+        void LoadMMap(int gx, int gy);
         GridMap* GetGrid(float x, float y);
 
         void SetTimer(uint32 t) { i_gridExpiry = t < MIN_GRID_DELAY ? MIN_GRID_DELAY : t; }
@@ -517,6 +566,9 @@ class Map : public GridRefManager<NGridType>
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedForActiveObject(Cell const&, WorldObject* object);
 
+        void PreloadGridsAhead(Player* player);
+        void PreloadGridsAround(float x, float y);
+
         void buildNGridLinkage(NGridType* pNGridType) { pNGridType->link(this); }
 
         template<class T> void AddType(T *obj);
@@ -552,11 +604,13 @@ class Map : public GridRefManager<NGridType>
         uint32 m_unloadTimer;
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
+        MovementRelay _movementRelay;
 
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
 
         int32 m_VisibilityNotifyPeriod;
+        uint32 m_lastUpdateTime;
 
         typedef std::set<WorldObject*> ActiveNonPlayers;
         ActiveNonPlayers m_activeNonPlayers;
@@ -580,6 +634,8 @@ class Map : public GridRefManager<NGridType>
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         GridMap* GridMaps[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        NavTile* NavTiles[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
+        PathCache* _pathCache;
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
 
         bool i_scriptLock;
@@ -587,6 +643,9 @@ class Map : public GridRefManager<NGridType>
         std::map<WorldObject*, bool> i_objectsToSwitch;
         std::set<WorldObject*> i_worldObjects;
 
+        std::set<Object*> _updateObjects;
+        ACE_Thread_Mutex _updateObjectsLock;
+
         typedef std::multimap<time_t, ScriptAction> ScriptScheduleMap;
         ScriptScheduleMap m_scriptSchedule;
 
@@ -26,6 +26,7 @@
 #include "Map.h"
 #include "GridStates.h"
 #include "MapUpdater.h"
+#include "GridPreloader.h"
 
 class Transport;
 struct TransportCreatureProto;
@@ -154,6 +155,7 @@ class MapManager
         void SetNextInstanceId(uint32 nextInstanceId) { _nextInstanceId = nextInstanceId; };
 
         MapUpdater * GetMapUpdater() { return &m_updater; }
+        GridPreloader* GetGridPreloader() { return &m_preloader; }
 
     private:
         typedef UNORDERED_MAP<uint32, Map*> MapMapType;
@@ -184,6 +186,7 @@ class MapManager
         InstanceIds _instanceIds;
         uint32 _nextInstanceId;
         MapUpdater m_updater;
+        GridPreloader m_preloader;
 };
 #define sMapMgr ACE_Singleton<MapManager, ACE_Thread_Mutex>::instance()
 #endif
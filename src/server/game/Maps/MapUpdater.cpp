@@ -1,127 +1,313 @@
 #include "MapUpdater.h"
-#include "DelayExecutor.h"
 #include "Map.h"
-#include "DatabaseEnv.h"
+#include "Timer.h"
+#include "Log.h"
+#include "DatabaseProfiler.h"
 
 #include <ace/Guard_T.h>
-#include <ace/Method_Request.h>
 
-class WDBThreadStartReq1 : public ACE_Method_Request
-{
-    public:
-
-        WDBThreadStartReq1()
-        {
-        }
+#include <algorithm>
 
-        virtual int call()
+namespace
+{
+    struct MapUpdateRequestCostGreater
+    {
+        bool operator()(MapUpdateRequest const& left, MapUpdateRequest const& right) const
         {
-            return 0;
+            return left.cost > right.cost;
         }
-};
+    };
+}
 
-class WDBThreadEndReq1 : public ACE_Method_Request
+MapUpdater::MapUpdater():
+m_pendingRequests(0), m_queuedRequests(0), m_nextWorkerIndex(0),
+m_mutex(), m_condition(m_mutex), m_workMutex(), m_workCondition(m_workMutex),
+m_activated(false), m_shutdown(false)
 {
-    public:
+}
 
-        WDBThreadEndReq1()
-        {
-        }
+MapUpdater::~MapUpdater()
+{
+    deactivate();
 
-        virtual int call()
-        {
-            return 0;
-        }
-};
+    for (size_t i = 0; i < m_queues.size(); ++i)
+        delete m_queues[i];
+}
 
-class MapUpdateRequest : public ACE_Method_Request
+int MapUpdater::activate(size_t num_threads)
 {
-    private:
+    if (m_activated || num_threads < 1)
+        return -1;
 
-        Map& m_map;
-        MapUpdater& m_updater;
-        ACE_UINT32 m_diff;
+    m_queues.resize(num_threads);
+    for (size_t i = 0; i < num_threads; ++i)
+        m_queues[i] = new WorkQueue();
 
-    public:
+    m_shutdown = false;
+    m_nextWorkerIndex = 0;
 
-        MapUpdateRequest(Map& m, MapUpdater& u, ACE_UINT32 d)
-            : m_map(m), m_updater(u), m_diff(d)
-        {
-        }
+    if (ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(num_threads)) == -1)
+        return -1;
 
-        virtual int call()
-        {
-            m_map.Update (m_diff);
-            m_updater.update_finished();
-            return 0;
-        }
-};
+    m_activated = true;
+    return 0;
+}
 
-MapUpdater::MapUpdater():
-m_executor(), m_mutex(), m_condition(m_mutex), pending_requests(0)
+int MapUpdater::deactivate()
 {
+    if (!m_activated)
+        return -1;
+
+    wait();
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_workMutex);
+        m_shutdown = true;
+        m_workCondition.broadcast();
+    }
+
+    ACE_Task_Base::wait();
+    m_activated = false;
+    return 0;
 }
 
-MapUpdater::~MapUpdater()
+bool MapUpdater::activated()
 {
-    deactivate();
+    return m_activated;
 }
 
-int MapUpdater::activate(size_t num_threads)
+uint32 MapUpdater::EstimateCost(Map const& map)
 {
-    return m_executor.activate((int)num_threads, new WDBThreadStartReq1, new WDBThreadEndReq1);
+    // never 0, an empty queue is recognized by its pending cost
+    return 1 + map.GetLastUpdateTime() * IN_MILLISECONDS + map.GetPlayers().getSize() * MAP_UPDATE_PLAYER_COST;
 }
 
-int MapUpdater::deactivate()
+int MapUpdater::GetCurrentWorkerIndex() const
 {
-    wait();
+    ACE_thread_t self = ACE_Thread::self();
+    for (size_t i = 0; i < m_queues.size(); ++i)
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_queues[i]->lock);
+        if (ACE_OS::thr_equal(m_queues[i]->threadId, self))
+            return int(i);
+    }
 
-    return m_executor.deactivate();
+    return -1;
 }
 
-int MapUpdater::wait()
+int MapUpdater::schedule_update(Map& map, ACE_UINT32 diff)
 {
-    TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+    if (!m_activated)
+        return -1;
+
+    ++m_pendingRequests;
+
+    MapUpdateRequest request(&map, diff, EstimateCost(map));
 
-    while (pending_requests > 0)
-        m_condition.wait();
+    // Scheduled by a worker (instances of a MapInstanced), keep it local, others will steal if idle
+    int index = GetCurrentWorkerIndex();
+    if (index >= 0)
+    {
+        Push(size_t(index), request);
+        WakeWorkers();
+    }
+    else
+        m_staged.push_back(request);
 
     return 0;
 }
 
-int MapUpdater::schedule_update(Map& map, ACE_UINT32 diff)
+void MapUpdater::Push(size_t index, MapUpdateRequest const& request)
 {
-    TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+    WorkQueue* queue = m_queues[index];
 
-    ++pending_requests;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, queue->lock);
+        std::deque<MapUpdateRequest>::iterator itr = std::upper_bound(queue->requests.begin(), queue->requests.end(), request, MapUpdateRequestCostGreater());
+        queue->requests.insert(itr, request);
+        queue->pendingCost += request.cost;
+    }
+
+    ++m_queuedRequests;
+}
 
-    if (m_executor.execute(new MapUpdateRequest(map, *this, diff)) == -1)
+bool MapUpdater::PopLocal(size_t index, MapUpdateRequest& request)
+{
+    WorkQueue* queue = m_queues[index];
+
+    TRINITY_GUARD(ACE_Thread_Mutex, queue->lock);
+    if (queue->requests.empty())
+        return false;
+
+    request = queue->requests.front();
+    queue->requests.pop_front();
+    queue->pendingCost -= request.cost;
+    --m_queuedRequests;
+    return true;
+}
+
+bool MapUpdater::Steal(size_t index, MapUpdateRequest& request)
+{
+    // Pick the victim with the most pending work, unlocked read is only a hint
+    size_t victim = index;
+    uint64 victimCost = 0;
+    for (size_t i = 0; i < m_queues.size(); ++i)
     {
-        ACE_DEBUG((LM_ERROR, ACE_TEXT("(%t) \n"), ACE_TEXT("Failed to schedule Map Update")));
+        uint64 cost = m_queues[i]->pendingCost.value();
+        if (i != index && cost > victimCost)
+        {
+            victim = i;
+            victimCost = cost;
+        }
+    }
 
-        --pending_requests;
-        return -1;
+    if (victim == index)
+        return false;
+
+    WorkQueue* queue = m_queues[victim];
+
+    TRINITY_GUARD(ACE_Thread_Mutex, queue->lock);
+    if (queue->requests.empty())
+        return false;
+
+    request = queue->requests.front();
+    queue->requests.pop_front();
+    queue->pendingCost -= request.cost;
+    --m_queuedRequests;
+    ++m_queues[index]->stats.steals;
+    return true;
+}
+
+void MapUpdater::Dispatch()
+{
+    if (m_staged.empty())
+        return;
+
+    // Longest processing time first: deal the most expensive maps to the least loaded workers
+    std::sort(m_staged.begin(), m_staged.end(), MapUpdateRequestCostGreater());
+
+    std::vector<uint64> assigned(m_queues.size(), 0);
+    for (std::vector<MapUpdateRequest>::const_iterator itr = m_staged.begin(); itr != m_staged.end(); ++itr)
+    {
+        size_t target = std::min_element(assigned.begin(), assigned.end()) - assigned.begin();
+        assigned[target] += itr->cost;
+        Push(target, *itr);
+    }
+
+    m_staged.clear();
+    WakeWorkers();
+}
+
+void MapUpdater::WakeWorkers()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, m_workMutex);
+    m_workCondition.broadcast();
+}
+
+void MapUpdater::Run(size_t index, MapUpdateRequest const& request)
+{
+    uint32 startTime = getMSTime();
+    request.map->Update(request.diff);
+    request.map->SendObjectUpdates();
+    uint32 updateTime = GetMSTimeDiffToNow(startTime);
+
+    request.map->SetLastUpdateTime(updateTime);
+
+    MapUpdateWorkerStats& stats = m_queues[index]->stats;
+    stats.busyTime += updateTime;
+    ++stats.mapsUpdated;
+
+    {
+        // the other workers update it concurrently
+        TRINITY_GUARD(ACE_Thread_Mutex, m_slowestLock);
+        if (updateTime > m_currentTickStats.slowestMapTime)
+        {
+            m_currentTickStats.slowestMapTime = updateTime;
+            m_currentTickStats.slowestMapId = request.map->GetId();
+            m_currentTickStats.slowestInstanceId = request.map->GetInstanceId();
+        }
+    }
+
+    if (--m_pendingRequests == 0)
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+        m_condition.broadcast();
+    }
+}
+
+int MapUpdater::svc()
+{
+    size_t index = size_t(m_nextWorkerIndex++);
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_queues[index]->lock);
+        m_queues[index]->threadId = ACE_Thread::self();
+    }
+    DatabaseProfiler::SetThreadRole(DB_THREAD_ROLE_MAP);
+
+    MapUpdateRequest request;
+    for (;;)
+    {
+        if (PopLocal(index, request) || Steal(index, request))
+        {
+            Run(index, request);
+            continue;
+        }
+
+        TRINITY_GUARD(ACE_Thread_Mutex, m_workMutex);
+        while (m_queuedRequests.value() == 0 && !m_shutdown)
+            m_workCondition.wait();
+
+        if (m_shutdown && m_queuedRequests.value() == 0)
+            break;
     }
 
     return 0;
 }
 
-bool MapUpdater::activated()
+int MapUpdater::wait()
 {
-    return m_executor.activated();
+    if (!m_activated)
+        return -1;
+
+    Dispatch();
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+
+        while (m_pendingRequests.value() > 0)
+            m_condition.wait();
+    }
+
+    FinishTick();
+    return 0;
 }
 
-void MapUpdater::update_finished()
+void MapUpdater::FinishTick()
 {
-    TRINITY_GUARD(ACE_Thread_Mutex, m_mutex);
+    m_lastTickStats.workers.resize(m_queues.size());
 
-    if (pending_requests == 0)
+    uint32 minBusy = 0, maxBusy = 0;
+    for (size_t i = 0; i < m_queues.size(); ++i)
     {
-        ACE_ERROR((LM_ERROR, ACE_TEXT("(%t)\n"), ACE_TEXT("MapUpdater::update_finished BUG, report to devs")));
-        return;
+        MapUpdateWorkerStats& stats = m_queues[i]->stats;
+        if (!i || stats.busyTime < minBusy)
+            minBusy = stats.busyTime;
+        if (stats.busyTime > maxBusy)
+            maxBusy = stats.busyTime;
+
+        m_lastTickStats.workers[i] = stats;
+        stats = MapUpdateWorkerStats();
     }
 
-    --pending_requests;
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_slowestLock);
+        m_lastTickStats.slowestMapId = m_currentTickStats.slowestMapId;
+        m_lastTickStats.slowestInstanceId = m_currentTickStats.slowestInstanceId;
+        m_lastTickStats.slowestMapTime = m_currentTickStats.slowestMapTime;
+        m_currentTickStats = MapUpdateTickStats();
+    }
 
-    m_condition.broadcast();
+    if (maxBusy - minBusy > 50)
+        TC_LOG_DEBUG(LOG_FILTER_MAPS, "MapUpdater: unbalanced tick, worker busy time %u - %u ms, slowest map %u (instance %u) %u ms",
+            minBusy, maxBusy, m_lastTickStats.slowestMapId, m_lastTickStats.slowestInstanceId, m_lastTickStats.slowestMapTime);
 }
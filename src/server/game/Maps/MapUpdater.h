@@ -1,22 +1,66 @@
 #ifndef _MAP_UPDATER_H_INCLUDED
 #define _MAP_UPDATER_H_INCLUDED
 
+#include <ace/Task.h>
 #include <ace/Thread_Mutex.h>
 #include <ace/Condition_Thread_Mutex.h>
+#include <ace/Atomic_Op.h>
 
-#include "DelayExecutor.h"
+#include "Define.h"
+
+#include <deque>
+#include <vector>
 
 class Map;
 
-class MapUpdater
+// Estimated cost of a single player on a map without update history, in microseconds
+#define MAP_UPDATE_PLAYER_COST 200
+
+struct MapUpdateRequest
+{
+    MapUpdateRequest() : map(NULL), diff(0), cost(0) { }
+    MapUpdateRequest(Map* m, uint32 d, uint32 c) : map(m), diff(d), cost(c) { }
+
+    Map* map;
+    uint32 diff;
+    uint32 cost;                                            // estimated, used for ordering only
+};
+
+struct MapUpdateWorkerStats
+{
+    MapUpdateWorkerStats() : busyTime(0), mapsUpdated(0), steals(0) { }
+
+    uint32 busyTime;                                        // ms spent in Map::Update during the last tick
+    uint32 mapsUpdated;
+    uint32 steals;                                          // requests taken from other workers' queues
+};
+
+struct MapUpdateTickStats
+{
+    MapUpdateTickStats() : slowestMapId(0), slowestInstanceId(0), slowestMapTime(0) { }
+
+    std::vector<MapUpdateWorkerStats> workers;
+    uint32 slowestMapId;
+    uint32 slowestInstanceId;
+    uint32 slowestMapTime;
+};
+
+/*
+ * Map update scheduler.
+ *
+ * Every worker owns a queue kept ordered by estimated cost (last update time
+ * and player count), most expensive first. Maps scheduled from the world thread
+ * are buffered and dealt to the least loaded queue when wait() is called, maps
+ * scheduled from a worker (MapInstanced -> instances) go to its own queue.
+ * Idle workers steal the most expensive pending request from the most loaded queue.
+ */
+class MapUpdater : protected ACE_Task_Base
 {
     public:
 
         MapUpdater();
         virtual ~MapUpdater();
 
-        friend class MapUpdateRequest;
-
         int schedule_update(Map& map, ACE_UINT32 diff);
 
         int wait();
@@ -27,14 +71,53 @@ class MapUpdater
 
         bool activated();
 
+        // statistics of the last completed tick, only valid on the world thread
+        MapUpdateTickStats const& GetLastTickStats() const { return m_lastTickStats; }
+
+        virtual int svc();
+
     private:
 
-        DelayExecutor m_executor;
+        struct WorkQueue
+        {
+            WorkQueue() : pendingCost(0), threadId(ACE_OS::NULL_thread) { }
+
+            ACE_Thread_Mutex lock;
+            std::deque<MapUpdateRequest> requests;
+            ACE_Atomic_Op<ACE_Thread_Mutex, uint64> pendingCost;    // changed under lock, read without it by the thieves
+            ACE_thread_t threadId;                                  // under lock
+            MapUpdateWorkerStats stats;
+        };
+
+        static uint32 EstimateCost(Map const& map);
+
+        int GetCurrentWorkerIndex() const;
+        void Push(size_t index, MapUpdateRequest const& request);
+        bool PopLocal(size_t index, MapUpdateRequest& request);
+        bool Steal(size_t index, MapUpdateRequest& request);
+        void Dispatch();
+        void WakeWorkers();
+        void Run(size_t index, MapUpdateRequest const& request);
+        void FinishTick();
+
+        std::vector<WorkQueue*> m_queues;
+        std::vector<MapUpdateRequest> m_staged;              // world thread only
+
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_pendingRequests; // scheduled and not finished
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_queuedRequests;  // scheduled and not started
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> m_nextWorkerIndex;
+
         ACE_Thread_Mutex m_mutex;
-        ACE_Condition_Thread_Mutex m_condition;
-        size_t pending_requests;
+        ACE_Condition_Thread_Mutex m_condition;               // signaled when m_pendingRequests drops to 0
+        ACE_Thread_Mutex m_workMutex;
+        ACE_Condition_Thread_Mutex m_workCondition;           // signaled when new requests are queued
+
+        ACE_Thread_Mutex m_slowestLock;
+        MapUpdateTickStats m_currentTickStats;
+        MapUpdateTickStats m_lastTickStats;
 
-        void update_finished();
+        bool m_activated;
+        bool m_shutdown;
 };
 
 #endif //_MAP_UPDATER_H_INCLUDED
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementRelay.h"
+#include "GridNotifiers.h"
+#include "Map.h"
+#include "ObjectAccessor.h"
+#include "CellImpl.h"
+#include "Player.h"
+#include "World.h"
+
+// mover states not queued for that long are dropped
+#define MOVEMENT_RELAY_PRUNE_DELAY 60000
+
+namespace SkyMistCore
+{
+    // collects who MessageDistDeliverer would consider around the cell, distances are checked per mover
+    struct MovementReceiverCollector
+    {
+        MovementRelay::ReceiverList& i_receivers;
+
+        MovementReceiverCollector(MovementRelay::ReceiverList& receivers) : i_receivers(receivers) { }
+
+        void Visit(PlayerMapType& m)
+        {
+            for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                Player* target = iter->getSource();
+
+                SharedVisionList const& vision = target->GetSharedVisionList();
+                for (SharedVisionList::const_iterator i = vision.begin(); i != vision.end(); ++i)
+                    if ((*i)->m_seer == target)
+                        i_receivers.push_back(MovementRelay::Receiver(target, *i));
+
+                if (target->m_seer == target || target->GetVehicle())
+                    i_receivers.push_back(MovementRelay::Receiver(target, target));
+            }
+        }
+
+        void Visit(CreatureMapType& m)
+        {
+            for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                Creature* target = iter->getSource();
+
+                SharedVisionList const& vision = target->GetSharedVisionList();
+                for (SharedVisionList::const_iterator i = vision.begin(); i != vision.end(); ++i)
+                    if ((*i)->m_seer == target)
+                        i_receivers.push_back(MovementRelay::Receiver(target, *i));
+            }
+        }
+
+        void Visit(DynamicObjectMapType& m)
+        {
+            for (DynamicObjectMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+            {
+                DynamicObject* target = iter->getSource();
+                if (!IS_PLAYER_GUID(target->GetCasterGUID()))
+                    continue;
+
+                Player* caster = (Player*)target->GetCaster();
+                if (caster && caster->m_seer == target)
+                    i_receivers.push_back(MovementRelay::Receiver(target, caster));
+            }
+        }
+
+        template<class SKIP> void Visit(GridRefManager<SKIP>&) { }
+    };
+}
+
+MovementRelay::MovementRelay() : _lastPrune(getMSTime())
+{
+}
+
+void MovementRelay::Queue(Unit* mover, Player const* skipped)
+{
+    MoverState& state = _movers[mover->GetGUID()];
+    state.skipped = skipped ? skipped->GetGUID() : 0;
+    state.queueTime = getMSTime();
+
+    if (state.queued)
+        return;
+
+    state.queued = true;
+    _queue.push_back(mover->GetGUID());
+}
+
+void MovementRelay::Cancel(Unit* mover)
+{
+    // left in _queue, skipped by Flush()
+    UNORDERED_MAP<uint64, MoverState>::iterator itr = _movers.find(mover->GetGUID());
+    if (itr != _movers.end())
+        itr->second.queued = false;
+}
+
+void MovementRelay::Flush(Map& map)
+{
+    uint32 now = getMSTime();
+
+    if (!_queue.empty())
+    {
+        float farDistance = sWorld->getFloatConfig(CONFIG_MOVEMENT_RELAY_FAR_DISTANCE);
+        float farDistSq = farDistance * farDistance;
+        uint32 farInterval = sWorld->getIntConfig(CONFIG_MOVEMENT_RELAY_FAR_INTERVAL);
+
+        for (std::vector<uint64>::const_iterator itr = _queue.begin(); itr != _queue.end(); ++itr)
+        {
+            UNORDERED_MAP<uint64, MoverState>::iterator stateItr = _movers.find(*itr);
+            if (stateItr == _movers.end())
+                continue;
+
+            MoverState& state = stateItr->second;
+            if (!state.queued)
+                continue;
+
+            state.queued = false;
+
+            Unit* mover = ObjectAccessor::GetObjectInMap(*itr, &map, (Unit*)NULL);
+            if (!mover || !mover->IsInWorld())
+            {
+                _movers.erase(stateItr);
+                continue;
+            }
+
+            WorldPacket data(SMSG_MOVE_UPDATE, 64);
+            mover->WriteMovementInfo(data);
+
+            float distSq = mover->GetVisibilityRange() * mover->GetVisibilityRange();
+            uint32 phaseMask = mover->GetPhaseMask();
+
+            uint32 flags = mover->GetUnitMovementFlags();
+            bool farDue = !farDistance || flags != state.farFlags || getMSTimeDiff(state.farTime, now) >= farInterval;
+            if (farDue)
+            {
+                state.farTime = now;
+                state.farFlags = flags;
+            }
+
+            ReceiverList const& receivers = GetReceivers(map, mover);
+            for (ReceiverList::const_iterator receiver = receivers.begin(); receiver != receivers.end(); ++receiver)
+            {
+                if (!receiver->anchor->InSamePhase(phaseMask))
+                    continue;
+
+                float receiverDistSq = receiver->anchor->GetExactDist2dSq(mover);
+                if (receiverDistSq > distSq || (!farDue && receiverDistSq > farDistSq))
+                    continue;
+
+                // never send to the controlling player, a possessed player still gets its own movement
+                Player* player = receiver->player;
+                if (player->GetGUID() == state.skipped || !player->HaveAtClient(mover))
+                    continue;
+
+                if (WorldSession* session = player->GetSession())
+                    session->SendPacket(&data);
+            }
+        }
+
+        _queue.clear();
+        _receivers.clear();
+    }
+
+    if (getMSTimeDiff(_lastPrune, now) >= MOVEMENT_RELAY_PRUNE_DELAY)
+    {
+        for (UNORDERED_MAP<uint64, MoverState>::iterator itr = _movers.begin(); itr != _movers.end();)
+        {
+            if (getMSTimeDiff(itr->second.queueTime, now) >= MOVEMENT_RELAY_PRUNE_DELAY)
+                _movers.erase(itr++);
+            else
+                ++itr;
+        }
+
+        _lastPrune = now;
+    }
+}
+
+MovementRelay::ReceiverList const& MovementRelay::GetReceivers(Map& map, Unit* mover)
+{
+    float xOffset, yOffset;
+    CellCoord p = SkyMistCore::ComputeCellCoord(mover->GetPositionX(), mover->GetPositionY(), xOffset, yOffset);
+
+    // whole cell around its center, the movers of the cell are at most half a diagonal away from it
+    CellReceivers& cell = _receivers[p.GetId()];
+    float radius = mover->GetVisibilityRange() + SIZE_OF_GRID_CELL;
+    if (cell.radius >= radius)
+        return cell.receivers;
+
+    cell.radius = radius;
+    cell.receivers.clear();
+
+    SkyMistCore::MovementReceiverCollector collector(cell.receivers);
+    map.VisitWorld(mover->GetPositionX() - xOffset, mover->GetPositionY() - yOffset, radius, collector);
+
+    return cell.receivers;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_MOVEMENTRELAY_H
+#define TRINITY_MOVEMENTRELAY_H
+
+#include "Define.h"
+#include "UnorderedMap.h"
+
+#include <vector>
+
+class Map;
+class Player;
+class Unit;
+class WorldObject;
+
+/*
+ * Movement updates of the units moved by players, sent to the players around
+ * them once per map update.
+ *
+ * HandleMovementOpcodes queues the mover instead of sending SMSG_MOVE_UPDATE
+ * for each heartbeat, and the map flushes the queue once its sessions
+ * processed their packets: every mover sends its latest state once, however
+ * many heartbeats it moved with during the update. The other movement packets
+ * (jump, fall land, start, stop...) are still sent right away, so the
+ * observers see every transition. The receivers around a grid
+ * cell are collected once for all the movers standing in it, and receivers
+ * farther than Movement.Relay.FarDistance get a mover's state at most every
+ * Movement.Relay.FarInterval, unless its movement flags changed.
+ */
+class MovementRelay
+{
+    public:
+        // player gets the updates of the movers in range of anchor, itself or what it sees through
+        struct Receiver
+        {
+            Receiver(WorldObject* anchor_, Player* player_) : anchor(anchor_), player(player_) { }
+
+            WorldObject* anchor;
+            Player* player;
+        };
+
+        typedef std::vector<Receiver> ReceiverList;
+
+        MovementRelay();
+
+        // the state of the mover is sent at the next Flush(), except to skipped
+        void Queue(Unit* mover, Player const* skipped);
+        // the mover state was just sent
+        void Cancel(Unit* mover);
+        void Flush(Map& map);
+
+    private:
+        struct CellReceivers
+        {
+            CellReceivers() : radius(0.0f) { }
+
+            float radius;
+            ReceiverList receivers;
+        };
+
+        struct MoverState
+        {
+            MoverState() : skipped(0), queueTime(0), farTime(0), farFlags(0), queued(false) { }
+
+            uint64 skipped;
+            uint32 queueTime;
+            uint32 farTime;                                 // last time the far receivers got the state
+            uint32 farFlags;                                // movement flags they got then
+            bool queued;
+        };
+
+        ReceiverList const& GetReceivers(Map& map, Unit* mover);
+
+        UNORDERED_MAP<uint64, MoverState> _movers;
+        std::vector<uint64> _queue;
+        UNORDERED_MAP<uint32, CellReceivers> _receivers;   // of the current flush, by cell id
+        uint32 _lastPrune;
+};
+
+#endif
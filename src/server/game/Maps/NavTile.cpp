@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NavTile.h"
+#include "Log.h"
+
+#include <cstdio>
+
+#define NAV_TILE_CELL_COUNT (NAV_TILE_CELLS * NAV_TILE_CELLS)
+
+NavTile::NavTile() : _data(NULL), _height(NULL), _flags(NULL), _links(NULL)
+{
+}
+
+NavTile::~NavTile()
+{
+    unloadData();
+}
+
+bool NavTile::loadData(char const* filename, uint32 mapId, uint32 tileX, uint32 tileY)
+{
+    unloadData();
+
+    FILE* in = fopen(filename, "rb");
+    if (!in)
+        return false;
+
+    NavTileHeader header;
+    if (fread(&header, sizeof(header), 1, in) != 1 || header.magic != NAV_TILE_MAGIC || header.version != NAV_TILE_VERSION)
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Navigation tile '%s' is from an incompatible version. Please recreate using mmaps_generator.", filename);
+        fclose(in);
+        return false;
+    }
+
+    if (header.mapId != mapId || header.tileX != tileX || header.tileY != tileY || header.cells != NAV_TILE_CELLS)
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Navigation tile '%s' does not belong to map %u [%u, %u].", filename, mapId, tileX, tileY);
+        fclose(in);
+        return false;
+    }
+
+    size_t size = NAV_TILE_CELL_COUNT * (sizeof(float) + sizeof(uint8) + sizeof(uint8));
+    _data = new uint8[size];
+    if (fread(_data, size, 1, in) != 1)
+    {
+        sLog->outError(LOG_FILTER_MAPS, "Navigation tile '%s' is truncated.", filename);
+        fclose(in);
+        unloadData();
+        return false;
+    }
+
+    fclose(in);
+
+    _height = reinterpret_cast<float*>(_data);
+    _flags = _data + NAV_TILE_CELL_COUNT * sizeof(float);
+    _links = _flags + NAV_TILE_CELL_COUNT;
+    return true;
+}
+
+void NavTile::unloadData()
+{
+    delete[] _data;
+    _data = NULL;
+    _height = NULL;
+    _flags = NULL;
+    _links = NULL;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_NAVTILE_H
+#define TRINITY_NAVTILE_H
+
+#include "Define.h"
+#include "NavTileDefines.h"
+
+// Navigation data of one map grid, loaded and shared between instances like GridMap
+class NavTile
+{
+    public:
+        NavTile();
+        ~NavTile();
+
+        bool loadData(char const* filename, uint32 mapId, uint32 tileX, uint32 tileY);
+        void unloadData();
+
+        float getHeight(uint32 cx, uint32 cy) const { return _height[cx * NAV_TILE_CELLS + cy]; }
+        uint8 getFlags(uint32 cx, uint32 cy) const { return _flags[cx * NAV_TILE_CELLS + cy]; }
+        uint8 getLinks(uint32 cx, uint32 cy) const { return _links[cx * NAV_TILE_CELLS + cy]; }
+
+    private:
+        uint8* _data;                                       // single allocation for the three layers
+        float* _height;
+        uint8* _flags;
+        uint8* _links;
+};
+
+#endif
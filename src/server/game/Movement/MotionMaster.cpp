@@ -192,7 +192,7 @@ void MotionMaster::MoveRandom(float spawndist)
 {
     if (_owner->GetTypeId() == TYPEID_UNIT)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (GUID: %u) starts moving random.", _owner->GetGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (GUID: %u) starts moving random.", _owner->GetGUIDLow());
         Mutate(new RandomMovementGenerator<Creature>(spawndist), MOTION_SLOT_IDLE);
     }
 }
@@ -205,15 +205,15 @@ void MotionMaster::MoveTargetedHome()
     {
         if (!_owner->ToCreature()->GetCharmerOrOwnerGUID())
         {
-            sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now targeted and is moving home.", _owner->GetEntry(), _owner->GetGUIDLow());
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now targeted and is moving home.", _owner->GetEntry(), _owner->GetGUIDLow());
             Mutate(new HomeMovementGenerator<Creature>(), MOTION_SLOT_ACTIVE);
         }
         else
         {
-            sLog->outDebug(LOG_FILTER_GENERAL, "Pet or controlled creature (Entry: %u GUID: %u) now targeted and is moving home.", _owner->GetEntry(), _owner->GetGUIDLow());
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Pet or controlled creature (Entry: %u GUID: %u) now targeted and is moving home.", _owner->GetEntry(), _owner->GetGUIDLow());
             if (Unit* target = _owner->ToCreature()->GetCharmerOrOwner())
             {
-                sLog->outDebug(LOG_FILTER_GENERAL, "Following %s (GUID: %u)", target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : ((Creature*)target)->GetDBTableGUIDLow());
+                TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Following %s (GUID: %u)", target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : ((Creature*)target)->GetDBTableGUIDLow());
                 Mutate(new FollowMovementGenerator<Creature>(target, PET_FOLLOW_DIST, PET_FOLLOW_ANGLE), MOTION_SLOT_ACTIVE);
             }
         }
@@ -228,12 +228,12 @@ void MotionMaster::MoveConfused()
 {
     if (_owner->GetTypeId() == TYPEID_PLAYER)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Player (GUID: %u) now moves confused.", _owner->GetGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player (GUID: %u) now moves confused.", _owner->GetGUIDLow());
         Mutate(new ConfusedMovementGenerator<Player>(), MOTION_SLOT_CONTROLLED);
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now moves confused.", _owner->GetEntry(), _owner->GetGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now moves confused.", _owner->GetEntry(), _owner->GetGUIDLow());
         Mutate(new ConfusedMovementGenerator<Creature>(), MOTION_SLOT_CONTROLLED);
     }
 }
@@ -251,12 +251,12 @@ void MotionMaster::MoveChase(Unit* target, float dist, float angle)
 
     if (_owner->GetTypeId() == TYPEID_PLAYER)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Player (GUID: %u) is now chasing %s (GUID: %u)", _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player (GUID: %u) is now chasing %s (GUID: %u)", _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
         Mutate(new ChaseMovementGenerator<Player>(target, dist, angle), MOTION_SLOT_ACTIVE);
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is now chasing %s (GUID: %u)", _owner->GetEntry(), _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is now chasing %s (GUID: %u)", _owner->GetEntry(), _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
         Mutate(new ChaseMovementGenerator<Creature>(target, dist, angle), MOTION_SLOT_ACTIVE);
     }
 }
@@ -274,12 +274,12 @@ void MotionMaster::MoveFollow(Unit* target, float dist, float angle, MovementSlo
 
     if (_owner->GetTypeId() == TYPEID_PLAYER)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Player (GUID: %u) is now following %s (GUID: %u)", _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player (GUID: %u) is now following %s (GUID: %u)", _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
         Mutate(new FollowMovementGenerator<Player>(target, dist, angle), slot);
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is now following %s (GUID: %u)", _owner->GetEntry(), _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is now following %s (GUID: %u)", _owner->GetEntry(), _owner->GetGUIDLow(), target->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", target->GetTypeId() == TYPEID_PLAYER ? target->GetGUIDLow() : target->ToCreature()->GetDBTableGUIDLow());
         Mutate(new FollowMovementGenerator<Creature>(target, dist, angle), slot);
     }
 }
@@ -288,12 +288,12 @@ void MotionMaster::MovePoint(uint32 id, float x, float y, float z)
 {
     if (_owner->GetTypeId() == TYPEID_PLAYER)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Player (GUID: %u) now targeted and is moving to point (Id: %u X: %f Y: %f Z: %f)", _owner->GetGUIDLow(), id, x, y, z);
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player (GUID: %u) now targeted and is moving to point (Id: %u X: %f Y: %f Z: %f)", _owner->GetGUIDLow(), id, x, y, z);
         Mutate(new PointMovementGenerator<Player>(id, x, y, z), MOTION_SLOT_ACTIVE);
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now targeted and is moving to point (ID: %u X: %f Y: %f Z: %f)", _owner->GetEntry(), _owner->GetGUIDLow(), id, x, y, z);
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now targeted and is moving to point (ID: %u X: %f Y: %f Z: %f)", _owner->GetEntry(), _owner->GetGUIDLow(), id, x, y, z);
         Mutate(new PointMovementGenerator<Creature>(id, x, y, z), MOTION_SLOT_ACTIVE);
     }
 }
@@ -303,7 +303,7 @@ void MotionMaster::MoveLand(uint32 id, Position const& pos)
     float x, y, z;
     pos.GetPosition(x, y, z);
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u) is now landing at point (ID: %u X: %f Y: %f Z: %f)", _owner->GetEntry(), id, x, y, z);
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u) is now landing at point (ID: %u X: %f Y: %f Z: %f)", _owner->GetEntry(), id, x, y, z);
 
     Movement::MoveSplineInit init(_owner);
     init.MoveTo(x, y, z);
@@ -321,7 +321,7 @@ void MotionMaster::MoveTakeoff(uint32 id, Position const& pos)
 
 void MotionMaster::MoveTakeoff(uint32 id, float x, float y, float z)
 {
-    sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u) is now taking off at point (ID: %u X: %f Y: %f Z: %f)", _owner->GetEntry(), id, x, y, z);
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u) is now taking off at point (ID: %u X: %f Y: %f Z: %f)", _owner->GetEntry(), id, x, y, z);
 
     Movement::MoveSplineInit init(_owner);
     init.MoveTo(x, y, z);
@@ -378,7 +378,7 @@ void MotionMaster::MoveJumpTo(float angle, float speedXY, float speedZ)
 
 void MotionMaster::MoveJump(float x, float y, float z, float speedXY, float speedZ, float o, uint32 id)
 {
-    sLog->outDebug(LOG_FILTER_GENERAL, "Unit (GUID: %u) is now jumping to point (X: %f Y: %f Z: %f).", _owner->GetGUIDLow(), x, y, z);
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Unit (GUID: %u) is now jumping to point (X: %f Y: %f Z: %f).", _owner->GetGUIDLow(), x, y, z);
 
     float moveTimeHalf = speedZ / Movement::gravity;
     float max_height = -Movement::computeFallElevation(moveTimeHalf, false, -speedZ);
@@ -395,7 +395,7 @@ void MotionMaster::MoveJump(float x, float y, float z, float speedXY, float spee
 
 void MotionMaster::CustomJump(float x, float y, float z, float speedXY, float speedZ, uint32 id)
 {
-    sLog->outDebug(LOG_FILTER_GENERAL, "Unit (GUID: %u) is now custom jumping to point (X: %f Y: %f Z: %f).", _owner->GetGUIDLow(), x, y, z);
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Unit (GUID: %u) is now custom jumping to point (X: %f Y: %f Z: %f).", _owner->GetGUIDLow(), x, y, z);
 
     speedZ *= 2.3f;
     speedXY *= 2.3f;
@@ -417,7 +417,7 @@ void MotionMaster::MoveFall(uint32 id/*=0*/)
     float mapHeight = _owner->GetMap()->GetHeight(_owner->GetPhaseMask(), _owner->GetPositionX(), _owner->GetPositionY(), _owner->GetPositionZ(), true, MAX_FALL_DISTANCE);
     if (mapHeight <= INVALID_HEIGHT)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "MotionMaster::MoveFall: Unable to retrieve a proper height on map %u (x: %f, y: %f, z: %f).", _owner->GetMap()->GetId(), _owner->GetPositionX(), _owner->GetPositionX(), _owner->GetPositionZ());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "MotionMaster::MoveFall: Unable to retrieve a proper height on map %u (x: %f, y: %f, z: %f).", _owner->GetMap()->GetId(), _owner->GetPositionX(), _owner->GetPositionX(), _owner->GetPositionZ());
         return;
     }
 
@@ -459,12 +459,12 @@ void MotionMaster::MoveCharge(float x, float y, float z, float speed, uint32 id)
 
     if (_owner->GetTypeId() == TYPEID_PLAYER)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Player (GUID: %u) now charges to point (X: %f Y: %f Z: %f).", _owner->GetGUIDLow(), x, y, z);
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player (GUID: %u) now charges to point (X: %f Y: %f Z: %f).", _owner->GetGUIDLow(), x, y, z);
         Mutate(new PointMovementGenerator<Player>(id, x, y, z, speed), MOTION_SLOT_CONTROLLED);
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now charges to point (X: %f Y: %f Z: %f).", _owner->GetEntry(), _owner->GetGUIDLow(), x, y, z);
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now charges to point (X: %f Y: %f Z: %f).", _owner->GetEntry(), _owner->GetGUIDLow(), x, y, z);
         Mutate(new PointMovementGenerator<Creature>(id, x, y, z, speed), MOTION_SLOT_CONTROLLED);
     }
 }
@@ -475,7 +475,7 @@ void MotionMaster::MoveSeekAssistance(float x, float y, float z)
         sLog->outError(LOG_FILTER_GENERAL, "Player (GUID: %u) is attempting to MoveSeekAssistance!", _owner->GetGUIDLow());
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now attempts to seek assistance at position (X: %f Y: %f Z: %f).", _owner->GetEntry(), _owner->GetGUIDLow(), x, y, z);
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) now attempts to seek assistance at position (X: %f Y: %f Z: %f).", _owner->GetEntry(), _owner->GetGUIDLow(), x, y, z);
         _owner->AttackStop();
         _owner->ToCreature()->SetReactState(REACT_PASSIVE);
         Mutate(new AssistanceMovementGenerator(x, y, z), MOTION_SLOT_ACTIVE);
@@ -488,7 +488,7 @@ void MotionMaster::MoveSeekAssistanceDistract(uint32 time)
         sLog->outError(LOG_FILTER_GENERAL, "Player (GUID: %u) is attempting to MoveSeekAssistanceDistract!", _owner->GetGUIDLow());
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is distracted after seeking assistance (Time: %u).", _owner->GetEntry(), _owner->GetGUIDLow(), time);
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is distracted after seeking assistance (Time: %u).", _owner->GetEntry(), _owner->GetGUIDLow(), time);
         Mutate(new AssistanceDistractMovementGenerator(time), MOTION_SLOT_ACTIVE);
     }
 }
@@ -503,12 +503,12 @@ void MotionMaster::MoveFleeing(Unit* enemy, uint32 time)
 
     if (_owner->GetTypeId() == TYPEID_PLAYER)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Player (GUID: %u) is now fleeing from %s (GUID: %u).", _owner->GetGUIDLow(), enemy->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", enemy->GetTypeId() == TYPEID_PLAYER ? enemy->GetGUIDLow() : enemy->ToCreature()->GetDBTableGUIDLow());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player (GUID: %u) is now fleeing from %s (GUID: %u).", _owner->GetGUIDLow(), enemy->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", enemy->GetTypeId() == TYPEID_PLAYER ? enemy->GetGUIDLow() : enemy->ToCreature()->GetDBTableGUIDLow());
         Mutate(new FleeingMovementGenerator<Player>(enemy->GetGUID()), MOTION_SLOT_CONTROLLED);
     }
     else
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is now fleeing from %s (GUID: %u) %s", _owner->GetEntry(), _owner->GetGUIDLow(), enemy->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", enemy->GetTypeId() == TYPEID_PLAYER ? enemy->GetGUIDLow() : enemy->ToCreature()->GetDBTableGUIDLow(), time ? " for a limited time." : ".");
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Creature (Entry: %u GUID: %u) is now fleeing from %s (GUID: %u) %s", _owner->GetEntry(), _owner->GetGUIDLow(), enemy->GetTypeId() == TYPEID_PLAYER ? "player" : "creature", enemy->GetTypeId() == TYPEID_PLAYER ? enemy->GetGUIDLow() : enemy->ToCreature()->GetDBTableGUIDLow(), time ? " for a limited time." : ".");
         if (time)
             Mutate(new TimedFleeingMovementGenerator(enemy->GetGUID(), time), MOTION_SLOT_CONTROLLED);
         else
@@ -522,7 +522,7 @@ void MotionMaster::MoveTaxiFlight(uint32 path, uint32 pathnode)
     {
         if (path < sTaxiPathNodesByPath.size())
         {
-            sLog->outDebug(LOG_FILTER_GENERAL, "Player %s now takes a taxi to (Path %u node %u).", _owner->GetName(), path, pathnode);
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Player %s now takes a taxi to (Path %u node %u).", _owner->GetName(), path, pathnode);
             FlightPathMovementGenerator* mgen = new FlightPathMovementGenerator(sTaxiPathNodesByPath[path], pathnode);
             Mutate(mgen, MOTION_SLOT_CONTROLLED);
         }
@@ -538,7 +538,7 @@ void MotionMaster::MoveDistract(uint32 timer)
     if (Impl[MOTION_SLOT_CONTROLLED])
         return;
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "%s (GUID: %u) is now distracted (timer: %u).", _owner->GetTypeId() == TYPEID_PLAYER ? "Player" : "Creature", _owner->GetGUIDLow(), timer);
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "%s (GUID: %u) is now distracted (timer: %u).", _owner->GetTypeId() == TYPEID_PLAYER ? "Player" : "Creature", _owner->GetGUIDLow(), timer);
 
     DistractMovementGenerator* mgen = new DistractMovementGenerator(timer);
     Mutate(mgen, MOTION_SLOT_CONTROLLED);
@@ -573,7 +573,7 @@ void MotionMaster::MovePath(uint32 path_id, bool repeatable)
     if (!path_id)
         return;
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "%s (GUID: %u) is now starting to move on path (id: %u, repeatable: %s).", _owner->GetTypeId() == TYPEID_PLAYER ? "Player" : "Creature", _owner->GetGUIDLow(), path_id, repeatable ? "YES" : "NO");
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "%s (GUID: %u) is now starting to move on path (id: %u, repeatable: %s).", _owner->GetTypeId() == TYPEID_PLAYER ? "Player" : "Creature", _owner->GetGUIDLow(), path_id, repeatable ? "YES" : "NO");
 
     Mutate(new WaypointMovementGenerator<Creature>(path_id, repeatable), MOTION_SLOT_IDLE);
 }
@@ -583,7 +583,7 @@ void MotionMaster::MoveRotate(uint32 time, RotateDirection direction)
     if (!time)
         return;
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "%s (GUID: %u) is now rotating (time: %u).", _owner->GetTypeId() == TYPEID_PLAYER ? "Player" : "Creature",  _owner->GetGUIDLow(), time);
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "%s (GUID: %u) is now rotating (time: %u).", _owner->GetTypeId() == TYPEID_PLAYER ? "Player" : "Creature",  _owner->GetGUIDLow(), time);
 
     Mutate(new RotateMovementGenerator(time, direction), MOTION_SLOT_ACTIVE);
 }
@@ -0,0 +1,641 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementCodec.h"
+#include "Player.h"
+
+#include <map>
+
+static MovementCodec const* MovementCodecs[NUM_OPCODE_HANDLERS];
+
+/*** Readers. ***/
+
+template<uint8 Index> static void ReadHasGuidByte(MovementReadState& s) { s.guid[Index] = s.data.ReadBit(); }
+template<uint8 Index> static void ReadGuidByte(MovementReadState& s) { s.data.ReadByteSeq(s.guid[Index]); }
+
+template<uint8 Index> static void ReadHasTransportGuidByte(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.tguid[Index] = s.data.ReadBit();
+}
+
+template<uint8 Index> static void ReadTransportGuidByte(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.data.ReadByteSeq(s.tguid[Index]);
+}
+
+static void ReadGenericDword(MovementReadState& s) { s.data.read_skip<uint32>(); }
+static void ReadExtraElement(MovementReadState& s) { s.extras->ReadNextElement(s.data); }
+static void ReadGeneric2bits(MovementReadState& s) { s.data.ReadBits(2); }
+static void ReadUnkUIntCount(MovementReadState& s) { s.bitcounterLoop = s.data.ReadBits(22); }
+
+static void ReadUnkUIntLoop(MovementReadState& s)
+{
+    for (uint32 i = 0; i != s.bitcounterLoop; i++)
+        s.data.read_skip<uint32>();
+}
+
+static void ReadFlushBits(MovementReadState& s) { s.data.FlushBits(); }
+static void ReadHasMovementFlags(MovementReadState& s) { s.mi->flags = !s.data.ReadBit(); }
+static void ReadHasMovementFlags2(MovementReadState& s) { s.mi->flags2 = !s.data.ReadBit(); }
+static void ReadHasTimestamp(MovementReadState& s) { s.mi->time = !s.data.ReadBit(); }
+static void ReadHasOrientation(MovementReadState& s) { s.mi->pos.m_orientation = !s.data.ReadBit() ? 1.0f : 0.0f; }
+static void ReadHasTransportData(MovementReadState& s) { s.hasTransportData = s.data.ReadBit(); }
+
+static void ReadHasTransportTime2(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.mi->has_t_time2 = s.data.ReadBit();
+}
+
+static void ReadHasTransportTime3(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.mi->has_t_time3 = s.data.ReadBit();
+}
+
+static void ReadHasPitch(MovementReadState& s) { s.mi->HavePitch = !s.data.ReadBit(); }
+static void ReadHasFallData(MovementReadState& s) { s.mi->hasFallData = s.data.ReadBit(); }
+
+static void ReadHasFallDirection(MovementReadState& s)
+{
+    if (s.mi->hasFallData)
+        s.mi->hasFallDirection = s.data.ReadBit();
+}
+
+static void ReadHasSplineElevation(MovementReadState& s) { s.mi->HaveSplineElevation = !s.data.ReadBit(); }
+static void ReadHasSpline(MovementReadState& s) { s.hasSpline = s.data.ReadBit(); }
+
+static void ReadMovementFlags(MovementReadState& s)
+{
+    if (s.mi->flags)
+        s.mi->flags = s.data.ReadBits(30);
+}
+
+static void ReadMovementFlags2(MovementReadState& s)
+{
+    if (s.mi->flags2)
+        s.mi->flags2 = s.data.ReadBits(13);
+}
+
+static void ReadTimestamp(MovementReadState& s)
+{
+    if (s.mi->time)
+        s.data >> s.mi->time;
+}
+
+static void ReadPositionX(MovementReadState& s) { s.data >> s.mi->pos.m_positionX; }
+static void ReadPositionY(MovementReadState& s) { s.data >> s.mi->pos.m_positionY; }
+static void ReadPositionZ(MovementReadState& s) { s.data >> s.mi->pos.m_positionZ; }
+
+static void ReadOrientation(MovementReadState& s)
+{
+    if (s.mi->pos.m_orientation != 0.0f)
+        s.mi->pos.SetOrientation(s.data.read<float>());
+}
+
+static void ReadTransportPositionX(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.data >> s.mi->t_pos.m_positionX;
+}
+
+static void ReadTransportPositionY(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.data >> s.mi->t_pos.m_positionY;
+}
+
+static void ReadTransportPositionZ(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.data >> s.mi->t_pos.m_positionZ;
+}
+
+static void ReadTransportOrientation(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.mi->t_pos.SetOrientation(s.data.read<float>());
+}
+
+static void ReadTransportSeat(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.data >> s.mi->t_seat;
+}
+
+static void ReadTransportTime(MovementReadState& s)
+{
+    if (s.hasTransportData)
+        s.data >> s.mi->t_time;
+}
+
+static void ReadTransportTime2(MovementReadState& s)
+{
+    if (s.hasTransportData && s.mi->has_t_time2)
+        s.data >> s.mi->t_time2;
+}
+
+static void ReadTransportTime3(MovementReadState& s)
+{
+    if (s.hasTransportData && s.mi->has_t_time3)
+        s.data >> s.mi->t_time3;
+}
+
+static void ReadPitch(MovementReadState& s)
+{
+    if (s.mi->HavePitch)
+        s.data >> s.mi->pitch;
+}
+
+static void ReadFallTime(MovementReadState& s)
+{
+    if (s.mi->hasFallData)
+        s.data >> s.mi->fallTime;
+}
+
+static void ReadFallVerticalSpeed(MovementReadState& s)
+{
+    if (s.mi->hasFallData)
+        s.data >> s.mi->j_zspeed;
+}
+
+static void ReadFallCosAngle(MovementReadState& s)
+{
+    if (s.mi->hasFallData && s.mi->hasFallDirection)
+        s.data >> s.mi->j_cosAngle;
+}
+
+static void ReadFallSinAngle(MovementReadState& s)
+{
+    if (s.mi->hasFallData && s.mi->hasFallDirection)
+        s.data >> s.mi->j_sinAngle;
+}
+
+static void ReadFallHorizontalSpeed(MovementReadState& s)
+{
+    if (s.mi->hasFallData && s.mi->hasFallDirection)
+        s.data >> s.mi->j_xyspeed;
+}
+
+static void ReadSplineElevation(MovementReadState& s)
+{
+    if (s.mi->HaveSplineElevation)
+        s.data >> s.mi->splineElevation;
+}
+
+static void ReadSkipBit(MovementReadState& s) { s.data.ReadBit(); }
+static void ReadHasUnkTime(MovementReadState& s) { s.mi->Alive32 = !s.data.ReadBit(); }
+
+static void ReadUnkTime(MovementReadState& s)
+{
+    if (s.mi->Alive32)
+        s.data >> s.mi->Alive32;
+}
+
+static void ReadCounter(MovementReadState& s) { s.data.read_skip<uint32>(); }
+
+static void ReadInvalidElement(MovementReadState& /*s*/)
+{
+    ASSERT(false && "Incorrect sequence element detected at ReadMovementInfo");
+}
+
+static MovementElementReader const HasGuidByteReaders[8] =
+{
+    &ReadHasGuidByte<0>, &ReadHasGuidByte<1>, &ReadHasGuidByte<2>, &ReadHasGuidByte<3>,
+    &ReadHasGuidByte<4>, &ReadHasGuidByte<5>, &ReadHasGuidByte<6>, &ReadHasGuidByte<7>
+};
+
+static MovementElementReader const GuidByteReaders[8] =
+{
+    &ReadGuidByte<0>, &ReadGuidByte<1>, &ReadGuidByte<2>, &ReadGuidByte<3>,
+    &ReadGuidByte<4>, &ReadGuidByte<5>, &ReadGuidByte<6>, &ReadGuidByte<7>
+};
+
+static MovementElementReader const HasTransportGuidByteReaders[8] =
+{
+    &ReadHasTransportGuidByte<0>, &ReadHasTransportGuidByte<1>, &ReadHasTransportGuidByte<2>, &ReadHasTransportGuidByte<3>,
+    &ReadHasTransportGuidByte<4>, &ReadHasTransportGuidByte<5>, &ReadHasTransportGuidByte<6>, &ReadHasTransportGuidByte<7>
+};
+
+static MovementElementReader const TransportGuidByteReaders[8] =
+{
+    &ReadTransportGuidByte<0>, &ReadTransportGuidByte<1>, &ReadTransportGuidByte<2>, &ReadTransportGuidByte<3>,
+    &ReadTransportGuidByte<4>, &ReadTransportGuidByte<5>, &ReadTransportGuidByte<6>, &ReadTransportGuidByte<7>
+};
+
+static MovementElementReader GetElementReader(MovementStatusElements element)
+{
+    if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+        return HasGuidByteReaders[element - MSEHasGuidByte0];
+
+    if (element >= MSEHasTransportGuidByte0 && element <= MSEHasTransportGuidByte7)
+        return HasTransportGuidByteReaders[element - MSEHasTransportGuidByte0];
+
+    if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+        return GuidByteReaders[element - MSEGuidByte0];
+
+    if (element >= MSETransportGuidByte0 && element <= MSETransportGuidByte7)
+        return TransportGuidByteReaders[element - MSETransportGuidByte0];
+
+    if (element >= MSEGenericDword0 && element <= MSEGenericDword7)
+        return &ReadGenericDword;
+
+    switch (element)
+    {
+        case MSEExtraElement:           return &ReadExtraElement;
+        case MSEGeneric2bits0:          return &ReadGeneric2bits;
+        case MSEUnkUIntCount:           return &ReadUnkUIntCount;
+        case MSEUnkUIntLoop:            return &ReadUnkUIntLoop;
+        case MSEFlushBits:              return &ReadFlushBits;
+        case MSEHasMovementFlags:       return &ReadHasMovementFlags;
+        case MSEHasMovementFlags2:      return &ReadHasMovementFlags2;
+        case MSEHasTimestamp:           return &ReadHasTimestamp;
+        case MSEHasOrientation:         return &ReadHasOrientation;
+        case MSEHasTransportData:       return &ReadHasTransportData;
+        case MSEHasTransportTime2:      return &ReadHasTransportTime2;
+        case MSEHasTransportTime3:      return &ReadHasTransportTime3;
+        case MSEHasPitch:               return &ReadHasPitch;
+        case MSEHasFallData:            return &ReadHasFallData;
+        case MSEHasFallDirection:       return &ReadHasFallDirection;
+        case MSEHasSplineElevation:     return &ReadHasSplineElevation;
+        case MSEHasSpline:              return &ReadHasSpline;
+        case MSEMovementFlags:          return &ReadMovementFlags;
+        case MSEMovementFlags2:         return &ReadMovementFlags2;
+        case MSETimestamp:              return &ReadTimestamp;
+        case MSEPositionX:              return &ReadPositionX;
+        case MSEPositionY:              return &ReadPositionY;
+        case MSEPositionZ:              return &ReadPositionZ;
+        case MSEOrientation:            return &ReadOrientation;
+        case MSETransportPositionX:     return &ReadTransportPositionX;
+        case MSETransportPositionY:     return &ReadTransportPositionY;
+        case MSETransportPositionZ:     return &ReadTransportPositionZ;
+        case MSETransportOrientation:   return &ReadTransportOrientation;
+        case MSETransportSeat:          return &ReadTransportSeat;
+        case MSETransportTime:          return &ReadTransportTime;
+        case MSETransportTime2:         return &ReadTransportTime2;
+        case MSETransportTime3:         return &ReadTransportTime3;
+        case MSEPitch:                  return &ReadPitch;
+        case MSEFallTime:               return &ReadFallTime;
+        case MSEFallVerticalSpeed:      return &ReadFallVerticalSpeed;
+        case MSEFallCosAngle:           return &ReadFallCosAngle;
+        case MSEFallSinAngle:           return &ReadFallSinAngle;
+        case MSEFallHorizontalSpeed:    return &ReadFallHorizontalSpeed;
+        case MSESplineElevation:        return &ReadSplineElevation;
+        case MSEZeroBit:
+        case MSEOneBit:                 return &ReadSkipBit;
+        case MSEHasUnkTime:             return &ReadHasUnkTime;
+        case MSEUnkTime:                return &ReadUnkTime;
+        case MSECounter:                return &ReadCounter;
+        default:                        break;
+    }
+
+    return NULL;
+}
+
+/*** Writers. ***/
+
+template<uint8 Index> static void WriteHasGuidByte(MovementWriteState& s) { s.data.WriteBit(s.guid[Index]); }
+template<uint8 Index> static void WriteGuidByte(MovementWriteState& s) { s.data.WriteByteSeq(s.guid[Index]); }
+
+template<uint8 Index> static void WriteHasTransportGuidByte(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data.WriteBit(s.tguid[Index]);
+}
+
+template<uint8 Index> static void WriteTransportGuidByte(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data.WriteByteSeq(s.tguid[Index]);
+}
+
+static void WriteExtraElement(MovementWriteState& s) { s.extras->WriteNextElement(s.data); }
+static void WriteUnkUIntCount(MovementWriteState& s) { s.data.WriteBits(0, 22); }
+static void WriteUnkUIntLoop(MovementWriteState& /*s*/) { }
+static void WriteCounter(MovementWriteState& s) { s.data << uint32(0); } // movement counter
+static void WriteFlushBits(MovementWriteState& s) { s.data.FlushBits(); }
+static void WriteHasMovementFlags(MovementWriteState& s) { s.data.WriteBit(!s.hasMovementFlags); }
+static void WriteHasMovementFlags2(MovementWriteState& s) { s.data.WriteBit(!s.hasMovementFlags2); }
+static void WriteHasTimestamp(MovementWriteState& s) { s.data.WriteBit(!s.mi->time); }
+static void WriteHasOrientation(MovementWriteState& s) { s.data.WriteBit(!s.mi->pos.HasOrientation()); }
+static void WriteHasTransportData(MovementWriteState& s) { s.data.WriteBit(s.hasTransportData); }
+
+static void WriteHasTransportTime2(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data.WriteBit(s.mi->has_t_time2);
+}
+
+static void WriteHasTransportTime3(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data.WriteBit(s.mi->has_t_time3);
+}
+
+static void WriteHasPitch(MovementWriteState& s) { s.data.WriteBit(!s.mi->HavePitch); }
+static void WriteHasFallData(MovementWriteState& s) { s.data.WriteBit(s.mi->hasFallData); }
+
+static void WriteHasFallDirection(MovementWriteState& s)
+{
+    if (s.mi->hasFallData)
+        s.data.WriteBit(s.mi->hasFallDirection);
+}
+
+static void WriteHasSplineElevation(MovementWriteState& s) { s.data.WriteBit(!s.mi->HaveSplineElevation); }
+static void WriteHasSpline(MovementWriteState& s) { s.data.WriteBit(s.hasSpline); }
+
+static void WriteMovementFlags(MovementWriteState& s)
+{
+    if (s.hasMovementFlags)
+        s.data.WriteBits(s.mi->flags, 30);
+}
+
+static void WriteMovementFlags2(MovementWriteState& s)
+{
+    if (s.hasMovementFlags2)
+        s.data.WriteBits(s.mi->flags2, 13);
+}
+
+static void WriteTimestamp(MovementWriteState& s)
+{
+    if (s.mi->time)
+        s.data << s.mi->time;
+}
+
+static void WritePositionX(MovementWriteState& s) { s.data << s.mi->pos.m_positionX; }
+static void WritePositionY(MovementWriteState& s) { s.data << s.mi->pos.m_positionY; }
+static void WritePositionZ(MovementWriteState& s) { s.data << s.mi->pos.m_positionZ; }
+
+static void WriteOrientation(MovementWriteState& s)
+{
+    if (s.mi->pos.HasOrientation())
+        s.data << s.mi->pos.GetOrientation();
+}
+
+static void WriteTransportPositionX(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data << s.mi->t_pos.m_positionX;
+}
+
+static void WriteTransportPositionY(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data << s.mi->t_pos.m_positionY;
+}
+
+static void WriteTransportPositionZ(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data << s.mi->t_pos.m_positionZ;
+}
+
+static void WriteTransportOrientation(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data << s.mi->t_pos.GetOrientation();
+}
+
+static void WriteTransportSeat(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data << s.mi->t_seat;
+}
+
+static void WriteTransportTime(MovementWriteState& s)
+{
+    if (s.hasTransportData)
+        s.data << s.mi->t_time;
+}
+
+static void WriteTransportTime2(MovementWriteState& s)
+{
+    if (s.hasTransportData && s.mi->has_t_time2)
+        s.data << s.mi->t_time2;
+}
+
+static void WriteTransportTime3(MovementWriteState& s)
+{
+    if (s.hasTransportData && s.mi->has_t_time3)
+        s.data << s.mi->t_time3;
+}
+
+static void WritePitch(MovementWriteState& s)
+{
+    if (s.mi->HavePitch)
+        s.data << s.mi->pitch;
+}
+
+static void WriteFallTime(MovementWriteState& s)
+{
+    if (s.mi->hasFallData)
+        s.data << s.mi->fallTime;
+}
+
+static void WriteFallVerticalSpeed(MovementWriteState& s)
+{
+    if (s.mi->hasFallData)
+        s.data << s.mi->j_zspeed;
+}
+
+static void WriteFallCosAngle(MovementWriteState& s)
+{
+    if (s.mi->hasFallData && s.mi->hasFallDirection)
+        s.data << s.mi->j_cosAngle;
+}
+
+static void WriteFallSinAngle(MovementWriteState& s)
+{
+    if (s.mi->hasFallData && s.mi->hasFallDirection)
+        s.data << s.mi->j_sinAngle;
+}
+
+static void WriteFallHorizontalSpeed(MovementWriteState& s)
+{
+    if (s.mi->hasFallData && s.mi->hasFallDirection)
+        s.data << s.mi->j_xyspeed;
+}
+
+static void WriteSplineElevation(MovementWriteState& s)
+{
+    if (s.mi->HaveSplineElevation)
+        s.data << s.mi->splineElevation;
+}
+
+static void WriteZeroBit(MovementWriteState& s) { s.data.WriteBit(0); }
+static void WriteOneBit(MovementWriteState& s) { s.data.WriteBit(1); }
+static void WriteHasUnkTime(MovementWriteState& s) { s.data.WriteBit(!s.mi->Alive32); }
+
+static void WriteUnkTime(MovementWriteState& s)
+{
+    if (s.mi->Alive32)
+        s.data << s.mi->Alive32;
+}
+
+static void WriteInvalidElement(MovementWriteState& /*s*/)
+{
+    ASSERT(false && "Incorrect sequence element detected at WriteMovementInfo");
+}
+
+static MovementElementWriter const HasGuidByteWriters[8] =
+{
+    &WriteHasGuidByte<0>, &WriteHasGuidByte<1>, &WriteHasGuidByte<2>, &WriteHasGuidByte<3>,
+    &WriteHasGuidByte<4>, &WriteHasGuidByte<5>, &WriteHasGuidByte<6>, &WriteHasGuidByte<7>
+};
+
+static MovementElementWriter const GuidByteWriters[8] =
+{
+    &WriteGuidByte<0>, &WriteGuidByte<1>, &WriteGuidByte<2>, &WriteGuidByte<3>,
+    &WriteGuidByte<4>, &WriteGuidByte<5>, &WriteGuidByte<6>, &WriteGuidByte<7>
+};
+
+static MovementElementWriter const HasTransportGuidByteWriters[8] =
+{
+    &WriteHasTransportGuidByte<0>, &WriteHasTransportGuidByte<1>, &WriteHasTransportGuidByte<2>, &WriteHasTransportGuidByte<3>,
+    &WriteHasTransportGuidByte<4>, &WriteHasTransportGuidByte<5>, &WriteHasTransportGuidByte<6>, &WriteHasTransportGuidByte<7>
+};
+
+static MovementElementWriter const TransportGuidByteWriters[8] =
+{
+    &WriteTransportGuidByte<0>, &WriteTransportGuidByte<1>, &WriteTransportGuidByte<2>, &WriteTransportGuidByte<3>,
+    &WriteTransportGuidByte<4>, &WriteTransportGuidByte<5>, &WriteTransportGuidByte<6>, &WriteTransportGuidByte<7>
+};
+
+static MovementElementWriter GetElementWriter(MovementStatusElements element)
+{
+    if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+        return HasGuidByteWriters[element - MSEHasGuidByte0];
+
+    if (element >= MSEHasTransportGuidByte0 && element <= MSEHasTransportGuidByte7)
+        return HasTransportGuidByteWriters[element - MSEHasTransportGuidByte0];
+
+    if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+        return GuidByteWriters[element - MSEGuidByte0];
+
+    if (element >= MSETransportGuidByte0 && element <= MSETransportGuidByte7)
+        return TransportGuidByteWriters[element - MSETransportGuidByte0];
+
+    switch (element)
+    {
+        case MSEExtraElement:           return &WriteExtraElement;
+        case MSEUnkUIntCount:           return &WriteUnkUIntCount;
+        case MSEUnkUIntLoop:            return &WriteUnkUIntLoop;
+        case MSECounter:                return &WriteCounter;
+        case MSEFlushBits:              return &WriteFlushBits;
+        case MSEHasMovementFlags:       return &WriteHasMovementFlags;
+        case MSEHasMovementFlags2:      return &WriteHasMovementFlags2;
+        case MSEHasTimestamp:           return &WriteHasTimestamp;
+        case MSEHasOrientation:         return &WriteHasOrientation;
+        case MSEHasTransportData:       return &WriteHasTransportData;
+        case MSEHasTransportTime2:      return &WriteHasTransportTime2;
+        case MSEHasTransportTime3:      return &WriteHasTransportTime3;
+        case MSEHasPitch:               return &WriteHasPitch;
+        case MSEHasFallData:            return &WriteHasFallData;
+        case MSEHasFallDirection:       return &WriteHasFallDirection;
+        case MSEHasSplineElevation:     return &WriteHasSplineElevation;
+        case MSEHasSpline:              return &WriteHasSpline;
+        case MSEMovementFlags:          return &WriteMovementFlags;
+        case MSEMovementFlags2:         return &WriteMovementFlags2;
+        case MSETimestamp:              return &WriteTimestamp;
+        case MSEPositionX:              return &WritePositionX;
+        case MSEPositionY:              return &WritePositionY;
+        case MSEPositionZ:              return &WritePositionZ;
+        case MSEOrientation:            return &WriteOrientation;
+        case MSETransportPositionX:     return &WriteTransportPositionX;
+        case MSETransportPositionY:     return &WriteTransportPositionY;
+        case MSETransportPositionZ:     return &WriteTransportPositionZ;
+        case MSETransportOrientation:   return &WriteTransportOrientation;
+        case MSETransportSeat:          return &WriteTransportSeat;
+        case MSETransportTime:          return &WriteTransportTime;
+        case MSETransportTime2:         return &WriteTransportTime2;
+        case MSETransportTime3:         return &WriteTransportTime3;
+        case MSEPitch:                  return &WritePitch;
+        case MSEFallTime:               return &WriteFallTime;
+        case MSEFallVerticalSpeed:      return &WriteFallVerticalSpeed;
+        case MSEFallCosAngle:           return &WriteFallCosAngle;
+        case MSEFallSinAngle:           return &WriteFallSinAngle;
+        case MSEFallHorizontalSpeed:    return &WriteFallHorizontalSpeed;
+        case MSESplineElevation:        return &WriteSplineElevation;
+        case MSEZeroBit:                return &WriteZeroBit;
+        case MSEOneBit:                 return &WriteOneBit;
+        case MSEHasUnkTime:             return &WriteHasUnkTime;
+        case MSEUnkTime:                return &WriteUnkTime;
+        default:                        break;
+    }
+
+    return NULL;
+}
+
+/*** Codecs. ***/
+
+void MovementCodec::Read(MovementReadState& state) const
+{
+    for (std::vector<MovementElementReader>::const_iterator itr = _readers.begin(); itr != _readers.end(); ++itr)
+        (*itr)(state);
+}
+
+void MovementCodec::Write(MovementWriteState& state) const
+{
+    for (std::vector<MovementElementWriter>::const_iterator itr = _writers.begin(); itr != _writers.end(); ++itr)
+        (*itr)(state);
+}
+
+void LoadMovementCodecs()
+{
+    uint32 oldMSTime = getMSTime();
+
+    // opcodes sharing a sequence share its codec
+    static std::map<MovementStatusElements const*, MovementCodec> codecs;
+    codecs.clear();
+
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        MovementCodecs[opcode] = NULL;
+
+        MovementStatusElements const* sequence = GetMovementStatusElementsSequence(Opcodes(opcode));
+        if (!sequence)
+            continue;
+
+        std::map<MovementStatusElements const*, MovementCodec>::iterator itr = codecs.find(sequence);
+        if (itr == codecs.end())
+        {
+            itr = codecs.insert(std::make_pair(sequence, MovementCodec())).first;
+            for (MovementStatusElements const* element = sequence; *element != MSEEnd; ++element)
+            {
+                // elements valid in one direction only fail when used, as the interpreter did
+                MovementElementReader reader = GetElementReader(*element);
+                MovementElementWriter writer = GetElementWriter(*element);
+                itr->second._readers.push_back(reader ? reader : &ReadInvalidElement);
+                itr->second._writers.push_back(writer ? writer : &WriteInvalidElement);
+            }
+        }
+
+        MovementCodecs[opcode] = &itr->second;
+    }
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Compiled %u movement status sequences in %u ms", uint32(codecs.size()), GetMSTimeDiffToNow(oldMSTime));
+}
+
+MovementCodec const* GetMovementCodec(Opcodes opcode)
+{
+    if (uint32(opcode) >= NUM_OPCODE_HANDLERS)
+        return NULL;
+
+    return MovementCodecs[opcode];
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MOVEMENT_CODEC_H
+#define _MOVEMENT_CODEC_H
+
+#include "MovementStructures.h"
+
+#include <vector>
+
+struct MovementInfo;
+
+// State of a movement block being read, shared by the element readers
+struct MovementReadState
+{
+    MovementReadState(WorldPacket& packet, MovementInfo* info, ExtraMovementStatusElement* extraElements) :
+        data(packet), mi(info), extras(extraElements), hasTransportData(false), hasSpline(false), bitcounterLoop(0) { }
+
+    WorldPacket& data;
+    MovementInfo* mi;
+    ExtraMovementStatusElement* extras;
+
+    ObjectGuid guid;
+    ObjectGuid tguid;
+    bool hasTransportData;
+    bool hasSpline;
+    uint32 bitcounterLoop;
+};
+
+// State of a movement block being written, shared by the element writers
+struct MovementWriteState
+{
+    MovementWriteState(WorldPacket& packet, MovementInfo const* info, ExtraMovementStatusElement* extraElements) :
+        data(packet), mi(info), extras(extraElements),
+        hasMovementFlags(false), hasMovementFlags2(false), hasTransportData(false), hasSpline(false) { }
+
+    WorldPacket& data;
+    MovementInfo const* mi;
+    ExtraMovementStatusElement* extras;
+
+    ObjectGuid guid;
+    ObjectGuid tguid;
+    bool hasMovementFlags;
+    bool hasMovementFlags2;
+    bool hasTransportData;
+    bool hasSpline;
+};
+
+typedef void (*MovementElementReader)(MovementReadState& state);
+typedef void (*MovementElementWriter)(MovementWriteState& state);
+
+/*
+ * Movement status sequence of an opcode, compiled once at startup into the
+ * list of the functions handling each of its elements, so reading or writing
+ * a movement packet no longer interprets the MovementStatusElements one by
+ * one. Built by LoadMovementCodecs() from GetMovementStatusElementsSequence(),
+ * which stays the only description of the packet layouts.
+ */
+class MovementCodec
+{
+    friend void LoadMovementCodecs();
+
+    public:
+        void Read(MovementReadState& state) const;
+        void Write(MovementWriteState& state) const;
+
+    private:
+        std::vector<MovementElementReader> _readers;
+        std::vector<MovementElementWriter> _writers;
+};
+
+void LoadMovementCodecs();
+
+// NULL for opcodes without movement status sequence
+MovementCodec const* GetMovementCodec(Opcodes opcode);
+
+#endif
@@ -24,6 +24,7 @@
 #include "MoveSplineInit.h"
 #include "MoveSpline.h"
 #include "VMapFactory.h"
+#include "PathGenerator.h"
 
 #define MIN_QUIET_DISTANCE 28.0f
 #define MAX_QUIET_DISTANCE 43.0f
@@ -109,10 +110,18 @@ void FleeingMovementGenerator<T>::_setTargetLocation(T* owner)
         return;
     }
 
+    // don't flee into cliffs, pick another point instead of a partial path
+    PathGenerator path(owner);
+    if (!path.CalculatePath(x, y, z) || path.GetPathType() == PATHFIND_INCOMPLETE)
+    {
+        i_nextCheckTime.Reset(200);
+        return;
+    }
+
     owner->AddUnitState(UNIT_STATE_FLEEING_MOVE);
 
     Movement::MoveSplineInit init(owner);
-    init.MoveTo(x, y, z);
+    init.MovebyPath(path.GetPath());
     init.SetWalk(false);
     init.Launch();
 }
@@ -22,6 +22,7 @@
 #include "WorldPacket.h"
 #include "MoveSplineInit.h"
 #include "MoveSpline.h"
+#include "PathGenerator.h"
 
 // ========== HomeMovementGenerator ============ //
 
@@ -46,9 +47,13 @@ void HomeMovementGenerator<Creature>::_setTargetLocation(Creature* owner)
     float x, y, z, o;
     owner->GetHomePosition(x, y, z, o);
 
+    // always get home, straight through if the terrain has no way back
+    PathGenerator path(owner);
+    path.CalculatePath(x, y, z, true);
+
     Movement::MoveSplineInit init(owner);
     init.SetFacing(o);
-    init.MoveTo(x, y, z);
+    init.MovebyPath(path.GetPath());
     init.SetWalk(false);
     init.Launch();
 
@@ -142,14 +142,33 @@ void TargetedMovementGeneratorMedium<T,D>::_setTargetLocation(T* owner)
             return;
     */
 
+    owner->UpdateAllowedPositionZ(x, y, z);
+
+    if (!i_path)
+        i_path = new PathGenerator(owner);
+
+    // pets following their master may cut through when there is no path
+    bool forceDest = owner->GetTypeId() == TYPEID_UNIT && owner->ToCreature()->isPet() && owner->HasUnitState(UNIT_STATE_FOLLOW);
+    bool hasPath = i_path->CalculatePath(x, y, z, forceDest);
+
+    // unreachable: go straight to the target as before the path finder, and search again only after a second.
+    // The same for a partial path or a path ending out of reach of the target, the recheck in DoUpdate() would
+    // search again on every tick
+    float reach_dist = i_target->GetObjectSize() + owner->GetObjectSize() + MELEE_RANGE - 0.5f + i_offset;
+    G3D::Vector3 targetPos(i_target->GetPositionX(), i_target->GetPositionY(), i_target->GetPositionZ());
+    if (!hasPath || i_path->GetPathType() == PATHFIND_INCOMPLETE ||
+        (i_path->GetActualEndPosition() - targetPos).squaredLength() >= reach_dist * reach_dist)
+        i_recheckDistance.Reset(1000);
+
     D::_addUnitStateMove(owner);
     i_targetReached = false;
     i_recalculateTravel = false;
 
-    owner->UpdateAllowedPositionZ(x, y, z);
-
     Movement::MoveSplineInit init(owner);
-    init.MoveTo(x, y, z);
+    if (hasPath)
+        init.MovebyPath(i_path->GetPath());
+    else
+        init.MoveTo(x, y, z);
     init.SetWalk(((D*)this)->EnableWalking());
     // Using the same condition for facing target as the one that is used for SetInFront on movement end - applies to ChaseMovementGenerator mostly.
     if (i_angle == 0.f)
@@ -23,6 +23,7 @@
 #include "FollowerReference.h"
 #include "Timer.h"
 #include "Unit.h"
+#include "PathGenerator.h"
 
 class TargetedMovementGeneratorBase
 {
@@ -38,8 +39,8 @@ template<class T, typename D>
 class TargetedMovementGeneratorMedium : public MovementGeneratorMedium< T, D >, public TargetedMovementGeneratorBase
 {
     protected:
-        TargetedMovementGeneratorMedium(Unit* owner, float offset, float angle) : TargetedMovementGeneratorBase(owner), i_recheckDistance(0), i_offset(offset), i_angle(angle), i_recalculateTravel(false), i_targetReached(false) { }
-        ~TargetedMovementGeneratorMedium() { }
+        TargetedMovementGeneratorMedium(Unit* owner, float offset, float angle) : TargetedMovementGeneratorBase(owner), i_path(NULL), i_recheckDistance(0), i_offset(offset), i_angle(angle), i_recalculateTravel(false), i_targetReached(false) { }
+        ~TargetedMovementGeneratorMedium() { delete i_path; }
 
     public:
         bool DoUpdate(T* owner, uint32 diff);
@@ -51,6 +52,7 @@ class TargetedMovementGeneratorMedium : public MovementGeneratorMedium< T, D >,
     protected:
         void _setTargetLocation(T* owner);
 
+        PathGenerator* i_path;
         TimeTrackerSmall i_recheckDistance;
         float i_offset;
         float i_angle;
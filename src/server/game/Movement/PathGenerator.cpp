@@ -0,0 +1,557 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathGenerator.h"
+#include "NavTile.h"
+#include "Map.h"
+#include "Creature.h"
+#include "World.h"
+
+#include <ace/OS_NS_sys_time.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+#define NAV_CELLS_PER_MAP           (MAX_NUMBER_OF_GRIDS * NAV_TILE_CELLS)
+#define PATH_MAX_SEARCH_RETRIES     3                       // searches redone after a vmap obstacle was found
+#define PATH_TERRAIN_TOLERANCE      5.0f                    // max distance to the cell ground to be "on the terrain"
+#define PATH_LOS_HEIGHT             2.0f
+#define PATH_WATER_COST             2.0f
+#define PATH_DIAGONAL_FACTOR        1.41421356f
+
+PathQueryStats PathGenerator::_stats;
+
+namespace
+{
+    inline uint32 MakeCellId(uint32 x, uint32 y) { return (x << 16) | y; }
+    inline uint32 GetCellIdX(uint32 id) { return id >> 16; }
+    inline uint32 GetCellIdY(uint32 id) { return id & 0xFFFF; }
+
+    inline uint64 MakeEdgeKey(uint32 a, uint32 b)
+    {
+        return a < b ? (uint64(a) << 32) | b : (uint64(b) << 32) | a;
+    }
+
+    inline float GetCellCenter(uint32 c)
+    {
+        return (float(MAX_NUMBER_OF_GRIDS / 2) - (c + 0.5f) / NAV_TILE_CELLS) * SIZE_OF_GRIDS;
+    }
+
+    inline bool ComputeCell(float x, float y, uint32& cellX, uint32& cellY)
+    {
+        float fx = NAV_TILE_CELLS * (float(MAX_NUMBER_OF_GRIDS / 2) - x / SIZE_OF_GRIDS);
+        float fy = NAV_TILE_CELLS * (float(MAX_NUMBER_OF_GRIDS / 2) - y / SIZE_OF_GRIDS);
+        if (fx < 0.0f || fy < 0.0f || fx >= float(NAV_CELLS_PER_MAP) || fy >= float(NAV_CELLS_PER_MAP))
+            return false;
+
+        cellX = uint32(fx);
+        cellY = uint32(fy);
+        return true;
+    }
+
+    // octile distance in yards
+    inline float GetCellDistance(uint32 a, uint32 b)
+    {
+        float dx = fabs(float(GetCellIdX(a)) - float(GetCellIdX(b)));
+        float dy = fabs(float(GetCellIdY(a)) - float(GetCellIdY(b)));
+        return (std::max(dx, dy) + (PATH_DIAGONAL_FACTOR - 1.0f) * std::min(dx, dy)) * NAV_CELL_SIZE;
+    }
+
+    struct SearchNode
+    {
+        SearchNode() : cost(0.0f), parent(0), closed(false) { }
+        SearchNode(float c, uint32 p) : cost(c), parent(p), closed(false) { }
+
+        float cost;
+        uint32 parent;
+        bool closed;
+    };
+}
+
+bool PathCache::Find(uint64 key, NavCellPath& cells, uint8& type)
+{
+    EntryMap::iterator itr = _entries.find(key);
+    if (itr == _entries.end())
+        return false;
+
+    _lru.splice(_lru.begin(), _lru, itr->second.lru);
+    cells = itr->second.cells;
+    type = itr->second.type;
+    return true;
+}
+
+void PathCache::Insert(uint64 key, NavCellPath const& cells, uint8 type)
+{
+    uint32 capacity = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_SIZE);
+    if (!capacity)
+        return;
+
+    EntryMap::iterator itr = _entries.find(key);
+    if (itr != _entries.end())
+    {
+        _lru.splice(_lru.begin(), _lru, itr->second.lru);
+        itr->second.cells = cells;
+        itr->second.type = type;
+        return;
+    }
+
+    while (_entries.size() >= capacity)
+    {
+        _entries.erase(_lru.back());
+        _lru.pop_back();
+    }
+
+    _lru.push_front(key);
+    Entry& entry = _entries[key];
+    entry.cells = cells;
+    entry.type = type;
+    entry.lru = _lru.begin();
+
+    for (NavCellPath::const_iterator cell = cells.begin(); cell != cells.end(); ++cell)
+    {
+        uint32 grid = MakeCellId(GetCellIdX(*cell) / NAV_TILE_CELLS, GetCellIdY(*cell) / NAV_TILE_CELLS);
+        if (std::find(entry.grids.begin(), entry.grids.end(), grid) == entry.grids.end())
+            entry.grids.push_back(grid);
+    }
+}
+
+void PathCache::Clear()
+{
+    _entries.clear();
+    _lru.clear();
+}
+
+void PathCache::Erase(EntryMap::iterator itr)
+{
+    _lru.erase(itr->second.lru);
+    _entries.erase(itr);
+}
+
+void PathCache::OnNavTileLoaded()
+{
+    for (EntryMap::iterator itr = _entries.begin(); itr != _entries.end();)
+    {
+        EntryMap::iterator entry = itr++;
+        if (entry->second.type != PATHFIND_NORMAL)
+            Erase(entry);
+    }
+}
+
+void PathCache::OnNavTileUnloaded(uint32 gx, uint32 gy)
+{
+    uint32 grid = MakeCellId(gx, gy);
+    for (EntryMap::iterator itr = _entries.begin(); itr != _entries.end();)
+    {
+        EntryMap::iterator entry = itr++;
+        if (std::find(entry->second.grids.begin(), entry->second.grids.end(), grid) != entry->second.grids.end())
+            Erase(entry);
+    }
+}
+
+PathGenerator::PathGenerator(Unit const* owner) :
+    _owner(owner), _map(NULL), _type(PATHFIND_BLANK), _canSwim(true)
+{
+}
+
+NavTile const* PathGenerator::GetTile(uint32 cellX, uint32 cellY) const
+{
+    return _map->GetNavTile(cellX / NAV_TILE_CELLS, cellY / NAV_TILE_CELLS);
+}
+
+bool PathGenerator::IsPassable(uint32 cellX, uint32 cellY) const
+{
+    NavTile const* tile = GetTile(cellX, cellY);
+    if (!tile)
+        return false;
+
+    uint8 flags = tile->getFlags(cellX % NAV_TILE_CELLS, cellY % NAV_TILE_CELLS);
+    return (flags & NAV_CELL_WALKABLE) || (_canSwim && (flags & NAV_CELL_WATER));
+}
+
+float PathGenerator::GetCellHeight(uint32 cellX, uint32 cellY) const
+{
+    NavTile const* tile = GetTile(cellX, cellY);
+    if (!tile)
+        return INVALID_HEIGHT;
+
+    return tile->getHeight(cellX % NAV_TILE_CELLS, cellY % NAV_TILE_CELLS);
+}
+
+bool PathGenerator::IsLinked(uint32 cellX, uint32 cellY, uint8 dir) const
+{
+    NavTile const* tile = GetTile(cellX, cellY);
+    if (!tile)
+        return false;
+
+    uint32 localX = cellX % NAV_TILE_CELLS;
+    uint32 localY = cellY % NAV_TILE_CELLS;
+
+    if (!(tile->getLinks(localX, localY) & (1 << dir)))
+        return false;
+
+    int nx = int(localX) + NavDirectionX(dir);
+    int ny = int(localY) + NavDirectionY(dir);
+    uint32 neighbourX = cellX + NavDirectionX(dir);
+    uint32 neighbourY = cellY + NavDirectionY(dir);
+
+    if (neighbourX >= NAV_CELLS_PER_MAP || neighbourY >= NAV_CELLS_PER_MAP)
+        return false;
+
+    if (!IsPassable(neighbourX, neighbourY))
+        return false;
+
+    // same tile, the generator already checked the climb
+    if (nx >= 0 && ny >= 0 && nx < NAV_TILE_CELLS && ny < NAV_TILE_CELLS)
+        return true;
+
+    float dist = IsDiagonalNavDirection(dir) ? NAV_CELL_SIZE * PATH_DIAGONAL_FACTOR : NAV_CELL_SIZE;
+    return fabs(GetCellHeight(neighbourX, neighbourY) - tile->getHeight(localX, localY)) <= NAV_MAX_CLIMB_SLOPE * dist;
+}
+
+bool PathGenerator::IsOnTerrain(float x, float y, float z, uint32& cellX, uint32& cellY) const
+{
+    if (!ComputeCell(x, y, cellX, cellY) || !IsPassable(cellX, cellY))
+        return false;
+
+    NavTile const* tile = GetTile(cellX, cellY);
+    uint32 localX = cellX % NAV_TILE_CELLS;
+    uint32 localY = cellY % NAV_TILE_CELLS;
+
+    // swimming above the ground
+    if ((tile->getFlags(localX, localY) & NAV_CELL_WATER) && z > tile->getHeight(localX, localY))
+        return true;
+
+    return fabs(z - tile->getHeight(localX, localY)) <= PATH_TERRAIN_TOLERANCE;
+}
+
+bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool forceDest)
+{
+    _pathPoints.clear();
+    _type = PATHFIND_BLANK;
+    _map = _owner->GetMap();
+
+    _startPosition = G3D::Vector3(_owner->GetPositionX(), _owner->GetPositionY(), _owner->GetPositionZ());
+    _endPosition = G3D::Vector3(destX, destY, destZ);
+    _actualEndPosition = _endPosition;
+
+    ++_stats.queries;
+
+    Creature const* creature = _owner->ToCreature();
+    _canSwim = !creature || creature->canSwim();
+
+    // flying units and units without navigation data move in straight lines
+    if (!_map || !sWorld->getBoolConfig(CONFIG_ENABLE_MMAPS) || _owner->IsFlying() || (creature && (creature->CanFly() || !creature->canWalk())))
+    {
+        BuildShortcut();
+        return true;
+    }
+
+    uint32 startX, startY, endX, endY;
+    if (!IsOnTerrain(_startPosition.x, _startPosition.y, _startPosition.z, startX, startY) ||
+        !IsOnTerrain(destX, destY, destZ, endX, endY))
+    {
+        BuildShortcut();
+        return true;
+    }
+
+    uint32 startCell = MakeCellId(startX, startY);
+    uint32 endCell = MakeCellId(endX, endY);
+
+    NavCellPath cells;
+
+    // neighbours, nothing to search
+    if (abs(int(startX) - int(endX)) <= 1 && abs(int(startY) - int(endY)) <= 1)
+    {
+        cells.push_back(startCell);
+        cells.push_back(endCell);
+        _type = PATHFIND_NORMAL;
+        BuildPointPath(cells);
+        return true;
+    }
+
+    // the vmap checks of the search see the gameobjects of the owner phases, only the normal phase paths are shared
+    bool useCache = _owner->GetPhaseMask() == PHASEMASK_NORMAL;
+    uint64 key = (uint64(startCell) << 32) | endCell | (_canSwim ? 0x80000000 : 0);
+    uint8 type;
+    if (useCache && _map->GetPathCache().Find(key, cells, type))
+    {
+        ++_stats.cacheHits;
+        _type = PathType(type);
+    }
+    else
+    {
+        ++_stats.searches;
+        ACE_Time_Value searchStart = ACE_OS::gettimeofday();
+
+        BlockedEdgeSet blocked;
+        bool valid = false;
+        bool complete = false;
+        for (uint32 i = 0; i <= PATH_MAX_SEARCH_RETRIES && !valid; ++i)
+        {
+            uint32 closest;
+            complete = FindCellPath(startCell, endCell, blocked, cells, closest);
+            if (cells.size() < 2)
+                break;
+
+            SmoothPath(cells, blocked, valid);
+        }
+
+        if (!valid)
+        {
+            cells.clear();
+            _type = PATHFIND_NOPATH;
+        }
+        else
+            _type = complete ? PATHFIND_NORMAL : PATHFIND_INCOMPLETE;
+
+        uint64 searchTime;
+        (ACE_OS::gettimeofday() - searchStart).to_usec(searchTime);
+        _stats.searchTime += long(searchTime);
+
+        if (useCache)
+            _map->GetPathCache().Insert(key, cells, uint8(_type));
+    }
+
+    if (_type == PATHFIND_INCOMPLETE)
+        ++_stats.incomplete;
+    else if (_type == PATHFIND_NOPATH)
+        ++_stats.noPath;
+
+    if (_type != PATHFIND_NORMAL && forceDest)
+    {
+        BuildShortcut();
+        return true;
+    }
+
+    if (_type == PATHFIND_NOPATH)
+        return false;
+
+    BuildPointPath(cells);
+    return true;
+}
+
+bool PathGenerator::FindCellPath(uint32 startCell, uint32 endCell, BlockedEdgeSet const& blocked, NavCellPath& cells, uint32& closest)
+{
+    typedef UNORDERED_MAP<uint32, SearchNode> NodeMap;
+    typedef std::pair<float, uint32> OpenEntry;
+
+    NodeMap nodes;
+    std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry> > open;
+
+    nodes[startCell] = SearchNode(0.0f, startCell);
+    open.push(OpenEntry(GetCellDistance(startCell, endCell), startCell));
+
+    closest = startCell;
+    float closestDist = GetCellDistance(startCell, endCell);
+
+    uint32 maxNodes = sWorld->getIntConfig(CONFIG_MMAP_MAX_SEARCH_NODES);
+    uint32 expanded = 0;
+    bool found = false;
+
+    while (!open.empty())
+    {
+        uint32 current = open.top().second;
+        open.pop();
+
+        SearchNode& node = nodes[current];
+        if (node.closed)
+            continue;
+
+        node.closed = true;
+        float cost = node.cost;
+
+        if (current == endCell)
+        {
+            closest = endCell;
+            found = true;
+            break;
+        }
+
+        if (++expanded > maxNodes)
+            break;
+
+        float dist = GetCellDistance(current, endCell);
+        if (dist < closestDist)
+        {
+            closest = current;
+            closestDist = dist;
+        }
+
+        uint32 cellX = GetCellIdX(current);
+        uint32 cellY = GetCellIdY(current);
+
+        for (uint8 dir = 0; dir < MAX_NAV_DIRECTIONS; ++dir)
+        {
+            if (!IsLinked(cellX, cellY, dir))
+                continue;
+
+            uint32 neighbourX = cellX + NavDirectionX(dir);
+            uint32 neighbourY = cellY + NavDirectionY(dir);
+            uint32 neighbour = MakeCellId(neighbourX, neighbourY);
+
+            if (!blocked.empty() && blocked.find(MakeEdgeKey(current, neighbour)) != blocked.end())
+                continue;
+
+            float step = IsDiagonalNavDirection(dir) ? NAV_CELL_SIZE * PATH_DIAGONAL_FACTOR : NAV_CELL_SIZE;
+            if (GetTile(neighbourX, neighbourY)->getFlags(neighbourX % NAV_TILE_CELLS, neighbourY % NAV_TILE_CELLS) & NAV_CELL_WATER)
+                step *= PATH_WATER_COST;
+
+            float neighbourCost = cost + step;
+
+            NodeMap::iterator itr = nodes.find(neighbour);
+            if (itr != nodes.end() && (itr->second.closed || itr->second.cost <= neighbourCost))
+                continue;
+
+            nodes[neighbour] = SearchNode(neighbourCost, current);
+            open.push(OpenEntry(neighbourCost + GetCellDistance(neighbour, endCell), neighbour));
+        }
+    }
+
+    _stats.nodesExpanded += long(expanded);
+
+    cells.clear();
+    for (uint32 cell = closest; ; cell = nodes[cell].parent)
+    {
+        cells.push_back(cell);
+        if (cell == startCell)
+            break;
+    }
+
+    std::reverse(cells.begin(), cells.end());
+    return found;
+}
+
+bool PathGenerator::IsInLineOfSight(uint32 fromCell, uint32 toCell) const
+{
+    ++_stats.losChecks;
+
+    uint32 fromX = GetCellIdX(fromCell), fromY = GetCellIdY(fromCell);
+    uint32 toX = GetCellIdX(toCell), toY = GetCellIdY(toCell);
+
+    float fromZ = GetCellHeight(fromX, fromY);
+    float toZ = GetCellHeight(toX, toY);
+    if (fromZ <= INVALID_HEIGHT || toZ <= INVALID_HEIGHT)
+        return false;
+
+    return _map->isInLineOfSight(GetCellCenter(fromX), GetCellCenter(fromY), fromZ + PATH_LOS_HEIGHT,
+        GetCellCenter(toX), GetCellCenter(toY), toZ + PATH_LOS_HEIGHT, _owner->GetPhaseMask());
+}
+
+bool PathGenerator::CanWalkStraight(uint32 fromCell, uint32 toCell) const
+{
+    int fromX = GetCellIdX(fromCell), fromY = GetCellIdY(fromCell);
+    int dx = int(GetCellIdX(toCell)) - fromX;
+    int dy = int(GetCellIdY(toCell)) - fromY;
+
+    // walk the segment in half cell steps, every cell change has to follow a link
+    int steps = std::max(abs(dx), abs(dy)) * 2;
+    int cellX = fromX, cellY = fromY;
+    for (int i = 1; i <= steps; ++i)
+    {
+        int nextX = fromX + int(floor(float(dx) * i / steps + 0.5f));
+        int nextY = fromY + int(floor(float(dy) * i / steps + 0.5f));
+        if (nextX == cellX && nextY == cellY)
+            continue;
+
+        uint8 dir = 0;
+        while (dir < MAX_NAV_DIRECTIONS && (NavDirectionX(dir) != nextX - cellX || NavDirectionY(dir) != nextY - cellY))
+            ++dir;
+
+        if (dir == MAX_NAV_DIRECTIONS || !IsLinked(uint32(cellX), uint32(cellY), dir))
+            return false;
+
+        cellX = nextX;
+        cellY = nextY;
+    }
+
+    return IsInLineOfSight(fromCell, toCell);
+}
+
+void PathGenerator::SmoothPath(NavCellPath& cells, BlockedEdgeSet& blocked, bool& valid)
+{
+    NavCellPath result;
+    result.push_back(cells[0]);
+
+    size_t anchor = 0;
+    while (anchor + 1 < cells.size())
+    {
+        size_t next = anchor + 1;
+
+        // linked cells can only be separated by vmap geometry
+        if (!IsInLineOfSight(cells[anchor], cells[next]))
+        {
+            blocked.insert(MakeEdgeKey(cells[anchor], cells[next]));
+            valid = false;
+            return;
+        }
+
+        while (next + 1 < cells.size() && CanWalkStraight(cells[anchor], cells[next + 1]))
+            ++next;
+
+        result.push_back(cells[next]);
+        anchor = next;
+    }
+
+    cells.swap(result);
+    valid = true;
+}
+
+void PathGenerator::BuildShortcut()
+{
+    ++_stats.shortcuts;
+
+    _pathPoints.clear();
+    _pathPoints.push_back(_startPosition);
+    _pathPoints.push_back(_endPosition);
+    _actualEndPosition = _endPosition;
+    _type = PATHFIND_SHORTCUT;
+}
+
+void PathGenerator::BuildPointPath(NavCellPath const& cells)
+{
+    _pathPoints.clear();
+    _pathPoints.push_back(_startPosition);
+
+    // the first and (complete path) last cells are replaced by the exact positions
+    size_t last = _type == PATHFIND_NORMAL ? cells.size() - 1 : cells.size();
+    for (size_t i = 1; i < last; ++i)
+    {
+        uint32 cellX = GetCellIdX(cells[i]);
+        uint32 cellY = GetCellIdY(cells[i]);
+        float x = GetCellCenter(cellX);
+        float y = GetCellCenter(cellY);
+        float z = GetCellHeight(cellX, cellY);
+
+        // prefer the vmap floor (bridges, ramps) when it is close to the terrain
+        if (z <= INVALID_HEIGHT)
+            z = _map->GetHeight(_owner->GetPhaseMask(), x, y, MAX_HEIGHT);
+        else
+        {
+            float floor = _map->GetHeight(_owner->GetPhaseMask(), x, y, z + PATH_LOS_HEIGHT);
+            if (fabs(floor - z) <= PATH_TERRAIN_TOLERANCE)
+                z = floor;
+        }
+
+        _pathPoints.push_back(G3D::Vector3(x, y, z));
+    }
+
+    if (_type == PATHFIND_NORMAL)
+        _pathPoints.push_back(_endPosition);
+
+    _actualEndPosition = _pathPoints.back();
+}
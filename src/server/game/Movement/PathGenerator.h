@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_PATHGENERATOR_H
+#define TRINITY_PATHGENERATOR_H
+
+#include "Define.h"
+#include "UnorderedMap.h"
+#include "MoveSplineInitArgs.h"
+
+#include <ace/Atomic_Op.h>
+#include <ace/Thread_Mutex.h>
+
+#include <list>
+#include <set>
+#include <vector>
+
+class Unit;
+class Map;
+class NavTile;
+
+enum PathType
+{
+    PATHFIND_BLANK          = 0x00,                         // path not built yet
+    PATHFIND_NORMAL         = 0x01,                         // complete path over the navigation tiles
+    PATHFIND_SHORTCUT       = 0x02,                         // straight line, no navigation data (old behaviour)
+    PATHFIND_INCOMPLETE     = 0x04,                         // partial path getting closer to the destination
+    PATHFIND_NOPATH         = 0x08                          // destination can't be reached
+};
+
+// global cell id: first index << 16 | second index, both 0..MAX_NUMBER_OF_GRIDS * NAV_TILE_CELLS
+typedef std::vector<uint32> NavCellPath;
+
+/*
+ * Recently computed paths of a map, keyed by start and end cell.
+ * Only used from the thread updating the map.
+ */
+class PathCache
+{
+    public:
+        PathCache() { }
+
+        bool Find(uint64 key, NavCellPath& cells, uint8& type);
+        void Insert(uint64 key, NavCellPath const& cells, uint8 type);
+        void Clear();
+
+        // the paths which failed or stopped early may get through the new tile
+        void OnNavTileLoaded();
+        // the paths crossing the grid would read its deleted tile
+        void OnNavTileUnloaded(uint32 gx, uint32 gy);
+
+        size_t GetSize() const { return _entries.size(); }
+
+    private:
+        struct Entry
+        {
+            NavCellPath cells;
+            uint8 type;
+            std::vector<uint32> grids;                      // navigation tiles the cells are on, gx << 16 | gy
+            std::list<uint64>::iterator lru;
+        };
+
+        typedef UNORDERED_MAP<uint64, Entry> EntryMap;
+
+        void Erase(EntryMap::iterator itr);
+
+        EntryMap _entries;
+        std::list<uint64> _lru;                             // most recently used first
+};
+
+// counters of all path queries since startup, shown by .server info
+struct PathQueryStats
+{
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> queries;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> cacheHits;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> searches;         // cache misses
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> shortcuts;        // no navigation data or not on the terrain
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> incomplete;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> noPath;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> nodesExpanded;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> losChecks;
+    ACE_Atomic_Op<ACE_Thread_Mutex, long> searchTime;       // microseconds
+};
+
+/*
+ * Path finding over the navigation tiles built by mmaps_generator.
+ *
+ * A* runs on the terrain cells of the tiles loaded by the owner's map, the
+ * result is string pulled and every straight segment is checked against the
+ * vmaps (lazily, blocked edges are excluded and the search is redone). Units
+ * off the terrain (buildings, caves, dungeons without tiles) get a straight line.
+ */
+class PathGenerator
+{
+    public:
+        explicit PathGenerator(Unit const* owner);
+
+        // returns false if the path could not be built, the path type tells why
+        bool CalculatePath(float destX, float destY, float destZ, bool forceDest = false);
+
+        Movement::PointsArray const& GetPath() const { return _pathPoints; }
+        PathType GetPathType() const { return _type; }
+
+        G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
+        G3D::Vector3 const& GetEndPosition() const { return _endPosition; }
+        G3D::Vector3 const& GetActualEndPosition() const { return _actualEndPosition; }
+
+        static PathQueryStats& GetStats() { return _stats; }
+
+    private:
+        typedef std::set<uint64> BlockedEdgeSet;
+
+        NavTile const* GetTile(uint32 cellX, uint32 cellY) const;
+        bool IsPassable(uint32 cellX, uint32 cellY) const;
+        bool IsLinked(uint32 cellX, uint32 cellY, uint8 dir) const;
+        float GetCellHeight(uint32 cellX, uint32 cellY) const;
+        bool IsOnTerrain(float x, float y, float z, uint32& cellX, uint32& cellY) const;
+
+        bool FindCellPath(uint32 startCell, uint32 endCell, BlockedEdgeSet const& blocked, NavCellPath& cells, uint32& closest);
+        bool CanWalkStraight(uint32 fromCell, uint32 toCell) const;
+        bool IsInLineOfSight(uint32 fromCell, uint32 toCell) const;
+        void SmoothPath(NavCellPath& cells, BlockedEdgeSet& blocked, bool& valid);
+
+        void BuildShortcut();
+        void BuildPointPath(NavCellPath const& cells);
+
+        Unit const* const _owner;
+        Map* _map;
+
+        Movement::PointsArray _pathPoints;
+        PathType _type;
+        bool _canSwim;
+
+        G3D::Vector3 _startPosition;
+        G3D::Vector3 _endPosition;
+        G3D::Vector3 _actualEndPosition;
+
+        static PathQueryStats _stats;
+};
+
+#endif
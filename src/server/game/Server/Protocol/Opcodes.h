@@ -1533,7 +1533,8 @@ enum PacketProcessing
 {
     PROCESS_INPLACE = 0,                                        // process packet whenever we receive it - mostly for non-handled or non-implemented packets
     PROCESS_THREADUNSAFE,                                       // packet is not thread-safe - process it in World::UpdateSessions()
-    PROCESS_THREADSAFE                                          // packet is thread-safe - process it in Map::Update()
+    PROCESS_THREADSAFE,                                         // packet is thread-safe - process it in Map::Update()
+    PROCESS_SESSION                                             // packet only touches its session (and own player) - process it in Map::Update() or on the session workers when not in a map
 };
 
 class WorldPacket;
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SessionUpdater.h"
+#include "WorldSession.h"
+#include "DatabaseProfiler.h"
+
+#include <ace/Guard_T.h>
+
+#include <algorithm>
+
+SessionUpdater::SessionUpdater():
+m_lock(), m_workCondition(m_lock), m_doneCondition(m_lock),
+m_sessions(NULL), m_diff(0), m_next(0), m_pending(0),
+m_activated(false), m_shutdown(false)
+{
+}
+
+SessionUpdater::~SessionUpdater()
+{
+    deactivate();
+}
+
+int SessionUpdater::activate(size_t num_threads)
+{
+    if (m_activated || num_threads < 1)
+        return -1;
+
+    m_shutdown = false;
+
+    if (ACE_Task_Base::activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(num_threads)) == -1)
+        return -1;
+
+    m_activated = true;
+    return 0;
+}
+
+int SessionUpdater::deactivate()
+{
+    if (!m_activated)
+        return -1;
+
+    {
+        TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+        m_shutdown = true;
+        m_workCondition.broadcast();
+    }
+
+    ACE_Task_Base::wait();
+    m_activated = false;
+    return 0;
+}
+
+void SessionUpdater::Update(std::vector<WorldSession*> const& sessions, uint32 diff)
+{
+    if (!m_activated || sessions.empty())
+        return;
+
+    TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+    m_sessions = &sessions;
+    m_diff = diff;
+    m_next = 0;
+    m_pending = sessions.size();
+    m_workCondition.broadcast();
+
+    while (m_pending)
+        m_doneCondition.wait();
+
+    m_sessions = NULL;
+}
+
+int SessionUpdater::svc()
+{
+    DatabaseProfiler::SetThreadRole(DB_THREAD_ROLE_SESSION);
+
+    for (;;)
+    {
+        size_t begin, end;
+        uint32 diff;
+        std::vector<WorldSession*> const* sessions;
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            while (!m_shutdown && (!m_sessions || m_next >= m_sessions->size()))
+                m_workCondition.wait();
+
+            if (m_shutdown)
+                break;
+
+            sessions = m_sessions;
+            diff = m_diff;
+            begin = m_next;
+            end = std::min(begin + SESSION_UPDATE_CHUNK, sessions->size());
+            m_next = end;
+        }
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            WorldSession* session = (*sessions)[i];
+            SessionWorkerFilter updater(session);
+            session->Update(diff, updater);
+        }
+
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            m_pending -= end - begin;
+            if (!m_pending)
+                m_doneCondition.signal();
+        }
+    }
+
+    return 0;
+}
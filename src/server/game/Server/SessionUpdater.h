@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SESSION_UPDATER_H_INCLUDED
+#define _SESSION_UPDATER_H_INCLUDED
+
+#include <ace/Task.h>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
+#include "Define.h"
+
+#include <vector>
+
+class WorldSession;
+
+// sessions a worker takes at once
+#define SESSION_UPDATE_CHUNK 16
+
+/*
+ * Worker pool processing the packets of sessions not tied to a map (character
+ * screen, loading, logging out, far teleports) in parallel, with a
+ * SessionWorkerFilter.
+ *
+ * Called by World::UpdateSessions before its serial pass, while no map is
+ * updated. Opcodes marked PROCESS_THREADUNSAFE stop the session's parallel
+ * processing and are left, with everything queued after them, to the serial
+ * pass. Timers, query callbacks and logout stay on the world thread too.
+ */
+class SessionUpdater : protected ACE_Task_Base
+{
+    public:
+
+        SessionUpdater();
+        virtual ~SessionUpdater();
+
+        int activate(size_t num_threads);
+
+        int deactivate();
+
+        bool activated() const { return m_activated; }
+
+        // returns once the packets of all the sessions are processed
+        void Update(std::vector<WorldSession*> const& sessions, uint32 diff);
+
+        virtual int svc();
+
+    private:
+
+        ACE_Thread_Mutex m_lock;
+        ACE_Condition_Thread_Mutex m_workCondition;         // new sessions to update or shutdown
+        ACE_Condition_Thread_Mutex m_doneCondition;         // last pending session updated
+
+        std::vector<WorldSession*> const* m_sessions;
+        uint32 m_diff;
+        size_t m_next;                                      // first session not taken by a worker
+        size_t m_pending;                                   // sessions not updated yet
+
+        bool m_activated;
+        bool m_shutdown;
+};
+
+#endif //_SESSION_UPDATER_H_INCLUDED
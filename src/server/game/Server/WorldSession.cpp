@@ -90,6 +90,15 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return (player->IsInWorld() == false);
 }
 
+//only session-local and in-place packets, the world thread is waiting for us
+bool SessionWorkerFilter::Process(WorldPacket* packet)
+{
+    Opcodes opcode = DropHighBytes(packet->GetOpcode());
+    OpcodeHandler const* opHandle = opcodeTable[WOW_CLIENT][opcode];
+
+    return opHandle->packetProcessing != PROCESS_THREADUNSAFE;
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, WorldSocket* sock, AccountTypes sec, bool ispremium, uint8 expansion, time_t mute_time, LocaleConstant locale, uint32 recruiter, bool isARecruiter):
 m_muteTime(mute_time), m_timeOutTime(0), _player(NULL), m_Socket(sock),
@@ -305,17 +314,20 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     uint32 nbPacket = 0;
     std::map<uint32, OpcodeInfo> pktHandle; // opcodeId / OpcodeInfo
 
-    /// Antispam Timer update
-    if (sWorld->getBoolConfig(CONFIG_ANTISPAM_ENABLED))
-        UpdateAntispamTimer(diff);
+    if (!updater.PacketsOnly())
+    {
+        /// Antispam Timer update
+        if (sWorld->getBoolConfig(CONFIG_ANTISPAM_ENABLED))
+            UpdateAntispamTimer(diff);
 
-    /// Update Timeout timer.
-    UpdateTimeOutTime(diff);
+        /// Update Timeout timer.
+        UpdateTimeOutTime(diff);
 
-    ///- Before we process anything:
-    /// If necessary, kick the player from the character select screen
-    if (IsConnectionIdle())
-        m_Socket->CloseSocket();
+        ///- Before we process anything:
+        /// If necessary, kick the player from the character select screen
+        if (IsConnectionIdle())
+            m_Socket->CloseSocket();
+    }
 
     ///- Retrieve packets from the receive queue and call the appropriate handlers
     /// not process packets if socket already closed
@@ -356,7 +368,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
                             deletePacket = false;
                             QueuePacket(packet);
                             //! Log
-                                sLog->outDebug(LOG_FILTER_NETWORKIO, "Re-enqueueing packet with opcode %s with with status STATUS_LOGGEDIN. "
+                                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Re-enqueueing packet with opcode %s with with status STATUS_LOGGEDIN. "
                                     "Player is currently not in world yet.", GetOpcodeNameForLogging(packet->GetOpcode(), WOW_CLIENT).c_str());
                         }
                     }
@@ -455,6 +467,10 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             break;
     }
 
+    // everything else is done by the next World::UpdateSessions() pass
+    if (updater.PacketsOnly())
+        return true;
+
     if (m_Socket && !m_Socket->IsClosed() && _warden)
         _warden->Update();
 
@@ -714,7 +730,7 @@ void WorldSession::LogoutPlayer(bool Save)
 
         SendPacket(&data);
 
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "SESSION: Sent SMSG_LOGOUT_COMPLETE Message");
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "SESSION: Sent SMSG_LOGOUT_COMPLETE Message");
 
         //! Since each account can only have one online character at any given time, ensure all characters for active account are marked as offline
         CharacterDatabase.PExecute("UPDATE characters SET online = 0 WHERE account = '%u'", GetAccountId());
@@ -1003,10 +1019,10 @@ void WorldSession::ReadAddonsInfo(WorldPacket &data)
 
         uint32 currentTime;
         addonInfo >> currentTime;
-        sLog->outDebug(LOG_FILTER_NETWORKIO, "ADDON: CurrentTime: %u", currentTime);
+        TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "ADDON: CurrentTime: %u", currentTime);
 
         if (addonInfo.rpos() != addonInfo.size())
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "packet under-read!");
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "packet under-read!");
     }
     else
         sLog->outError(LOG_FILTER_GENERAL, "Addon packet uncompress error!");
@@ -1120,14 +1136,14 @@ bool WorldSession::IsAddonRegistered(const std::string& prefix) const
 
 void WorldSession::HandleUnregisterAddonPrefixesOpcode(WorldPacket& /*recvPacket*/) // empty packet
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_UNREGISTER_ALL_ADDON_PREFIXES");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_UNREGISTER_ALL_ADDON_PREFIXES");
 
     _registeredAddonPrefixes.clear();
 }
 
 void WorldSession::HandleAddonRegisteredPrefixesOpcode(WorldPacket& recvPacket)
 {
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_ADDON_REGISTERED_PREFIXES");
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WORLD: Received CMSG_ADDON_REGISTERED_PREFIXES");
 
     // This is always sent after CMSG_UNREGISTER_ALL_ADDON_PREFIXES
 
@@ -207,6 +207,8 @@ public:
 
     virtual bool Process(WorldPacket* /*packet*/) { return true; }
     virtual bool ProcessLogout() const { return true; }
+    // only handle queued packets: no timers, query callbacks, warden or logout
+    virtual bool PacketsOnly() const { return false; }
     static Opcodes DropHighBytes(Opcodes opcode) { return Opcodes(opcode & 0xFFFF); }
     static uint16 DropHighBytes(uint16 opcode) { return opcode & 0xFFFF; }
 
@@ -236,6 +238,19 @@ public:
     virtual bool Process(WorldPacket* packet);
 };
 
+//process packets of sessions not tied to a map on the SessionUpdater workers,
+//up to the first thread-unsafe one, before World::UpdateSessions() handles the rest
+class SessionWorkerFilter : public PacketFilter
+{
+public:
+    explicit SessionWorkerFilter(WorldSession* pSession) : PacketFilter(pSession) {}
+    ~SessionWorkerFilter() {}
+
+    virtual bool Process(WorldPacket* packet);
+    virtual bool ProcessLogout() const { return false; }
+    virtual bool PacketsOnly() const { return true; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -47,6 +47,9 @@
 #include "AccountMgr.h"
 #include "zlib.h"
 
+#define COMPRESSED_DATA_HEADER_SIZE 12
+#define COMPRESSED_DATA_ADLER_SEED  0x9827D8F1
+
 #if defined(__GNUC__)
 #pragma pack(1)
 #else
@@ -174,8 +177,6 @@ int WorldSocket::SendPacket(WorldPacket const* pct)
 {
     ASSERT(!(pct->GetOpcode() & COMPRESSED_OPCODE_MASK)); // Packet not compressed
 
-    ACE_GUARD_RETURN (LockType, Guard, m_OutBufferLock, -1);
-
     if (closing_)
         return -1;
 
@@ -183,70 +184,102 @@ int WorldSocket::SendPacket(WorldPacket const* pct)
     if (sPacketLog->CanLogPacket() && pct->GetOpcode() == SMSG_UPDATE_OBJECT)
         sPacketLog->LogPacket(*pct, SERVER_TO_CLIENT);
 
-    sLog->outInfo(LOG_FILTER_OPCODES, "S->C: %s", GetOpcodeNameForLogging(pct->GetOpcode(), WOW_SERVER).c_str());
+    TC_LOG_INFO(LOG_FILTER_OPCODES, "S->C: %s", GetOpcodeNameForLogging(pct->GetOpcode(), WOW_SERVER).c_str());
 
-    WorldPacket compressed;
-    size_t size = pct->size();
+    if (!CanCompressPacket(*pct))
+        return EnqueuePacket(pct);
 
-    if (false && size >= 45
-        && pct->GetOpcode() != MSG_VERIFY_CONNECTIVITY
-        && pct->GetOpcode() != SMSG_MOTD
-        )
+    // Deflate on the calling thread (map worker or world thread), the reactor thread draining
+    // m_OutBuffer never waits for zlib. The stream is shared by the whole connection, so the
+    // compressed packet is queued before m_CompressLock is released to keep the stream order.
     {
-        size += sizeof(uint32);
+        ACE_GUARD_RETURN (LockType, Guard, m_CompressLock, -1);
 
-        size_t reserved_size = deflateBound(m_zstream, size) + 12;
-        compressed.resize(reserved_size);
-        compressed.put<uint32>(0, size);
-        
-        ByteBuffer buff(size);
-        {
-            buff.append((uint32)pct->GetOpcode());
-            buff.append(pct->contents(), pct->size());
-        }
+        WorldPacket compressed;
+        if (CompressPacket(*pct, compressed))
+            return EnqueuePacket(&compressed);
+    }
 
-        uint32 adler_1 = (uint32)adler32(2552748273u, (const Bytef*)buff.contents(), buff.size());
-        
-        compressed.put<uint32>(4, adler_1);
+    // The client inflates every packet with one stream, it can't follow a stream missing data
+    // and this build has no usable SMSG_RESET_COMPRESSION_CONTEXT: drop the connection.
+    CloseSocket();
+    return -1;
+}
 
-        m_zstream->next_in = (Bytef*)buff.contents();
-        m_zstream->avail_in = buff.size();
+bool WorldSocket::CanCompressPacket(WorldPacket const& pct) const
+{
+    uint32 threshold = sWorld->getIntConfig(CONFIG_COMPRESSION_THRESHOLD);
+    if (!threshold || pct.size() < threshold)
+        return false;
 
-        m_zstream->next_out = (Bytef*)(compressed.contents() + 12);
-        m_zstream->avail_out = reserved_size - 12;
+    // the client only inflates once the session is authenticated
+    if (!m_Crypt.IsInitialized())
+        return false;
 
-        int z_res = deflate(m_zstream, Z_SYNC_FLUSH);
+    return pct.GetOpcode() != MSG_VERIFY_CONNECTIVITY && pct.GetOpcode() != SMSG_MOTD;
+}
 
-        size_t totalOut = m_zstream->next_out - compressed.contents();
-        sLog->outError(LOG_FILTER_NETWORKIO, "totalOut = %u, reserved_size = %u, m_zstream->avail_out = %u", (uint32)totalOut, (uint32)reserved_size, (uint32)m_zstream->avail_out);
-        ASSERT(totalOut == reserved_size - m_zstream->avail_out);
-        
-        uint32 adler_2 = (uint32)adler32(2552748273u, (const Bytef*)(compressed.contents() + 12), totalOut - 12);
-        
-        compressed.put<uint32>(8, adler_2);
+bool WorldSocket::CompressPacket(WorldPacket const& pct, WorldPacket& compressed)
+{
+    // SMSG_COMPRESSED_DATA: uint32 uncompressed size, uint32 adler of the uncompressed data,
+    // uint32 adler of the deflated data, deflated (opcode + payload)
+    uint32 opcode = pct.GetOpcode();
+    uint32 size = pct.size() + sizeof(uint32);
 
-        if (z_res != Z_OK)
-        {
-            sLog->outError(LOG_FILTER_NETWORKIO, "Can't compress packet (zlib: deflate) Error code: %i (%s)",z_res,zError(z_res));
-        }
-        else if (m_zstream->avail_in != 0)
-        {
-            sLog->outError(LOG_FILTER_NETWORKIO, "Can't compress packet (zlib: deflate not greedy)");
-        }
-        else
-        {
-            compressed.resize(totalOut + 12);
-            compressed.SetOpcode(SMSG_COMPRESSED_DATA);
-            pct = &compressed;
-            size = pct->size();
-        }
+    // deflateBound assumes Z_FINISH, leave room for the sync flush marker
+    size_t reservedSize = deflateBound(m_zstream, size) + 16;
+    compressed.resize(COMPRESSED_DATA_HEADER_SIZE + reservedSize);
+
+    uint32 uncompressedAdler = adler32(COMPRESSED_DATA_ADLER_SEED, (Bytef const*)&opcode, sizeof(uint32));
+    if (!pct.empty())
+        uncompressedAdler = adler32(uncompressedAdler, (Bytef const*)pct.contents(), pct.size());
+
+    m_zstream->next_out = (Bytef*)(compressed.contents() + COMPRESSED_DATA_HEADER_SIZE);
+    m_zstream->avail_out = reservedSize;
+
+    m_zstream->next_in = (Bytef*)&opcode;
+    m_zstream->avail_in = sizeof(uint32);
 
-        m_zstream->next_in = NULL;
-        m_zstream->next_out = NULL;
-        m_zstream->avail_in = 0;
-        m_zstream->avail_out = 0;
+    int z_res = deflate(m_zstream, pct.empty() ? Z_SYNC_FLUSH : Z_NO_FLUSH);
+    if (z_res == Z_OK && !pct.empty())
+    {
+        m_zstream->next_in = (Bytef*)pct.contents();
+        m_zstream->avail_in = pct.size();
+        z_res = deflate(m_zstream, Z_SYNC_FLUSH);
     }
 
+    size_t deflatedSize = reservedSize - m_zstream->avail_out;
+    bool done = z_res == Z_OK && !m_zstream->avail_in && m_zstream->avail_out;
+
+    m_zstream->next_in = NULL;
+    m_zstream->next_out = NULL;
+    m_zstream->avail_in = 0;
+    m_zstream->avail_out = 0;
+
+    if (!done)
+    {
+        sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::CompressPacket: can't compress %s (zlib: %i %s), closing the connection",
+            GetOpcodeNameForLogging(opcode, WOW_SERVER).c_str(), z_res, zError(z_res));
+        // never deflate more data after a partly written packet
+        deflateReset(m_zstream);
+        return false;
+    }
+
+    compressed.put<uint32>(0, size);
+    compressed.put<uint32>(4, uncompressedAdler);
+    compressed.put<uint32>(8, adler32(COMPRESSED_DATA_ADLER_SEED, (Bytef const*)(compressed.contents() + COMPRESSED_DATA_HEADER_SIZE), deflatedSize));
+    compressed.resize(COMPRESSED_DATA_HEADER_SIZE + deflatedSize);
+    compressed.SetOpcode(SMSG_COMPRESSED_DATA);
+    return true;
+}
+
+int WorldSocket::EnqueuePacket(WorldPacket const* pct)
+{
+    ACE_GUARD_RETURN (LockType, Guard, m_OutBufferLock, -1);
+
+    if (closing_)
+        return -1;
+
     ServerPktHeader header(!m_Crypt.IsInitialized() ? pct->size() + 2 : pct->size(), pct->GetOpcode(), &m_Crypt);
 
     if (m_OutBuffer->space() >= pct->size() + header.getHeaderLength() && msg_queue()->is_empty())
@@ -369,14 +402,14 @@ int WorldSocket::handle_input (ACE_HANDLE)
                 return Update();                           // interesting line, isn't it ?
             }
 
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer error closing connection errno = %s", ACE_OS::strerror (errno));
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer error closing connection errno = %s", ACE_OS::strerror (errno));
 
             errno = ECONNRESET;
             return -1;
         }
     case 0:
         {
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer has closed connection");
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::handle_input: Peer has closed connection");
 
             errno = ECONNRESET;
             return -1;
@@ -835,9 +868,8 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
     //if (sPacketLog->CanLogPacket())
     //    sPacketLog->LogPacket(*new_pct, CLIENT_TO_SERVER);
 
-    std::string opcodeName = GetOpcodeNameForLogging(opcode, WOW_CLIENT);
     if (opcode != CMSG_PLAYER_MOVE)
-        sLog->outInfo(LOG_FILTER_OPCODES, "C->S: %s", opcodeName.c_str());
+        TC_LOG_INFO(LOG_FILTER_OPCODES, "C->S: %s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
 
     try
     {
@@ -858,14 +890,14 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             }
             case CMSG_KEEP_ALIVE:
             {
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
                 sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
                 return 0;
             }
             case CMSG_LOG_DISCONNECT:
             {
                 new_pct->rfinish(); // contains uint32 disconnectReason;
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", opcodeName.c_str());
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
                 sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
                 return 0;
             }
@@ -883,7 +915,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             // first 4 bytes become the opcode (2 dropped)
             case MSG_VERIFY_CONNECTIVITY:
             {
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", opcodeName.c_str());
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
                 sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
                 std::string str;
                 *new_pct >> str;
@@ -893,7 +925,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
             }
             /*case CMSG_ENABLE_NAGLE:
             {
-                sLog->outDebug(LOG_FILTER_NETWORKIO, "%s", opcodeName.c_str());
+                TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "%s", GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str());
                 sScriptMgr->OnPacketReceive(this, WorldPacket(*new_pct));
                 return m_Session ? m_Session->HandleEnableNagleAlgorithm() : -1;
             }*/
@@ -933,7 +965,7 @@ int WorldSocket::ProcessIncoming(WorldPacket* new_pct)
     catch (ByteBufferException &)
     {
         sLog->outError(LOG_FILTER_NETWORKIO, "WorldSocket::ProcessIncoming ByteBufferException occured while parsing an instant handled packet %s from client %s, accountid=%i. Disconnected client.",
-            opcodeName.c_str(), GetRemoteAddress().c_str(), m_Session ? int32(m_Session->GetAccountId()) : -1);
+            GetOpcodeNameForLogging(opcode, WOW_CLIENT).c_str(), GetRemoteAddress().c_str(), m_Session ? int32(m_Session->GetAccountId()) : -1);
         new_pct->hexlike();
         return -1;
     }
@@ -1142,7 +1174,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
     if (expansion > world_expansion)
         expansion = world_expansion;
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: (s,v) check s: %s v: %s",
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: (s,v) check s: %s v: %s",
         fields[5].GetCString(),
         fields[4].GetCString());
 
@@ -1152,7 +1184,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
         if (strcmp (fields[2].GetCString(), GetRemoteAddress().c_str()))
         {
             SendAuthResponse(AUTH_FAILED, false, 0);
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Sent Auth Response (Account IP differs).");
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Sent Auth Response (Account IP differs).");
             return -1;
         }
     }
@@ -1230,7 +1262,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
 
     // Check locked state for server
     AccountTypes allowedAccountType = sWorld->GetPlayerSecurityLimit();
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "Allowed Level: %u Player Level %u", allowedAccountType, AccountTypes(security));
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Allowed Level: %u Player Level %u", allowedAccountType, AccountTypes(security));
     if (allowedAccountType > SEC_PLAYER && AccountTypes(security) < allowedAccountType)
     {
         SendAuthResponse(AUTH_UNAVAILABLE, false, 0);
@@ -1263,7 +1295,7 @@ int WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
         return -1;
     }*/
 
-    sLog->outDebug(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Client '%s' authenticated successfully from %s.",
+    TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "WorldSocket::HandleAuthSession: Client '%s' authenticated successfully from %s.",
         account.c_str(),
         address.c_str());
 
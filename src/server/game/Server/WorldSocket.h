@@ -153,6 +153,16 @@ class WorldSocket : public WorldHandler
         /// Drain the queue if its not empty.
         int handle_output_queue (GuardType& g);
 
+        /// Put a packet on the output buffer or queue, takes m_OutBufferLock.
+        int EnqueuePacket (const WorldPacket* pct);
+
+        /// Packets at least Compression.Threshold bytes long are sent as SMSG_COMPRESSED_DATA.
+        bool CanCompressPacket (const WorldPacket& pct) const;
+
+        /// Deflate pct into compressed, caller must hold m_CompressLock.
+        /// On failure the stream is reset, the connection can't be used any more.
+        bool CompressPacket (const WorldPacket& pct, WorldPacket& compressed);
+
         /// process one incoming packet.
         /// @param new_pct received packet, note that you need to delete it.
         int ProcessIncoming (WorldPacket* new_pct);
@@ -202,6 +212,9 @@ class WorldSocket : public WorldHandler
         /// Mutex for protecting output related data.
         LockType m_OutBufferLock;
 
+        /// Mutex for m_zstream, held until the compressed packet is queued.
+        LockType m_CompressLock;
+
         /// Buffer used for writing output.
         ACE_Message_Block* m_OutBuffer;
 
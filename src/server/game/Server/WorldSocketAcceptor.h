@@ -44,7 +44,7 @@ protected:
 
     virtual int handle_timeout(const ACE_Time_Value& /*current_time*/, const void* /*act = 0*/)
     {
-        sLog->outDebug(LOG_FILTER_GENERAL, "Resuming acceptor");
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Resuming acceptor");
         reactor()->cancel_timer(this, 1);
         return reactor()->register_handler(this, ACE_Event_Handler::ACCEPT_MASK);
     }
@@ -155,7 +155,7 @@ class ReactorRunnable : protected ACE_Task_Base
 
         virtual int svc()
         {
-            sLog->outDebug(LOG_FILTER_GENERAL, "Network Thread Starting");
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Network Thread Starting");
 
             ACE_ASSERT (m_Reactor);
 
@@ -192,7 +192,7 @@ class ReactorRunnable : protected ACE_Task_Base
                 }
             }
 
-            sLog->outDebug(LOG_FILTER_GENERAL, "Network Thread exits");
+            TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Network Thread exits");
 
             return 0;
         }
@@ -244,7 +244,7 @@ WorldSocketMgr::StartReactiveIO (ACE_UINT16 port, const char* address)
 
     m_NetThreads = new ReactorRunnable[m_NetThreadsCount];
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "Max allowed socket connections %d", ACE::max_handles());
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Max allowed socket connections %d", ACE::max_handles());
 
     // -1 means use default
     m_SockOutKBuff = ConfigMgr::GetIntDefault ("Network.OutKBuff", -1);
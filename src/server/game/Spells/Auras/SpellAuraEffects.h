@@ -67,6 +67,7 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
             {
                 m_amount = amount;
                 GetBase()->SetNeedClientUpdateForTargets();
+                InvalidateTargetModifierCaches();
             }
             m_canBeRecalculated = false;
         }
@@ -168,6 +169,7 @@ class AuraEffect : public std::enable_shared_from_this<AuraEffect>
 
     private:
         bool IsPeriodicTickCrit(Unit* target, Unit const* caster) const;
+        void InvalidateTargetModifierCaches();
 
     public:
         // aura effect apply/remove handlers
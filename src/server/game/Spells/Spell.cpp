@@ -1152,8 +1152,11 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
     if (uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList))
     {
         SkyMistCore::WorldObjectSpellConeTargetCheck check(coneAngle, radius, m_caster, m_spellInfo, selectionType, condList);
-        SkyMistCore::WorldObjectListSearcher<SkyMistCore::WorldObjectSpellConeTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-        SearchTargets<SkyMistCore::WorldObjectListSearcher<SkyMistCore::WorldObjectSpellConeTargetCheck> >(searcher, containerTypeMask, m_caster, m_caster, radius);
+        // cone checks are slower than the range one, let the batched range test drop the objects first
+        m_searchedTargets.clear();
+        SkyMistCore::WorldObjectRangeListSearcher<SkyMistCore::WorldObjectSpellConeTargetCheck> searcher(m_searchedTargets, check, m_caster, radius, containerTypeMask);
+        SearchTargets<SkyMistCore::WorldObjectRangeListSearcher<SkyMistCore::WorldObjectSpellConeTargetCheck> >(searcher, containerTypeMask, m_caster, m_caster, radius);
+        targets.insert(targets.end(), m_searchedTargets.begin(), m_searchedTargets.end());
 
         CallScriptObjectAreaTargetSelectHandlers(targets, effIndex);
 
@@ -1877,8 +1880,10 @@ void Spell::SelectImplicitTrajTargets()
 
     std::list<WorldObject*> targets;
     SkyMistCore::WorldObjectSpellTrajTargetCheck check(dist2d, m_targets.GetSrcPos(), m_caster, m_spellInfo);
-    SkyMistCore::WorldObjectListSearcher<SkyMistCore::WorldObjectSpellTrajTargetCheck> searcher(m_caster, targets, check, GRID_MAP_TYPE_MASK_ALL);
-    SearchTargets<SkyMistCore::WorldObjectListSearcher<SkyMistCore::WorldObjectSpellTrajTargetCheck> > (searcher, GRID_MAP_TYPE_MASK_ALL, m_caster, m_targets.GetSrcPos(), dist2d);
+    m_searchedTargets.clear();
+    SkyMistCore::WorldObjectRangeListSearcher<SkyMistCore::WorldObjectSpellTrajTargetCheck> searcher(m_searchedTargets, check, m_targets.GetSrcPos(), dist2d, GRID_MAP_TYPE_MASK_ALL);
+    SearchTargets<SkyMistCore::WorldObjectRangeListSearcher<SkyMistCore::WorldObjectSpellTrajTargetCheck> > (searcher, GRID_MAP_TYPE_MASK_ALL, m_caster, m_targets.GetSrcPos(), dist2d);
+    targets.insert(targets.end(), m_searchedTargets.begin(), m_searchedTargets.end());
     if (targets.empty())
         return;
 
@@ -2154,14 +2159,21 @@ WorldObject* Spell::SearchNearbyTarget(float range, SpellTargetObjectTypes objec
     return target;
 }
 
-void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
+void Spell::SearchAreaTargets(std::vector<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
 {
     uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList);
     if (!containerTypeMask)
         return;
     SkyMistCore::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
-    SkyMistCore::WorldObjectListSearcher<SkyMistCore::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
-    SearchTargets<SkyMistCore::WorldObjectListSearcher<SkyMistCore::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
+    SkyMistCore::WorldObjectRangeListSearcher<SkyMistCore::WorldObjectSpellAreaTargetCheck> searcher(targets, check, position, range, containerTypeMask);
+    SearchTargets<SkyMistCore::WorldObjectRangeListSearcher<SkyMistCore::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
+}
+
+void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Position const* position, Unit* referer, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectionType, ConditionList* condList)
+{
+    m_searchedTargets.clear();
+    SearchAreaTargets(m_searchedTargets, range, position, referer, objectType, selectionType, condList);
+    targets.insert(targets.end(), m_searchedTargets.begin(), m_searchedTargets.end());
 }
 
 void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTargets, WorldObject* target, SpellTargetObjectTypes objectType, SpellTargetCheckTypes selectType, ConditionList* condList, bool isChainHeal)
@@ -2199,31 +2211,33 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
     if (isBouncingFar)
         searchRadius *= chainTargets;
 
-    std::list<WorldObject*> tempTargets;
+    std::vector<WorldObject*>& tempTargets = m_searchedTargets;
+    tempTargets.clear();
     SearchAreaTargets(tempTargets, searchRadius, target, m_caster, objectType, selectType, condList);
-    tempTargets.remove(target);
+    tempTargets.erase(std::remove(tempTargets.begin(), tempTargets.end(), target), tempTargets.end());
 
     // remove targets which are always invalid for chain spells
     // for some spells allow only chain targets in front of caster (swipe for example)
     if (!isBouncingFar)
     {
-        for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end();)
+        for (std::vector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end();)
         {
-            std::list<WorldObject*>::iterator checkItr = itr++;
-            if (!m_caster->HasInArc(static_cast<float>(M_PI), *checkItr))
-                tempTargets.erase(checkItr);
+            if (!m_caster->HasInArc(static_cast<float>(M_PI), *itr))
+                itr = tempTargets.erase(itr);
+            else
+                ++itr;
         }
     }
 
     while (chainTargets)
     {
         // try to get unit for next chain jump
-        std::list<WorldObject*>::iterator foundItr = tempTargets.end();
+        std::vector<WorldObject*>::iterator foundItr = tempTargets.end();
         // get unit with highest hp deficit in dist
         if (isChainHeal)
         {
             uint32 maxHPDeficit = 0;
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (std::vector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
                 if (Unit* unitTarget = (*itr)->ToUnit())
                 {
@@ -2239,7 +2253,7 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
         // get closest object
         else
         {
-            for (std::list<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
+            for (std::vector<WorldObject*>::iterator itr = tempTargets.begin(); itr != tempTargets.end(); ++itr)
             {
                 if (foundItr == tempTargets.end())
                 {
@@ -9143,7 +9157,7 @@ void Spell::LoadScripts()
             m_loadedScripts.erase(bitr);
             continue;
         }
-        sLog->outDebug(LOG_FILTER_SPELLS_AURAS, "Spell::LoadScripts: Script `%s` for spell `%u` is loaded now", (*itr)->_GetScriptName()->c_str(), m_spellInfo->Id);
+        TC_LOG_DEBUG(LOG_FILTER_SPELLS_AURAS, "Spell::LoadScripts: Script `%s` for spell `%u` is loaded now", (*itr)->_GetScriptName()->c_str(), m_spellInfo->Id);
         (*itr)->Register();
         ++itr;
     }
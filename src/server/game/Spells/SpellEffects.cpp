@@ -283,7 +283,7 @@ pEffect SpellEffects[TOTAL_SPELL_EFFECTS]=
 };
 void Spell::EffectNULL(SpellEffIndex /*effIndex*/)
 {
-    sLog->outDebug(LOG_FILTER_SPELLS_AURAS, "WORLD: Spell Effect DUMMY");
+    TC_LOG_DEBUG(LOG_FILTER_SPELLS_AURAS, "WORLD: Spell Effect DUMMY");
 }
 
 void Spell::EffectUnused(SpellEffIndex /*effIndex*/)
@@ -7564,6 +7564,10 @@ void Spell::EffectSkinPlayerCorpse(SpellEffIndex /*effIndex*/)
     if ((m_caster->GetTypeId() != TYPEID_PLAYER) || (unitTarget->GetTypeId() != TYPEID_PLAYER) || (unitTarget->isAlive()))
         return;
 
+    // far target, its values are only written by the update of its own map
+    if (!unitTarget->IsInMap(m_caster))
+        return;
+
     unitTarget->ToPlayer()->RemovedInsignia((Player*)m_caster);
 }
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StartupTaskGraph.h"
+#include "Common.h"
+#include "Log.h"
+#include "Timer.h"
+
+#include <ace/Guard_T.h>
+#include <ace/OS_NS_unistd.h>
+
+#include <algorithm>
+
+// the names are the former loading messages, without their trailing dots in the timings
+static std::string GetTaskLabel(std::string const& name)
+{
+    std::string::size_type end = name.find_last_not_of('.');
+    return end == std::string::npos ? name : name.substr(0, end + 1);
+}
+
+StartupTaskGraph::StartupTaskGraph() :
+m_lock(), m_readyCondition(m_lock), m_remaining(0), m_startTime(0), m_duration(0), m_threads(0)
+{
+}
+
+StartupTaskGraph::~StartupTaskGraph()
+{
+    for (std::vector<Node>::iterator itr = m_tasks.begin(); itr != m_tasks.end(); ++itr)
+        delete itr->task;
+}
+
+StartupTaskGraph::TaskId StartupTaskGraph::AddTask(char const* name, StartupTask* task, TaskId dep1, TaskId dep2, TaskId dep3)
+{
+    TaskId id = TaskId(m_tasks.size());
+
+    m_tasks.push_back(Node());
+    Node& node = m_tasks.back();
+    node.name = name;
+    node.task = task;
+    node.pending = 0;
+    node.start = 0;
+    node.end = 0;
+
+    if (dep1 != STARTUP_NO_TASK)
+        After(id, dep1);
+    if (dep2 != STARTUP_NO_TASK)
+        After(id, dep2);
+    if (dep3 != STARTUP_NO_TASK)
+        After(id, dep3);
+
+    return id;
+}
+
+void StartupTaskGraph::After(TaskId task, TaskId dependency)
+{
+    // also rules out cycles. ASSERT only logs, a bad dependency would index out of range or never become ready
+    if (dependency >= task || task >= m_tasks.size())
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "StartupTaskGraph: task %u can't depend on task %u, a task may only depend on tasks declared before it.", task, dependency);
+        abort();
+    }
+
+    m_tasks[task].dependencies.push_back(dependency);
+    m_tasks[dependency].dependents.push_back(task);
+}
+
+void StartupTaskGraph::Run(uint32 threads)
+{
+    if (m_tasks.empty())
+        return;
+
+    if (!threads)
+        threads = uint32(std::max(ACE_OS::num_processors(), long(1)));
+
+    if (threads > m_tasks.size())
+        threads = uint32(m_tasks.size());
+
+    m_ready.clear();
+    for (TaskId id = 0; id < m_tasks.size(); ++id)
+    {
+        m_tasks[id].pending = uint32(m_tasks[id].dependencies.size());
+        if (!m_tasks[id].pending)
+            m_ready.insert(id);
+    }
+
+    m_remaining = uint32(m_tasks.size());
+    m_startTime = getMSTime();
+    m_threads = threads;
+
+    if (threads > 1)
+    {
+        if (activate(THR_NEW_LWP | THR_JOINABLE | THR_INHERIT_SCHED, int(threads)) != -1)
+        {
+            wait();
+            m_duration = GetMSTimeDiffToNow(m_startTime);
+            return;
+        }
+
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "StartupTaskGraph: can't start %u threads, running the loaders serially.", threads);
+        m_threads = 1;
+    }
+
+    svc();
+    m_duration = GetMSTimeDiffToNow(m_startTime);
+}
+
+int StartupTaskGraph::svc()
+{
+    for (;;)
+    {
+        TaskId id;
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            while (m_remaining && m_ready.empty())
+                m_readyCondition.wait();
+
+            if (!m_remaining)
+                break;
+
+            id = *m_ready.begin();
+            m_ready.erase(m_ready.begin());
+            m_tasks[id].start = GetMSTimeDiffToNow(m_startTime);
+        }
+
+        Node& node = m_tasks[id];
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "%s", node.name.c_str());
+        node.task->Run();
+
+        {
+            TRINITY_GUARD(ACE_Thread_Mutex, m_lock);
+            node.end = GetMSTimeDiffToNow(m_startTime);
+
+            for (std::vector<TaskId>::const_iterator itr = node.dependents.begin(); itr != node.dependents.end(); ++itr)
+                if (!--m_tasks[*itr].pending)
+                    m_ready.insert(*itr);
+
+            --m_remaining;
+            m_readyCondition.broadcast();
+        }
+    }
+
+    return 0;
+}
+
+void StartupTaskGraph::LogTimings() const
+{
+    if (m_tasks.empty())
+        return;
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Ran %u startup loaders on %u threads in %u ms:", uint32(m_tasks.size()), m_threads, m_duration);
+
+    TaskId last = 0;
+    for (TaskId id = 0; id < m_tasks.size(); ++id)
+    {
+        Node const& node = m_tasks[id];
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "   %6u ms %6u ms  %s", node.start, node.end - node.start, GetTaskLabel(node.name).c_str());
+        if (node.end > m_tasks[last].end)
+            last = id;
+    }
+
+    // walks back from the task that ended last through the dependency each task waited for
+    std::string path;
+    for (TaskId id = last;;)
+    {
+        Node const& node = m_tasks[id];
+        char buf[16];
+        snprintf(buf, 16, " (%u ms)", node.end - node.start);
+        path = GetTaskLabel(node.name) + buf + (path.empty() ? "" : " -> ") + path;
+
+        if (node.dependencies.empty())
+            break;
+
+        TaskId previous = node.dependencies.front();
+        for (std::vector<TaskId>::const_iterator itr = node.dependencies.begin(); itr != node.dependencies.end(); ++itr)
+            if (m_tasks[*itr].end > m_tasks[previous].end)
+                previous = *itr;
+
+        id = previous;
+    }
+
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, ">> Critical path: %s", path.c_str());
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _STARTUP_TASK_GRAPH_H_INCLUDED
+#define _STARTUP_TASK_GRAPH_H_INCLUDED
+
+#include <ace/Task.h>
+#include <ace/Thread_Mutex.h>
+#include <ace/Condition_Thread_Mutex.h>
+
+#include "Define.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#define STARTUP_NO_TASK 0xFFFFFFFF
+
+class StartupTask
+{
+    public:
+        virtual ~StartupTask() { }
+
+        virtual void Run() = 0;
+};
+
+class StartupFunctionTask : public StartupTask
+{
+    public:
+        explicit StartupFunctionTask(void (*function)()) : _function(function) { }
+
+        void Run() { _function(); }
+
+    private:
+        void (*_function)();
+};
+
+template<class T>
+class StartupMethodTask : public StartupTask
+{
+    public:
+        StartupMethodTask(T* object, void (T::*method)()) : _object(object), _method(method) { }
+
+        void Run() { (_object->*_method)(); }
+
+    private:
+        T* _object;
+        void (T::*_method)();
+};
+
+/*
+ * Startup loaders declared with the loaders they must run after, run by a
+ * pool of threads as soon as their dependencies are done. A task may only
+ * depend on tasks declared before it, so with a single thread the loaders
+ * run in declaration order, like the former sequence of calls.
+ *
+ * Two tasks without dependency path between them may run at the same time:
+ * they must not write data the other one reads or writes.
+ */
+class StartupTaskGraph : protected ACE_Task_Base
+{
+    public:
+        typedef uint32 TaskId;
+
+        StartupTaskGraph();
+        virtual ~StartupTaskGraph();
+
+        // name is the message logged when the task starts
+        TaskId Add(char const* name, void (*function)(), TaskId dep1 = STARTUP_NO_TASK, TaskId dep2 = STARTUP_NO_TASK, TaskId dep3 = STARTUP_NO_TASK)
+        {
+            return AddTask(name, new StartupFunctionTask(function), dep1, dep2, dep3);
+        }
+
+        template<class T>
+        TaskId Add(char const* name, T* object, void (T::*method)(), TaskId dep1 = STARTUP_NO_TASK, TaskId dep2 = STARTUP_NO_TASK, TaskId dep3 = STARTUP_NO_TASK)
+        {
+            return AddTask(name, new StartupMethodTask<T>(object, method), dep1, dep2, dep3);
+        }
+
+        // for the tasks with more than three dependencies
+        void After(TaskId task, TaskId dependency);
+
+        // 0 threads: one per processor, 1: the calling thread runs every task
+        void Run(uint32 threads);
+
+        // start and duration of each task, then the chain of tasks that ended last
+        void LogTimings() const;
+
+        virtual int svc();
+
+    private:
+        struct Node
+        {
+            std::string name;
+            StartupTask* task;
+            std::vector<TaskId> dependencies;
+            std::vector<TaskId> dependents;
+            uint32 pending;                                 // dependencies not done yet
+            uint32 start;                                   // ms since Run
+            uint32 end;
+        };
+
+        TaskId AddTask(char const* name, StartupTask* task, TaskId dep1, TaskId dep2, TaskId dep3);
+
+        ACE_Thread_Mutex m_lock;
+        ACE_Condition_Thread_Mutex m_readyCondition;        // task ready or every task done
+
+        std::vector<Node> m_tasks;
+        std::set<TaskId> m_ready;                           // lowest id first, keeps the declaration order
+        uint32 m_remaining;                                 // tasks not done yet
+        uint32 m_startTime;
+        uint32 m_duration;
+        uint32 m_threads;
+};
+
+#endif //_STARTUP_TASK_GRAPH_H_INCLUDED
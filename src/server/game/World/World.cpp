@@ -54,6 +54,7 @@
 #include "OutdoorPvPMgr.h"
 #include "TemporarySummon.h"
 #include "WaypointMovementGenerator.h"
+#include "MovementCodec.h"
 #include "VMapFactory.h"
 #include "GameEventMgr.h"
 #include "PoolMgr.h"
@@ -80,6 +81,7 @@
 #include "CalendarMgr.h"
 #include "BattlefieldMgr.h"
 #include "BlackMarketMgr.h"
+#include "StartupTaskGraph.h"
 
 ACE_Atomic_Op<ACE_Thread_Mutex, bool> World::m_stopEvent = false;
 uint8 World::m_ExitCode = SHUTDOWN_EXIT_CODE;
@@ -132,6 +134,9 @@ World::World()
 /// World destructor
 World::~World()
 {
+    m_sessionUpdater.deactivate();
+    sAnticheatMgr->StopAnalyzer();
+
     ///- Empty the kicked session set
     while (!m_sessions.empty())
     {
@@ -610,6 +615,7 @@ void World::LoadConfigSettings(bool reload)
         sLog->outError(LOG_FILTER_SERVER_LOADING, "Compression level (%i) must be in range 1..9. Using default compression level (1).", m_int_configs[CONFIG_COMPRESSION]);
         m_int_configs[CONFIG_COMPRESSION] = 1;
     }
+    m_int_configs[CONFIG_COMPRESSION_THRESHOLD] = ConfigMgr::GetIntDefault("Compression.Threshold", 0);
     m_bool_configs[CONFIG_ADDON_CHANNEL] = ConfigMgr::GetBoolDefault("AddonChannel", true);
     m_bool_configs[CONFIG_CLEAN_CHARACTER_DB] = ConfigMgr::GetBoolDefault("CleanCharacterDB", false);
     m_int_configs[CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS] = ConfigMgr::GetIntDefault("PersistentCharacterCleanFlags", 0);
@@ -1179,6 +1185,10 @@ void World::LoadConfigSettings(bool reload)
     m_visibility_notify_periodInInstances = ConfigMgr::GetIntDefault("Visibility.Notify.Period.InInstances",   DEFAULT_VISIBILITY_NOTIFY_PERIOD);
     m_visibility_notify_periodInBGArenas = ConfigMgr::GetIntDefault("Visibility.Notify.Period.InBGArenas",    DEFAULT_VISIBILITY_NOTIFY_PERIOD);
 
+    m_bool_configs[CONFIG_MOVEMENT_RELAY] = ConfigMgr::GetBoolDefault("Movement.Relay.Enabled", false);
+    m_float_configs[CONFIG_MOVEMENT_RELAY_FAR_DISTANCE] = ConfigMgr::GetFloatDefault("Movement.Relay.FarDistance", 0.0f);
+    m_int_configs[CONFIG_MOVEMENT_RELAY_FAR_INTERVAL] = ConfigMgr::GetIntDefault("Movement.Relay.FarInterval", 500);
+
     ///- Load the CharDelete related config options
     m_int_configs[CONFIG_CHARDELETE_METHOD] = ConfigMgr::GetIntDefault("CharDelete.Method", 0);
     m_int_configs[CONFIG_CHARDELETE_MIN_LEVEL] = ConfigMgr::GetIntDefault("CharDelete.MinLevel", 0);
@@ -1216,6 +1226,11 @@ void World::LoadConfigSettings(bool reload)
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap support included. LineOfSight:%i, getHeight:%i, indoorCheck:%i PetLOS:%i", enableLOS, enableHeight, enableIndoor, enablePetLOS);
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "VMap data directory is: %svmaps", m_dataPath.c_str());
 
+    m_bool_configs[CONFIG_ENABLE_MMAPS] = ConfigMgr::GetBoolDefault("MoveMaps.Enable", true);
+    m_int_configs[CONFIG_MMAP_MAX_SEARCH_NODES] = ConfigMgr::GetIntDefault("MoveMaps.MaxSearchNodes", 2048);
+    m_int_configs[CONFIG_MMAP_PATH_CACHE_SIZE] = ConfigMgr::GetIntDefault("MoveMaps.PathCacheSize", 256);
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "MoveMaps support %s, data directory is: %smmaps", m_bool_configs[CONFIG_ENABLE_MMAPS] ? "enabled" : "disabled", m_dataPath.c_str());
+
     m_int_configs[CONFIG_MAX_WHO] = ConfigMgr::GetIntDefault("MaxWhoListReturns", 49);
     m_bool_configs[CONFIG_LIMIT_WHO_ONLINE] = ConfigMgr::GetBoolDefault("LimitWhoOnline", true);
     m_bool_configs[CONFIG_PET_LOS] = ConfigMgr::GetBoolDefault("vmap.petLOS", true);
@@ -1238,6 +1253,11 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = ConfigMgr::GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = ConfigMgr::GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = ConfigMgr::GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_GRID_PRELOAD_THREADS] = ConfigMgr::GetIntDefault("GridPreload.Threads", 1);
+    m_int_configs[CONFIG_SESSION_UPDATE_THREADS] = ConfigMgr::GetIntDefault("SessionUpdate.Threads", 2);
+    m_int_configs[CONFIG_DATASTORE_LOAD_THREADS] = ConfigMgr::GetIntDefault("DataStores.LoadThreads", 0);
+    m_int_configs[CONFIG_STARTUP_LOAD_THREADS] = ConfigMgr::GetIntDefault("Startup.LoadThreads", 1);
+    m_int_configs[CONFIG_GRID_PRELOAD_LOOKAHEAD] = ConfigMgr::GetIntDefault("GridPreload.LookAhead", 10);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = ConfigMgr::GetIntDefault("Command.LookupMaxResults", 0);
 
     // chat logging
@@ -1289,6 +1309,23 @@ void World::LoadConfigSettings(bool reload)
     // MySQL ping time interval
     m_int_configs[CONFIG_DB_PING_INTERVAL] = ConfigMgr::GetIntDefault("MaxPingTime", 30);
 
+    // Synchronous query instrumentation
+    m_bool_configs[CONFIG_DB_PROFILER] = ConfigMgr::GetBoolDefault("Database.Profiler.Enable", false);
+    m_int_configs[CONFIG_DB_PROFILER_LOG_INTERVAL] = ConfigMgr::GetIntDefault("Database.Profiler.LogInterval", 300);
+    m_int_configs[CONFIG_DB_BLOCKING_QUERY_CHECK] = ConfigMgr::GetIntDefault("Database.BlockingQueryCheck", BLOCKING_QUERY_LOG);
+    if (m_int_configs[CONFIG_DB_BLOCKING_QUERY_CHECK] > BLOCKING_QUERY_ASSERT)
+    {
+        sLog->outError(LOG_FILTER_SERVER_LOADING, "Database.BlockingQueryCheck (%u) must be in range 0..2. Set to %u.", m_int_configs[CONFIG_DB_BLOCKING_QUERY_CHECK], BLOCKING_QUERY_LOG);
+        m_int_configs[CONFIG_DB_BLOCKING_QUERY_CHECK] = BLOCKING_QUERY_LOG;
+    }
+    DatabaseProfiler::SetEnabled(m_bool_configs[CONFIG_DB_PROFILER]);
+    DatabaseProfiler::SetBlockingQueryPolicy(BlockingQueryPolicy(m_int_configs[CONFIG_DB_BLOCKING_QUERY_CHECK]));
+    if (reload)
+    {
+        m_timers[WUPDATE_DBSTATS].SetInterval(m_int_configs[CONFIG_DB_PROFILER_LOG_INTERVAL] * IN_MILLISECONDS);
+        m_timers[WUPDATE_DBSTATS].Reset();
+    }
+
     //Reset Duel Cooldown
     m_bool_configs[CONFIG_DUEL_RESET_COOLDOWN_ON_START] = ConfigMgr::GetBoolDefault("DuelReset.Cooldown.OnStart", false);
     m_bool_configs[CONFIG_DUEL_RESET_COOLDOWN_ON_FINISH] = ConfigMgr::GetBoolDefault("DuelReset.Cooldown.OnFinish", false);
@@ -1365,6 +1402,28 @@ void World::LoadConfigSettings(bool reload)
 
 extern void LoadGameObjectModelList();
 
+// Startup loaders without a method of the right signature, see SetInitialWorldSettings
+
+static void LoadConditions()
+{
+    sConditionMgr->LoadConditions();
+}
+
+static void ReturnOrDeleteOldMails()
+{
+    sObjectMgr->ReturnOrDeleteOldMails(false);
+}
+
+static void LoadDatabaseScripts()
+{
+    sObjectMgr->LoadQuestStartScripts();                         // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
+    sObjectMgr->LoadQuestEndScripts();                           // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
+    sObjectMgr->LoadSpellScripts();                              // must be after load Creature/Gameobject(Template/Data)
+    sObjectMgr->LoadGameObjectScripts();                         // must be after load Creature/Gameobject(Template/Data)
+    sObjectMgr->LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
+    sObjectMgr->LoadWaypointScripts();
+}
+
 /// Initialize the World
 void World::SetInitialWorldSettings()
 {
@@ -1430,8 +1489,8 @@ void World::SetInitialWorldSettings()
 
     ///- Load the DBC files
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initialize data stores...");
-    LoadDBCStores(m_dataPath);
-    LoadDB2Stores(m_dataPath);
+    LoadDBCStores(m_dataPath, m_int_configs[CONFIG_DATASTORE_LOAD_THREADS]);
+    LoadDB2Stores(m_dataPath, m_int_configs[CONFIG_DATASTORE_LOAD_THREADS]);
     DetectDBCLang();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
@@ -1659,330 +1718,117 @@ void World::SetInitialWorldSettings()
     WeatherMgr::LoadWeatherData();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quests...");
-    sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Checking Quest Disables");
-    DisableMgr::CheckQuestDisables();                           // must be after loading quests
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest POI");
-    sObjectMgr->LoadQuestPOI();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quests Relations...");
-    sObjectMgr->LoadQuestRelations();                            // must be after quest load
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Objects Pooling Data...");
-    sPoolMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Game Event Data...");               // must be after loading pools fully
-    sGameEventMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading UNIT_NPC_FLAG_SPELLCLICK Data..."); // must be after LoadQuests
-    sObjectMgr->LoadNPCSpellClickSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vehicle Template Accessories...");
-    sObjectMgr->LoadVehicleTemplateAccessories();                // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vehicle Accessories...");
-    sObjectMgr->LoadVehicleAccessories();                       // must be after LoadCreatureTemplates() and LoadNPCSpellClickSpells()
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Dungeon boss data...");
-    sObjectMgr->LoadInstanceEncounters();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFG rewards...");
-    sLFGMgr->LoadRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading LFG entrance positions...");
-    sLFGMgr->LoadEntrancePositions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+    ///- Database loaders only depending on the data loaded above, run by the startup threads.
+    ///- Each task names the loaders whose data it reads or modifies, see StartupTaskGraph.
+    StartupTaskGraph loaders;
+    typedef StartupTaskGraph::TaskId TaskId;
+
+    TaskId quests = loaders.Add("Loading Quests...", sObjectMgr, &ObjectMgr::LoadQuests);                   // must be loaded after DBCs, creature_template, item_template, gameobject tables
+    loaders.Add("Checking Quest Disables", &DisableMgr::CheckQuestDisables, quests);
+    loaders.Add("Loading Quest POI", sObjectMgr, &ObjectMgr::LoadQuestPOI);
+    TaskId questRelations = loaders.Add("Loading Quests Relations...", sObjectMgr, &ObjectMgr::LoadQuestRelations, quests);
+    TaskId pools = loaders.Add("Loading Objects Pooling Data...", sPoolMgr, &PoolMgr::LoadFromDB, quests);
+    TaskId gameEvents = loaders.Add("Loading Game Event Data...", sGameEventMgr, &GameEventMgr::LoadFromDB, pools, quests);
+    // removes the UNIT_NPC_FLAG_SPELLCLICK flag of creature templates, whose npc flags are read by quest relations,
+    // vendors, trainers and the game event vendor checks
+    TaskId spellClick = loaders.Add("Loading UNIT_NPC_FLAG_SPELLCLICK Data...", sObjectMgr, &ObjectMgr::LoadNPCSpellClickSpells, questRelations, gameEvents);
+    loaders.Add("Loading Vehicle Template Accessories...", sObjectMgr, &ObjectMgr::LoadVehicleTemplateAccessories, spellClick);
+    loaders.Add("Loading Vehicle Accessories...", sObjectMgr, &ObjectMgr::LoadVehicleAccessories, spellClick);
+    loaders.Add("Loading Dungeon boss data...", sObjectMgr, &ObjectMgr::LoadInstanceEncounters);
+    TaskId lfgRewards = loaders.Add("Loading LFG rewards...", sLFGMgr, &LFGMgr::LoadRewards, quests);
+    TaskId lfgEntrances = loaders.Add("Loading LFG entrance positions...", sLFGMgr, &LFGMgr::LoadEntrancePositions);
+    loaders.Add("Loading Spell Classes Info...", sSpellMgr, &SpellMgr::LoadSpellClassInfo);
+    loaders.Add("Loading AreaTrigger definitions...", sObjectMgr, &ObjectMgr::LoadAreaTriggerTeleports);
+    loaders.Add("Loading Access Requirements...", sObjectMgr, &ObjectMgr::LoadAccessRequirements, quests);
+    // sets quest special flags, like the script loaders
+    TaskId questAreaTriggers = loaders.Add("Loading Quest Area Triggers...", sObjectMgr, &ObjectMgr::LoadQuestAreaTriggers, quests);
+    loaders.Add("Loading Tavern Area Triggers...", sObjectMgr, &ObjectMgr::LoadTavernAreaTriggers);
+    loaders.Add("Loading AreaTrigger script names...", sObjectMgr, &ObjectMgr::LoadAreaTriggerScripts);
+    loaders.Add("Loading Graveyard-zone links...", sObjectMgr, &ObjectMgr::LoadGraveyardZones);
+    loaders.Add("Loading spell pet auras...", sSpellMgr, &SpellMgr::LoadSpellPetAuras);
+    loaders.Add("Loading Spell target coordinates...", sSpellMgr, &SpellMgr::LoadSpellTargetPositions);
+    loaders.Add("Loading enchant custom attributes...", sSpellMgr, &SpellMgr::LoadEnchantCustomAttr);
+    loaders.Add("Loading linked spells...", sSpellMgr, &SpellMgr::LoadSpellLinked);
+    loaders.Add("Loading Player Create Data...", sObjectMgr, &ObjectMgr::LoadPlayerInfo);
+    loaders.Add("Loading Exploration BaseXP Data...", sObjectMgr, &ObjectMgr::LoadExplorationBaseXP);
+    loaders.Add("Loading Pet Name Parts...", sObjectMgr, &ObjectMgr::LoadPetNames);
+    loaders.Add("Loading the max pet number...", sObjectMgr, &ObjectMgr::LoadPetNumber);
+    loaders.Add("Loading pet level stats...", sObjectMgr, &ObjectMgr::LoadPetLevelInfo);
+    loaders.Add("Loading Player Corpses...", sObjectMgr, &ObjectMgr::LoadCorpses);
+    loaders.Add("Loading Player level dependent mail rewards...", sObjectMgr, &ObjectMgr::LoadMailLevelRewards);
+    TaskId loot = loaders.Add("Loading loot tables...", &LoadLootTables);
+    loaders.Add("Loading Skill Discovery Table...", &LoadSkillDiscoveryTable);
+    loaders.Add("Loading Skill Extra Item Table...", &LoadSkillExtraItemTable);
+    loaders.Add("Loading Skill Fishing base level requirements...", sObjectMgr, &ObjectMgr::LoadFishingBaseSkillLevel);
+
+    TaskId achievements = loaders.Add("Loading Achievements...", sAchievementMgr, &AchievementGlobalMgr::LoadAchievementReferenceList);
+    achievements = loaders.Add("Loading Achievement Criteria Lists...", sAchievementMgr, &AchievementGlobalMgr::LoadAchievementCriteriaList, achievements);
+    achievements = loaders.Add("Loading Achievement Criteria Data...", sAchievementMgr, &AchievementGlobalMgr::LoadAchievementCriteriaData, achievements);
+    achievements = loaders.Add("Loading Achievement Rewards...", sAchievementMgr, &AchievementGlobalMgr::LoadRewards, achievements);
+    achievements = loaders.Add("Loading Achievement Reward Locales...", sAchievementMgr, &AchievementGlobalMgr::LoadRewardLocales, achievements);
+    achievements = loaders.Add("Loading Completed Achievements...", sAchievementMgr, &AchievementGlobalMgr::LoadCompletedAchievements, achievements);
+
+    TaskId cleaner = loaders.Add("Checking character database cleaning...", &CharacterDatabaseCleaner::CleanDatabase, achievements, quests);
 
+    // Delete expired auctions before loading
+    TaskId auctions = loaders.Add("Deleting expired auctions...", sAuctionMgr, &AuctionHouseMgr::DeleteExpiredAuctionsAtStartup);
+    auctions = loaders.Add("Loading Item Auctions...", sAuctionMgr, &AuctionHouseMgr::LoadAuctionItems, auctions);
+    auctions = loaders.Add("Loading Auctions...", sAuctionMgr, &AuctionHouseMgr::LoadAuctions, auctions);
+
+    TaskId guilds = loaders.Add("Loading Guild XP for level...", sGuildMgr, &GuildMgr::LoadGuildXpForLevel);
+    guilds = loaders.Add("Loading Guild rewards...", sGuildMgr, &GuildMgr::LoadGuildRewards, guilds);
+    guilds = loaders.Add("Loading Guilds...", sGuildMgr, &GuildMgr::LoadGuilds, guilds, achievements);
+    loaders.Add("Loading Guild Finder...", sGuildFinderMgr, &GuildFinderMgr::LoadFromDB, guilds);
+    loaders.Add("Loading Groups...", sGroupMgr, &GroupMgr::LoadGroups, lfgRewards, lfgEntrances);
+    loaders.Add("Loading ReservedNames...", sObjectMgr, &ObjectMgr::LoadReservedPlayersNames);
+    TaskId gameObjectsForQuests = loaders.Add("Loading GameObjects for quests...", sObjectMgr, &ObjectMgr::LoadGameObjectForQuests, loot);
+    loaders.Add("Loading BattleMasters...", sBattlegroundMgr, &BattlegroundMgr::LoadBattleMastersEntry);
+    loaders.Add("Loading GameTeleports...", sObjectMgr, &ObjectMgr::LoadGameTele);
+    TaskId gossip = loaders.Add("Loading Gossip menu...", sObjectMgr, &ObjectMgr::LoadGossipMenu);
+    gossip = loaders.Add("Loading Gossip menu options...", sObjectMgr, &ObjectMgr::LoadGossipMenuItems, gossip);
+    loaders.Add("Loading Vendors...", sObjectMgr, &ObjectMgr::LoadVendors, spellClick);                   // must be after load CreatureTemplate and ItemTemplate
+    loaders.Add("Loading Trainers...", sObjectMgr, &ObjectMgr::LoadTrainerSpell, spellClick);             // must be after load CreatureTemplate
+    loaders.Add("Loading Waypoints...", sWaypointMgr, &WaypointMgr::Load);
+    loaders.Add("Loading SmartAI Waypoints...", sSmartWaypointMgr, &SmartWaypointMgr::LoadFromDB);
+    loaders.Add("Loading Creature Formations...", sFormationMgr, &FormationMgr::LoadCreatureFormations);
+    TaskId worldStates = loaders.Add("Loading World States...", this, &World::LoadWorldStates, cleaner);   // must be loaded before battleground, outdoor PvP and conditions
+    TaskId phases = loaders.Add("Loading Phase definitions...", sObjectMgr, &ObjectMgr::LoadPhaseDefinitions);
+
+    // adds the conditions to the loot templates, gossip menus and spells
+    TaskId conditions = loaders.Add("Loading Conditions...", &LoadConditions, loot, gameObjectsForQuests, gossip);
+    loaders.After(conditions, quests);
+    loaders.After(conditions, gameEvents);
+    loaders.After(conditions, worldStates);
+    loaders.After(conditions, phases);
+
+    loaders.Add("Loading faction change achievement pairs...", sObjectMgr, &ObjectMgr::LoadFactionChangeAchievements);
+    loaders.Add("Loading faction change spell pairs...", sObjectMgr, &ObjectMgr::LoadFactionChangeSpells);
+    loaders.Add("Loading faction change item pairs...", sObjectMgr, &ObjectMgr::LoadFactionChangeItems);
+    loaders.Add("Loading faction change reputation pairs...", sObjectMgr, &ObjectMgr::LoadFactionChangeReputations);
+    loaders.Add("Loading faction change title pairs...", sObjectMgr, &ObjectMgr::LoadFactionChangeTitles);
+    TaskId tickets = loaders.Add("Loading GM tickets...", sTicketMgr, &TicketMgr::LoadTickets);
+    loaders.Add("Loading GM surveys...", sTicketMgr, &TicketMgr::LoadSurveys, tickets);
+    loaders.Add("Loading client addons...", &AddonMgr::LoadFromDB);
+    // mails of expired auctions are sent by DeleteExpiredAuctionsAtStartup, mail ids aren't generated concurrently
+    loaders.Add("Returning old mails...", &ReturnOrDeleteOldMails, auctions);
+    loaders.Add("Loading Autobroadcasts...", this, &World::LoadAutobroadcasts);
+    TaskId scripts = loaders.Add("Loading Quest / Spell / GO / Event / Waypoint Scripts...", &LoadDatabaseScripts, quests, questAreaTriggers);
+    loaders.Add("Loading Scripts text locales...", sObjectMgr, &ObjectMgr::LoadDbScriptStrings, scripts);     // must be after Load*Scripts calls
+    loaders.Add("Loading spell script names...", sObjectMgr, &ObjectMgr::LoadSpellScriptNames);
+    TaskId creatureTexts = loaders.Add("Loading Creature Texts...", sCreatureTextMgr, &CreatureTextMgr::LoadCreatureTexts);
+    loaders.Add("Loading Creature Text Locales...", sCreatureTextMgr, &CreatureTextMgr::LoadCreatureTextLocales, creatureTexts);
+
+    loaders.Run(getIntConfig(CONFIG_STARTUP_LOAD_THREADS));
+    loaders.LogTimings();
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+
+    // Formerly loaded right after the LFG entrance positions, now after every loader of the graph, whatever
+    // Startup.LoadThreads is: it adds SPELL_ATTR0_CANT_CANCEL to spell infos read by most of them, so it can't
+    // run concurrently with them. None of them reads that attribute, the loaded data is the same.
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SpellArea Data...");                // must be after quest load
     sSpellMgr->LoadSpellAreas();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell Classes Info...");
-    sSpellMgr->LoadSpellClassInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger definitions...");
-    sObjectMgr->LoadAreaTriggerTeleports();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Access Requirements...");
-    sObjectMgr->LoadAccessRequirements();                        // must be after item template load
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest Area Triggers...");
-    sObjectMgr->LoadQuestAreaTriggers();                         // must be after LoadQuests
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Tavern Area Triggers...");
-    sObjectMgr->LoadTavernAreaTriggers();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading AreaTrigger script names...");
-    sObjectMgr->LoadAreaTriggerScripts();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Graveyard-zone links...");
-    sObjectMgr->LoadGraveyardZones();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell pet auras...");
-    sSpellMgr->LoadSpellPetAuras();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Spell target coordinates...");
-    sSpellMgr->LoadSpellTargetPositions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading enchant custom attributes...");
-    sSpellMgr->LoadEnchantCustomAttr();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading linked spells...");
-    sSpellMgr->LoadSpellLinked();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Create Data...");
-    sObjectMgr->LoadPlayerInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Exploration BaseXP Data...");
-    sObjectMgr->LoadExplorationBaseXP();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Pet Name Parts...");
-    sObjectMgr->LoadPetNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading the max pet number...");
-    sObjectMgr->LoadPetNumber();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading pet level stats...");
-    sObjectMgr->LoadPetLevelInfo();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player Corpses...");
-    sObjectMgr->LoadCorpses();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Player level dependent mail rewards...");
-    sObjectMgr->LoadMailLevelRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    // Loot tables
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading loot tables...");
-    LoadLootTables();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Discovery Table...");
-    LoadSkillDiscoveryTable();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Extra Item Table...");
-    LoadSkillExtraItemTable();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Skill Fishing base level requirements...");
-    sObjectMgr->LoadFishingBaseSkillLevel();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievements...");
-    sAchievementMgr->LoadAchievementReferenceList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Lists...");
-    sAchievementMgr->LoadAchievementCriteriaList();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Criteria Data...");
-    sAchievementMgr->LoadAchievementCriteriaData();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Rewards...");
-    sAchievementMgr->LoadRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Achievement Reward Locales...");
-    sAchievementMgr->LoadRewardLocales();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Completed Achievements...");
-    sAchievementMgr->LoadCompletedAchievements();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    CharacterDatabaseCleaner::CleanDatabase();
-
-    // Delete expired auctions before loading
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Deleting expired auctions...");
-    sAuctionMgr->DeleteExpiredAuctionsAtStartup();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    ///- Load dynamic data tables from the database
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Item Auctions...");
-    sAuctionMgr->LoadAuctionItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Auctions...");
-    sAuctionMgr->LoadAuctions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild XP for level...");
-    sGuildMgr->LoadGuildXpForLevel();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild rewards...");
-    sGuildMgr->LoadGuildRewards();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guilds...");
-    sGuildMgr->LoadGuilds();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Guild Finder...");
-    sGuildFinderMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Groups...");
-    sGroupMgr->LoadGroups();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading ReservedNames...");
-    sObjectMgr->LoadReservedPlayersNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameObjects for quests...");
-    sObjectMgr->LoadGameObjectForQuests();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading BattleMasters...");
-    sBattlegroundMgr->LoadBattleMastersEntry();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GameTeleports...");
-    sObjectMgr->LoadGameTele();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu...");
-    sObjectMgr->LoadGossipMenu();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Gossip menu options...");
-    sObjectMgr->LoadGossipMenuItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Vendors...");
-    sObjectMgr->LoadVendors();                                   // must be after load CreatureTemplate and ItemTemplate
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Trainers...");
-    sObjectMgr->LoadTrainerSpell();                              // must be after load CreatureTemplate
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Waypoints...");
-    sWaypointMgr->Load();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading SmartAI Waypoints...");
-    sSmartWaypointMgr->LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Formations...");
-    sFormationMgr->LoadCreatureFormations();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading World States...");              // must be loaded before battleground, outdoor PvP and conditions
-    LoadWorldStates();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Phase definitions...");
-    sObjectMgr->LoadPhaseDefinitions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Conditions...");
-    sConditionMgr->LoadConditions();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change achievement pairs...");
-    sObjectMgr->LoadFactionChangeAchievements();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change spell pairs...");
-    sObjectMgr->LoadFactionChangeSpells();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change item pairs...");
-    sObjectMgr->LoadFactionChangeItems();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change reputation pairs...");
-    sObjectMgr->LoadFactionChangeReputations();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading faction change title pairs...");
-    sObjectMgr->LoadFactionChangeTitles();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GM tickets...");
-    sTicketMgr->LoadTickets();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading GM surveys...");
-    sTicketMgr->LoadSurveys();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading client addons...");
-    AddonMgr::LoadFromDB();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    ///- Handle outdated emails (delete/return)
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Returning old mails...");
-    sObjectMgr->ReturnOrDeleteOldMails(false);
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Autobroadcasts...");
-    LoadAutobroadcasts();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    ///- Load and initialize scripts
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Quest / Spell / GO / Event / Waypoint Scripts...");
-    sObjectMgr->LoadQuestStartScripts();                         // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
-    sObjectMgr->LoadQuestEndScripts();                           // must be after load Creature/Gameobject(Template/Data) and QuestTemplate
-    sObjectMgr->LoadSpellScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadGameObjectScripts();                         // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadEventScripts();                              // must be after load Creature/Gameobject(Template/Data)
-    sObjectMgr->LoadWaypointScripts();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Scripts text locales...");      // must be after Load*Scripts calls
-    sObjectMgr->LoadDbScriptStrings();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading spell script names...");
-    sObjectMgr->LoadSpellScriptNames();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Texts...");
-    sCreatureTextMgr->LoadCreatureTexts();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Loading Creature Text Locales...");
-    sCreatureTextMgr->LoadCreatureTextLocales();
-    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
-
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Initializing Scripts...");
     sScriptMgr->Initialize();
     sScriptMgr->OnConfigLoad(false);                                // must be done after the ScriptMgr has been properly initialized
@@ -2025,6 +1871,8 @@ void World::SetInitialWorldSettings()
 
     m_timers[WUPDATE_PINGDB].SetInterval(getIntConfig(CONFIG_DB_PING_INTERVAL)*MINUTE*IN_MILLISECONDS);    // Mysql ping time in minutes
 
+    m_timers[WUPDATE_DBSTATS].SetInterval(getIntConfig(CONFIG_DB_PROFILER_LOG_INTERVAL) * IN_MILLISECONDS);
+
     m_timers[WUPDATE_GUILDSAVE].SetInterval(getIntConfig(CONFIG_GUILD_SAVE_INTERVAL) * MINUTE * IN_MILLISECONDS);
 
     m_timers[WUPDATE_BLACKMARKET].SetInterval(MINUTE * IN_MILLISECONDS);
@@ -2051,6 +1899,19 @@ void World::SetInitialWorldSettings()
     sMapMgr->Initialize();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
+    ///- Initialize the session workers
+    if (uint32 sessionThreads = getIntConfig(CONFIG_SESSION_UPDATE_THREADS))
+    {
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting %u session update threads", sessionThreads);
+        m_sessionUpdater.activate(sessionThreads);
+    }
+
+    if (getBoolConfig(CONFIG_ANTICHEAT_ENABLE))
+    {
+        sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Anticheat analyzer thread...");
+        sAnticheatMgr->StartAnalyzer();
+    }
+
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Starting Game Event system...");
     uint32 nextGameEvent = sGameEventMgr->StartSystem();
     m_timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);    //depend on next event
@@ -2143,6 +2004,10 @@ void World::SetInitialWorldSettings()
     InitOpcodes();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
 
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "Compiling movement status sequences...");
+    LoadMovementCodecs();
+    sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
+
     sLog->outInfo(LOG_FILTER_GENERAL, "Loading Hotfix info...");
     sObjectMgr->LoadHotfixData();
     sLog->outInfo(LOG_FILTER_SERVER_LOADING, "");
@@ -2382,6 +2247,9 @@ void World::Update(uint32 diff)
 
     RecordTimeDiff("UpdateSessions");
 
+    ///- Build the anticheat reports of the movements analyzed since the last update
+    sAnticheatMgr->Update();
+
     /// <li> Handle weather updates when the timer has passed
     if (m_timers[WUPDATE_WEATHERS].Passed())
     {
@@ -2494,12 +2362,23 @@ void World::Update(uint32 diff)
     if (m_timers[WUPDATE_PINGDB].Passed())
     {
         m_timers[WUPDATE_PINGDB].Reset();
-        sLog->outDebug(LOG_FILTER_GENERAL, "Ping MySQL to keep connection alive");
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Ping MySQL to keep connection alive");
         CharacterDatabase.KeepAlive();
         LoginDatabase.KeepAlive();
         WorldDatabase.KeepAlive();
     }
 
+    if (m_timers[WUPDATE_DBSTATS].Passed())
+    {
+        m_timers[WUPDATE_DBSTATS].Reset();
+        if (DatabaseProfiler::IsEnabled() && getIntConfig(CONFIG_DB_PROFILER_LOG_INTERVAL))
+        {
+            CharacterDatabase.LogStats();
+            LoginDatabase.LogStats();
+            WorldDatabase.LogStats();
+        }
+    }
+
     if (m_timers[WUPDATE_GUILDSAVE].Passed())
     {
         m_timers[WUPDATE_GUILDSAVE].Reset();
@@ -3034,7 +2913,7 @@ void World::ShutdownMsg(bool show, Player* player)
         ServerMessageType msgid = (m_ShutdownMask & SHUTDOWN_MASK_RESTART) ? SERVER_MSG_RESTART_TIME : SERVER_MSG_SHUTDOWN_TIME;
 
         SendServerMessage(msgid, str.c_str(), player);
-        sLog->outDebug(LOG_FILTER_GENERAL, "Server is %s in %s", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"), str.c_str());
+        TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Server is %s in %s", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"), str.c_str());
     }
 
     if (m_ShutdownTimer == 5)
@@ -3060,7 +2939,7 @@ void World::ShutdownCancel()
     m_ExitCode = SHUTDOWN_EXIT_CODE;                       // to default value
     SendServerMessage(msgid);
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "Server %s cancelled.", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"));
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "Server %s cancelled.", (m_ShutdownMask & SHUTDOWN_MASK_RESTART ? "restart" : "shuttingdown"));
 
     sScriptMgr->OnShutdownCancel();
 }
@@ -3085,6 +2964,20 @@ void World::UpdateSessions(uint32 diff)
     while (addSessQueue.next(sess))
         AddSession_ (sess);
 
+    ///- Process the packets of the sessions not tied to a map in parallel, up to their first thread-unsafe one
+    if (m_sessionUpdater.activated())
+    {
+        m_workerSessions.clear();
+        for (SessionMap::const_iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
+        {
+            Player* player = itr->second->GetPlayer();
+            if (!player || !player->IsInWorld())
+                m_workerSessions.push_back(itr->second);
+        }
+
+        m_sessionUpdater.Update(m_workerSessions, diff);
+    }
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
     {
@@ -3160,7 +3053,7 @@ void World::SendAutoBroadcast()
         sWorld->SendGlobalMessage(&data);
     }
 
-    sLog->outDebug(LOG_FILTER_GENERAL, "AutoBroadcast: '%s'", msg.c_str());
+    TC_LOG_DEBUG(LOG_FILTER_GENERAL, "AutoBroadcast: '%s'", msg.c_str());
 }
 
 void World::UpdateRealmCharCount(uint32 accountId)
@@ -31,6 +31,7 @@
 #include "QueryResult.h"
 #include "Callback.h"
 #include "TimeDiffMgr.h"
+#include "SessionUpdater.h"
 
 #include <map>
 #include <set>
@@ -94,6 +95,7 @@ enum WorldTimers
     WUPDATE_DELETECHARS,
     WUPDATE_PINGDB,
     WUPDATE_GUILDSAVE,
+    WUPDATE_DBSTATS,
 
     WUPDATE_COUNT
 };
@@ -155,6 +157,7 @@ enum WorldBoolConfigs
     CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN,
     CONFIG_VMAP_INDOOR_CHECK,
     CONFIG_PET_LOS,
+    CONFIG_ENABLE_MMAPS,
     CONFIG_START_ALL_SPELLS,
     CONFIG_START_ALL_EXPLORED,
     CONFIG_START_ALL_REP,
@@ -206,6 +209,8 @@ enum WorldBoolConfigs
     CONFIG_VIP_EXCHANGE_FROST_COMMAND,
     CONFIG_ANTISPAM_ENABLED,
     CONFIG_DISABLE_RESTART,
+    CONFIG_MOVEMENT_RELAY,
+    CONFIG_DB_PROFILER,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -226,12 +231,22 @@ enum WorldFloatConfigs
     CONFIG_STATS_LIMITS_PARRY,
     CONFIG_STATS_LIMITS_BLOCK,
     CONFIG_STATS_LIMITS_CRIT,
+    CONFIG_MOVEMENT_RELAY_FAR_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
 enum WorldIntConfigs
 {
     CONFIG_COMPRESSION = 0,
+    CONFIG_COMPRESSION_THRESHOLD,
+    CONFIG_MMAP_MAX_SEARCH_NODES,
+    CONFIG_MMAP_PATH_CACHE_SIZE,
+    CONFIG_GRID_PRELOAD_THREADS,
+    CONFIG_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_SESSION_UPDATE_THREADS,
+    CONFIG_DATASTORE_LOAD_THREADS,
+    CONFIG_STARTUP_LOAD_THREADS,
+    CONFIG_MOVEMENT_RELAY_FAR_INTERVAL,
     CONFIG_INTERVAL_SAVE,
     CONFIG_INTERVAL_GRIDCLEAN,
     CONFIG_INTERVAL_MAPUPDATE,
@@ -361,6 +376,8 @@ enum WorldIntConfigs
     CONFIG_AUTOBROADCAST_INTERVAL,
     CONFIG_MAX_RESULTS_LOOKUP_COMMANDS,
     CONFIG_DB_PING_INTERVAL,
+    CONFIG_DB_PROFILER_LOG_INTERVAL,
+    CONFIG_DB_BLOCKING_QUERY_CHECK,
     CONFIG_PRESERVE_CUSTOM_CHANNEL_DURATION,
     CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS,
     CONFIG_MAX_INSTANCES_PER_HOUR,
@@ -917,6 +934,8 @@ class World
         uint32 m_currentTime;
 
         SessionMap m_sessions;
+        SessionUpdater m_sessionUpdater;
+        std::vector<WorldSession*> m_workerSessions;        // sessions not in a map, rebuilt every UpdateSessions()
         typedef UNORDERED_MAP<uint32, time_t> DisconnectMap;
         DisconnectMap m_disconnects;
         uint32 m_maxActiveSessionCount;
@@ -782,7 +782,7 @@ class debug_commandscript : public CommandScript
                     break;
                 }
             }
-            sLog->outDebug(LOG_FILTER_NETWORKIO, "Sending opcode %u", data.GetOpcode());
+            TC_LOG_DEBUG(LOG_FILTER_NETWORKIO, "Sending opcode %u", data.GetOpcode());
             data.hexlike();
             player->GetSession()->SendPacket(&data, true);
             handler->PSendSysMessage(LANG_COMMAND_OPCODESENT, data.GetOpcode(), unit->GetName());
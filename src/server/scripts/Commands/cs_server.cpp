@@ -27,6 +27,8 @@ EndScriptData */
 #include "SystemConfig.h"
 #include "Config.h"
 #include "ObjectAccessor.h"
+#include "MapManager.h"
+#include "PathGenerator.h"
 
 class server_commandscript : public CommandScript
 {
@@ -138,6 +140,31 @@ public:
             handler->PSendSysMessage("Outdoor PVP diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_OUTDOORPVP));
             handler->PSendSysMessage("LFG Mgr diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_LFG));
             handler->PSendSysMessage("Callback diff : %u ms", sWorld->GetRecordDiff(RECORD_DIFF_CALLBACK));
+
+            MapUpdater* updater = sMapMgr->GetMapUpdater();
+            if (updater->activated())
+            {
+                MapUpdateTickStats const& stats = updater->GetLastTickStats();
+                for (size_t i = 0; i < stats.workers.size(); ++i)
+                    handler->PSendSysMessage("Map worker %u : %u ms, %u maps, %u stolen", uint32(i), stats.workers[i].busyTime, stats.workers[i].mapsUpdated, stats.workers[i].steals);
+                handler->PSendSysMessage("Slowest map : %u (instance %u) %u ms", stats.slowestMapId, stats.slowestInstanceId, stats.slowestMapTime);
+            }
+
+            PathQueryStats& paths = PathGenerator::GetStats();
+            long searches = paths.searches.value();
+            handler->PSendSysMessage("Path queries : %ld, %ld cached, %ld straight, %ld incomplete, %ld unreachable",
+                paths.queries.value(), paths.cacheHits.value(), paths.shortcuts.value(), paths.incomplete.value(), paths.noPath.value());
+            if (searches > 0)
+                handler->PSendSysMessage("Path searches : %ld, avg %ld nodes, %ld vmap checks, %ld us",
+                    searches, paths.nodesExpanded.value() / searches, paths.losChecks.value() / searches, paths.searchTime.value() / searches);
+
+            GridPreloader* preloader = sMapMgr->GetGridPreloader();
+            if (preloader->activated())
+            {
+                GridPreloadStats& preload = preloader->GetStats();
+                handler->PSendSysMessage("Grid preload : %ld requested, %ld hits, %ld late, %ld misses, %ld expired",
+                    preload.requests.value(), preload.hits.value(), preload.late.value(), preload.misses.value(), preload.expired.value());
+            }
         }
 
         // Can't use sWorld->ShutdownMsg here in case of console command
@@ -1412,7 +1412,7 @@ public:
                     DoMeleeAttackIfReady();
                     break;
                 }
-                sLog->outDebug(LOG_FILTER_TSCR, "Sinister-Timer");
+                TC_LOG_DEBUG(LOG_FILTER_TSCR, "Sinister-Timer");
                 for (uint8 i = 0; i < 3; ++i)
                     uiTimer[i] -= diff;
             }
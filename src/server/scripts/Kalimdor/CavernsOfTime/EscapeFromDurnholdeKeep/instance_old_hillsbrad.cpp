@@ -86,7 +86,7 @@ public:
                 }
             }
 
-            sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Instance Old Hillsbrad: GetPlayerInMap, but PlayerList is empty!");
+            TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Instance Old Hillsbrad: GetPlayerInMap, but PlayerList is empty!");
             return NULL;
         }
 
@@ -126,7 +126,7 @@ public:
 
             if (!player)
             {
-                sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: SetData (Type: %u Data %u) cannot find any player.", type, data);
+                TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: SetData (Type: %u Data %u) cannot find any player.", type, data);
                 return;
             }
 
@@ -142,7 +142,7 @@ public:
                         ++mBarrelCount;
                         DoUpdateWorldState(WORLD_STATE_OH, mBarrelCount);
 
-                        sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: go_barrel_old_hillsbrad count %u", mBarrelCount);
+                        TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: go_barrel_old_hillsbrad count %u", mBarrelCount);
 
                         m_auiEncounter[0] = IN_PROGRESS;
 
@@ -163,7 +163,7 @@ public:
                         {
                             ++mThrallEventCount;
                             m_auiEncounter[1] = NOT_STARTED;
-                            sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event failed %u times. Resetting all sub-events.", mThrallEventCount);
+                            TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event failed %u times. Resetting all sub-events.", mThrallEventCount);
                             m_auiEncounter[2] = NOT_STARTED;
                             m_auiEncounter[3] = NOT_STARTED;
                             m_auiEncounter[4] = NOT_STARTED;
@@ -176,29 +176,29 @@ public:
                             m_auiEncounter[3] = data;
                             m_auiEncounter[4] = data;
                             m_auiEncounter[5] = data;
-                            sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event failed %u times. Resetting all sub-events.", mThrallEventCount);
+                            TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event failed %u times. Resetting all sub-events.", mThrallEventCount);
                         }
                     }
                     else
                         m_auiEncounter[1] = data;
-                    sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall escort event adjusted to data %u.", data);
+                    TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall escort event adjusted to data %u.", data);
                     break;
                 }
                 case TYPE_THRALL_PART1:
                     m_auiEncounter[2] = data;
-                    sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part I adjusted to data %u.", data);
+                    TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part I adjusted to data %u.", data);
                     break;
                 case TYPE_THRALL_PART2:
                     m_auiEncounter[3] = data;
-                    sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part II adjusted to data %u.", data);
+                    TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part II adjusted to data %u.", data);
                     break;
                 case TYPE_THRALL_PART3:
                     m_auiEncounter[4] = data;
-                    sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part III adjusted to data %u.", data);
+                    TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part III adjusted to data %u.", data);
                     break;
                 case TYPE_THRALL_PART4:
                     m_auiEncounter[5] = data;
-                     sLog->outDebug(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part IV adjusted to data %u.", data);
+                     TC_LOG_DEBUG(LOG_FILTER_TSCR, "TSCR: Old Hillsbrad: Thrall event part IV adjusted to data %u.", data);
                     break;
             }
         }
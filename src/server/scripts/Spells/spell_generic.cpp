@@ -268,13 +268,6 @@ class spell_gen_parachute : public SpellScriptLoader
         }
 };
 
-enum NPCEntries
-{
-    NPC_DOOMGUARD   = 11859,
-    NPC_INFERNAL    = 89,
-    NPC_IMP         = 416,
-};
-
 class spell_gen_pet_summoned : public SpellScriptLoader
 {
     public:
@@ -295,31 +288,8 @@ class spell_gen_pet_summoned : public SpellScriptLoader
                 if (player->GetLastPetNumber())
                 {
                     PetType newPetType = (player->getClass() == CLASS_HUNTER) ? HUNTER_PET : SUMMON_PET;
-                    if (Pet* newPet = new Pet(player, newPetType))
-                    {
-                        if (newPet->LoadPetFromDB(player, 0, player->GetLastPetNumber(), true))
-                        {
-                            // revive the pet if it is dead
-                            if (newPet->getDeathState() == DEAD || newPet->getDeathState() == CORPSE)
-                                newPet->setDeathState(ALIVE);
-
-                            newPet->ClearUnitState(uint32(UNIT_STATE_ALL_STATE));
-                            newPet->SetFullHealth();
-                            newPet->SetPower(newPet->getPowerType(), newPet->GetMaxPower(newPet->getPowerType()));
-
-                            switch (newPet->GetEntry())
-                            {
-                                case NPC_DOOMGUARD:
-                                case NPC_INFERNAL:
-                                    newPet->SetEntry(NPC_IMP);
-                                    break;
-                                default:
-                                    break;
-                            }
-                        }
-                        else
-                            delete newPet;
-                    }
+                    // revived at full health, as an imp instead of a doomguard or an infernal
+                    player->LoadPetAsync(player->GetLastPetNumber(), newPetType, true);
                 }
             }
 
@@ -31,25 +31,25 @@ public:
         {
             case CHAT_MSG_ADDON:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_ADDON))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s sends: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s sends: %s",
                         player->GetName(), msg.c_str());
                 break;
 
             case CHAT_MSG_SAY:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_PUBLIC))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[SAY] Player %s says (language %u): %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[SAY] Player %s says (language %u): %s",
                         player->GetName(), lang, msg.c_str());
                 break;
 
             case CHAT_MSG_EMOTE:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_PUBLIC))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[TEXTEMOTE] Player %s emotes: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[TEXTEMOTE] Player %s emotes: %s",
                         player->GetName(), msg.c_str());
                 break;
 
             case CHAT_MSG_YELL:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_PUBLIC))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[YELL] Player %s yells (language %u): %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[YELL] Player %s yells (language %u): %s",
                         player->GetName(), lang, msg.c_str());
                 break;
         }
@@ -62,10 +62,10 @@ public:
     void OnChat(Player* player, uint32 type, uint32 lang, std::string& msg, Player* receiver)
     {
         if (lang != LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_WHISPER))
-            sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[WHISPER] Player %s tells %s: %s",
+            TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[WHISPER] Player %s tells %s: %s",
                 player->GetName(), receiver ? receiver->GetName() : "<unknown>", msg.c_str());
         else if (lang == LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_ADDON))
-            sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells %s: %s",
+            TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells %s: %s",
                 player->GetName(), receiver ? receiver->GetName() : "<unknown>", msg.c_str());
 
         if ((player->GetSession() && receiver->GetSession()) && (player->GetSession()->GetSecurity() > SEC_PLAYER || receiver->GetSession()->GetSecurity() > SEC_PLAYER))
@@ -83,52 +83,52 @@ public:
         {
             case CHAT_MSG_PARTY:
                 if (lang != LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_PARTY))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[PARTY] Player %s tells group with leader %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[PARTY] Player %s tells group with leader %s: %s",
                         player->GetName(), group ? group->GetLeaderName() : "<unknown>", msg.c_str());
                 else if (lang == LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_ADDON))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells group with leader %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells group with leader %s: %s",
                         player->GetName(), group ? group->GetLeaderName() : "<unknown>", msg.c_str());
                 break;
 
             case CHAT_MSG_PARTY_LEADER:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_PARTY))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[PARTY] Leader %s tells group: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[PARTY] Leader %s tells group: %s",
                         player->GetName(), msg.c_str());
                 break;
 
             case CHAT_MSG_RAID:
                 if (lang != LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_RAID))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[RAID] Player %s tells raid with leader %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[RAID] Player %s tells raid with leader %s: %s",
                         player->GetName(), group ? group->GetLeaderName() : "<unknown>", msg.c_str());
                 else if (lang == LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_ADDON))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells raid with leader %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells raid with leader %s: %s",
                         player->GetName(), group ? group->GetLeaderName() : "<unknown>", msg.c_str());
                 break;
 
             case CHAT_MSG_RAID_LEADER:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_RAID))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[RAID] Leader player %s tells raid: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[RAID] Leader player %s tells raid: %s",
                         player->GetName(), msg.c_str());
                 break;
 
             case CHAT_MSG_RAID_WARNING:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_RAID))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[RAID] Leader player %s warns raid with: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[RAID] Leader player %s warns raid with: %s",
                         player->GetName(), msg.c_str());
                 break;
 
             case CHAT_MSG_INSTANCE_CHAT:
                 if (lang != LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_BGROUND))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[BATTLEGROUND] Player %s tells battleground with leader %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[BATTLEGROUND] Player %s tells battleground with leader %s: %s",
                         player->GetName(), group ? group->GetLeaderName() : "<unknown>", msg.c_str());
                 else if (lang == LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_ADDON))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells battleground with leader %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s tells battleground with leader %s: %s",
                         player->GetName(), group ? group->GetLeaderName() : "<unknown>", msg.c_str());
                 break;
 
             case CHAT_MSG_INSTANCE_CHAT_LEADER:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_BGROUND))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[BATTLEGROUND] Leader player %s tells battleground: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[BATTLEGROUND] Leader player %s tells battleground: %s",
                         player->GetName(), msg.c_str());
                 break;
         }
@@ -140,16 +140,16 @@ public:
         {
             case CHAT_MSG_GUILD:
                 if (lang != LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_GUILD))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[GUILD] Player %s tells guild %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[GUILD] Player %s tells guild %s: %s",
                         player->GetName(), guild ? guild->GetName().c_str() : "<unknown>", msg.c_str());
                 else if (lang == LANG_ADDON && sWorld->getBoolConfig(CONFIG_CHATLOG_ADDON))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s sends to guild %s: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[ADDON] Player %s sends to guild %s: %s",
                         player->GetName(), guild ? guild->GetName().c_str() : "<unknown>", msg.c_str());
                 break;
 
             case CHAT_MSG_OFFICER:
                 if (sWorld->getBoolConfig(CONFIG_CHATLOG_GUILD))
-                    sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[OFFICER] Player %s tells guild %s officers: %s",
+                    TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[OFFICER] Player %s tells guild %s officers: %s",
                         player->GetName(), guild ? guild->GetName().c_str() : "<unknown>", msg.c_str());
                 break;
         }
@@ -164,10 +164,10 @@ public:
                          channel->HasFlag(CHANNEL_FLAG_LFG));
 
         if (sWorld->getBoolConfig(CONFIG_CHATLOG_SYSCHAN) && isSystem)
-            sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[SYSCHAN] Player %s tells channel %s: %s",
+            TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[SYSCHAN] Player %s tells channel %s: %s",
                 player->GetName(), channel->GetName().c_str(), msg.c_str());
         else if (sWorld->getBoolConfig(CONFIG_CHATLOG_CHANNEL))
-            sLog->outDebug(LOG_FILTER_PLAYER_CHATLOG, "[CHANNEL] Player %s tells channel %s: %s",
+            TC_LOG_DEBUG(LOG_FILTER_PLAYER_CHATLOG, "[CHANNEL] Player %s tells channel %s: %s",
                 player->GetName(), channel ? channel->GetName().c_str() : "<unknown>", msg.c_str());
 
         if (player->GetSession() && player->GetSession()->GetSecurity() > SEC_PLAYER)
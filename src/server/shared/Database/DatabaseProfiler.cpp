@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "DatabaseProfiler.h"
+#include "Common.h"
+
+#include <ace/Guard_T.h>
+#include <ace/OS_NS_sys_time.h>
+#include <ace/TSS_T.h>
+
+#include <cstring>
+
+//! Ad-hoc queries have no index, only the first ones blocking a map thread are logged
+#define DB_MAX_REPORTED_ADHOC 32
+
+struct DatabaseThreadState
+{
+    DatabaseThreadState() : role(DB_THREAD_ROLE_OTHER) { }
+
+    DatabaseThreadRole role;
+};
+
+static ACE_TSS<DatabaseThreadState> threadState;
+
+bool DatabaseProfiler::_enabled = false;
+BlockingQueryPolicy DatabaseProfiler::_blockingPolicy = BLOCKING_QUERY_IGNORE;
+
+void DatabaseProfiler::SetThreadRole(DatabaseThreadRole role)
+{
+    threadState->role = role;
+}
+
+DatabaseThreadRole DatabaseProfiler::GetThreadRole()
+{
+    return threadState->role;
+}
+
+char const* DatabaseProfiler::GetThreadRoleName(DatabaseThreadRole role)
+{
+    switch (role)
+    {
+        case DB_THREAD_ROLE_WORLD:
+            return "world";
+        case DB_THREAD_ROLE_MAP:
+            return "map";
+        case DB_THREAD_ROLE_SESSION:
+            return "session";
+        default:
+            return "other";
+    }
+}
+
+uint64 DatabaseProfiler::GetTime()
+{
+    ACE_Time_Value now = ACE_OS::gettimeofday();
+    return uint64(now.sec()) * 1000000 + uint64(now.usec());
+}
+
+DatabaseStatementStats::DatabaseStatementStats() : totalTime(0), maxTime(0)
+{
+    memset(calls, 0, sizeof(calls));
+    memset(latency, 0, sizeof(latency));
+}
+
+DatabaseQueryStats::DatabaseQueryStats() : _reportedAdhoc(0),
+    _waits(0), _waitTime(0), _maxWaitTime(0), _waiters(0), _maxWaiters(0)
+{
+}
+
+bool DatabaseQueryStats::CheckBlocking(int32 index)
+{
+    BlockingQueryPolicy policy = DatabaseProfiler::GetBlockingQueryPolicy();
+    if (policy == BLOCKING_QUERY_IGNORE || DatabaseProfiler::GetThreadRole() != DB_THREAD_ROLE_MAP)
+        return false;
+
+    if (policy == BLOCKING_QUERY_ASSERT)
+        return true;
+
+    TRINITY_GUARD(ACE_Thread_Mutex, _lock);
+    if (index >= 0)
+        return _reportedBlocking.insert(index).second;
+
+    if (_reportedAdhoc >= DB_MAX_REPORTED_ADHOC)
+        return false;
+
+    ++_reportedAdhoc;
+    return true;
+}
+
+void DatabaseQueryStats::AddStatement(int32 index, uint32 time)
+{
+    uint8 bucket = 0;
+    while (bucket < DB_LATENCY_BUCKETS - 1 && time >= (128u << bucket))
+        ++bucket;
+
+    DatabaseThreadRole role = DatabaseProfiler::GetThreadRole();
+
+    TRINITY_GUARD(ACE_Thread_Mutex, _lock);
+    DatabaseStatementStats& stats = _statements[index];
+    ++stats.calls[role];
+    ++stats.latency[bucket];
+    stats.totalTime += time;
+    if (time > stats.maxTime)
+        stats.maxTime = time;
+}
+
+void DatabaseQueryStats::BeginConnectionWait()
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, _lock);
+    if (++_waiters > _maxWaiters)
+        _maxWaiters = _waiters;
+}
+
+void DatabaseQueryStats::EndConnectionWait(uint32 time)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, _lock);
+    --_waiters;
+    ++_waits;
+    _waitTime += time;
+    if (time > _maxWaitTime)
+        _maxWaitTime = time;
+}
+
+void DatabaseQueryStats::Collect(StatementStatsMap& statements, uint32& waits, uint64& waitTime, uint32& maxWaitTime, uint32& maxWaiters)
+{
+    TRINITY_GUARD(ACE_Thread_Mutex, _lock);
+    statements.swap(_statements);
+    _statements.clear();
+
+    waits = _waits;
+    waitTime = _waitTime;
+    maxWaitTime = _maxWaitTime;
+    maxWaiters = _maxWaiters;
+
+    _waits = 0;
+    _waitTime = 0;
+    _maxWaitTime = 0;
+    _maxWaiters = _waiters;
+}
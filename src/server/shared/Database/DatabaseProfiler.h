@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DATABASEPROFILER_H
+#define _DATABASEPROFILER_H
+
+#include <ace/Thread_Mutex.h>
+
+#include "Define.h"
+
+#include <map>
+#include <set>
+
+//! What the calling thread is doing, blocking queries are only a problem for some of them
+enum DatabaseThreadRole
+{
+    DB_THREAD_ROLE_OTHER,           //! Startup, network, async database workers...
+    DB_THREAD_ROLE_WORLD,
+    DB_THREAD_ROLE_MAP,
+    DB_THREAD_ROLE_SESSION,         //! Parallel session updates
+
+    MAX_DB_THREAD_ROLES
+};
+
+enum BlockingQueryPolicy
+{
+    BLOCKING_QUERY_IGNORE,
+    BLOCKING_QUERY_LOG,             //! Logs each statement the first time it blocks a map thread
+    BLOCKING_QUERY_ASSERT           //! ASSERT on every blocking query of a map thread, with the call stack
+};
+
+//! Bucket i counts the statements faster than 128 << i microseconds, the last one the slower ones
+#define DB_LATENCY_BUCKETS 12
+
+//! Statement indexes of the synchronous operations without prepared statement
+#define DB_STATEMENT_ADHOC          -1
+#define DB_STATEMENT_TRANSACTION    -2
+
+//! Global settings and thread roles of the synchronous query instrumentation
+class DatabaseProfiler
+{
+    public:
+        static void SetThreadRole(DatabaseThreadRole role);
+        static DatabaseThreadRole GetThreadRole();
+        static char const* GetThreadRoleName(DatabaseThreadRole role);
+
+        //! Latency histograms and connection waits are only measured when enabled
+        static void SetEnabled(bool enabled) { _enabled = enabled; }
+        static bool IsEnabled() { return _enabled; }
+
+        static void SetBlockingQueryPolicy(BlockingQueryPolicy policy) { _blockingPolicy = policy; }
+        static BlockingQueryPolicy GetBlockingQueryPolicy() { return _blockingPolicy; }
+
+        //! Microseconds, only meant for differences
+        static uint64 GetTime();
+
+    private:
+        static bool _enabled;
+        static BlockingQueryPolicy _blockingPolicy;
+};
+
+//! Sets the role of the calling thread for the scope, like the maps updated by the world thread
+class DatabaseThreadRoleScope
+{
+    public:
+        explicit DatabaseThreadRoleScope(DatabaseThreadRole role) : _previous(DatabaseProfiler::GetThreadRole())
+        {
+            DatabaseProfiler::SetThreadRole(role);
+        }
+
+        ~DatabaseThreadRoleScope() { DatabaseProfiler::SetThreadRole(_previous); }
+
+    private:
+        DatabaseThreadRole _previous;
+};
+
+struct DatabaseStatementStats
+{
+    DatabaseStatementStats();
+
+    uint32 calls[MAX_DB_THREAD_ROLES];
+    uint32 latency[DB_LATENCY_BUCKETS];
+    uint64 totalTime;
+    uint32 maxTime;
+};
+
+/*
+ * Synchronous query statistics of a DatabaseWorkerPool: latency of each
+ * prepared statement index by thread role, and the time spent waiting for a
+ * free synchronous connection. Logged and reset by DatabaseWorkerPool::LogStats,
+ * the statements blocking the most map thread time first.
+ */
+class DatabaseQueryStats
+{
+    public:
+        typedef std::map<int32, DatabaseStatementStats> StatementStatsMap;
+
+        DatabaseQueryStats();
+
+        //! Returns true when the statement must be reported as blocking the calling thread
+        bool CheckBlocking(int32 index);
+
+        void AddStatement(int32 index, uint32 time);
+
+        void BeginConnectionWait();
+        void EndConnectionWait(uint32 time);
+
+        //! Moves the statistics gathered since the last call into the arguments
+        void Collect(StatementStatsMap& statements, uint32& waits, uint64& waitTime, uint32& maxWaitTime, uint32& maxWaiters);
+
+    private:
+        ACE_Thread_Mutex _lock;
+        StatementStatsMap _statements;
+        std::set<int32> _reportedBlocking;
+        uint32 _reportedAdhoc;
+
+        uint32 _waits;
+        uint64 _waitTime;
+        uint32 _maxWaitTime;
+        uint32 _waiters;                                    //! Threads currently waiting for a connection
+        uint32 _maxWaiters;
+};
+
+#endif
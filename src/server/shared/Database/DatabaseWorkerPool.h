@@ -30,6 +30,7 @@
 #include "QueryResult.h"
 #include "QueryHolder.h"
 #include "AdhocStatement.h"
+#include "DatabaseProfiler.h"
 
 class PingOperation : public SQLOperation
 {
@@ -177,9 +178,11 @@ class DatabaseWorkerPool
             if (!sql)
                 return;
 
+            uint64 start = BeginSynchStatement(DB_STATEMENT_ADHOC, sql);
             T* t = GetFreeConnection();
             t->Execute(sql);
             t->Unlock();
+            EndSynchStatement(DB_STATEMENT_ADHOC, start);
         }
 
         //! Directly executes a one-way SQL operation in string format -with variable args-, that will block the calling thread until finished.
@@ -202,9 +205,12 @@ class DatabaseWorkerPool
         //! Statement must be prepared with the CONNECTION_SYNCH flag.
         void DirectExecute(PreparedStatement* stmt)
         {
+            int32 index = int32(stmt->GetIndex());
+            uint64 start = BeginSynchStatement(index, NULL);
             T* t = GetFreeConnection();
             t->Execute(stmt);
             t->Unlock();
+            EndSynchStatement(index, start);
 
             //! Delete proxy-class. Not needed anymore
             delete stmt;
@@ -218,11 +224,13 @@ class DatabaseWorkerPool
         //! Returns reference counted auto pointer, no need for manual memory management in upper level code.
         QueryResult Query(const char* sql, MySQLConnection* conn = NULL)
         {
+            uint64 start = BeginSynchStatement(DB_STATEMENT_ADHOC, sql);
             if (!conn)
                 conn = GetFreeConnection();
 
             ResultSet* result = conn->Query(sql);
             conn->Unlock();
+            EndSynchStatement(DB_STATEMENT_ADHOC, start);
             if (!result || !result->GetRowCount())
             {
                 delete result;
@@ -269,9 +277,12 @@ class DatabaseWorkerPool
         //! Statement must be prepared with CONNECTION_SYNCH flag.
         PreparedQueryResult Query(PreparedStatement* stmt)
         {
+            int32 index = int32(stmt->GetIndex());
+            uint64 start = BeginSynchStatement(index, NULL);
             T* t = GetFreeConnection();
             PreparedResultSet* ret = t->Query(stmt);
             t->Unlock();
+            EndSynchStatement(index, start);
 
             //! Delete proxy-class. Not needed anymore
             delete stmt;
@@ -356,10 +367,10 @@ class DatabaseWorkerPool
             switch (transaction->GetSize())
             {
                 case 0:
-                    sLog->outDebug(LOG_FILTER_SQL_DRIVER, "Transaction contains 0 queries. Not executing.");
+                    TC_LOG_DEBUG(LOG_FILTER_SQL_DRIVER, "Transaction contains 0 queries. Not executing.");
                     return;
                 case 1:
-                    sLog->outDebug(LOG_FILTER_SQL_DRIVER, "Warning: Transaction only holds 1 query, consider removing Transaction context in code.");
+                    TC_LOG_DEBUG(LOG_FILTER_SQL_DRIVER, "Warning: Transaction only holds 1 query, consider removing Transaction context in code.");
                     break;
                 default:
                     break;
@@ -373,10 +384,12 @@ class DatabaseWorkerPool
         //! were appended to the transaction will be respected during execution.
         void DirectCommitTransaction(SQLTransaction& transaction)
         {
+            uint64 start = BeginSynchStatement(DB_STATEMENT_TRANSACTION, NULL);
             MySQLConnection* con = GetFreeConnection();
             if (con->ExecuteTransaction(transaction))
             {
                 con->Unlock();      // OK, operation succesful
+                EndSynchStatement(DB_STATEMENT_TRANSACTION, start);
                 return;
             }
 
@@ -396,6 +409,7 @@ class DatabaseWorkerPool
             transaction->Cleanup();
 
             con->Unlock();
+            EndSynchStatement(DB_STATEMENT_TRANSACTION, start);
         }
 
         //! Method used to execute prepared statements in a diverse context.
@@ -463,6 +477,54 @@ class DatabaseWorkerPool
                 Enqueue(new PingOperation);
         }
 
+        //! Logs the synchronous statements run since the last call, the ones blocking map threads the longest first.
+        void LogStats()
+        {
+            DatabaseQueryStats::StatementStatsMap statements;
+            uint32 waits, maxWaitTime, maxWaiters;
+            uint64 waitTime;
+            _stats.Collect(statements, waits, waitTime, maxWaitTime, maxWaiters);
+
+            sLog->outInfo(LOG_FILTER_SQL, "DatabasePool '%s': %u synchronous connection waits, avg %u us, max %u us, max %u waiting threads, %u queued async operations.",
+                GetDatabaseName(), waits, waits ? uint32(waitTime / waits) : 0, maxWaitTime, maxWaiters, uint32(_queue->queue()->message_count()));
+
+            //! Map thread time first, then the total time
+            std::multimap<std::pair<uint64, uint64>, int32> sorted;
+            for (DatabaseQueryStats::StatementStatsMap::const_iterator itr = statements.begin(); itr != statements.end(); ++itr)
+            {
+                DatabaseStatementStats const& stats = itr->second;
+                uint32 calls = 0;
+                for (uint8 role = 0; role < MAX_DB_THREAD_ROLES; ++role)
+                    calls += stats.calls[role];
+
+                uint64 mapTime = stats.totalTime * stats.calls[DB_THREAD_ROLE_MAP] / calls;
+                sorted.insert(std::make_pair(std::make_pair(mapTime, stats.totalTime), itr->first));
+            }
+
+            for (std::multimap<std::pair<uint64, uint64>, int32>::reverse_iterator itr = sorted.rbegin(); itr != sorted.rend(); ++itr)
+            {
+                DatabaseStatementStats const& stats = statements[itr->second];
+
+                std::ostringstream calls;
+                uint32 total = 0;
+                for (uint8 role = 0; role < MAX_DB_THREAD_ROLES; ++role)
+                {
+                    if (!stats.calls[role])
+                        continue;
+
+                    calls << ' ' << DatabaseProfiler::GetThreadRoleName(DatabaseThreadRole(role)) << ' ' << stats.calls[role];
+                    total += stats.calls[role];
+                }
+
+                std::ostringstream latency;
+                for (uint8 i = 0; i < DB_LATENCY_BUCKETS; ++i)
+                    latency << ' ' << stats.latency[i];
+
+                sLog->outInfo(LOG_FILTER_SQL, "  statement %d: %u calls (%s ), avg %u us, max %u us, latency histogram [%s ], %s",
+                    itr->second, total, calls.str().c_str(), uint32(stats.totalTime / total), stats.maxTime, latency.str().c_str(), GetStatementSQL(itr->second));
+            }
+        }
+
     private:
         unsigned long EscapeString(char *to, const char *from, unsigned long length)
         {
@@ -483,13 +545,31 @@ class DatabaseWorkerPool
         {
             uint8 i = 0;
             size_t num_cons = _connectionCount[IDX_SYNCH];
+
+            //! Only measured when the first try fails
+            T* t = _connections[IDX_SYNCH][++i % num_cons];
+            if (t->LockIfReady())
+                return t;
+
+            bool profile = DatabaseProfiler::IsEnabled();
+            uint64 start = 0;
+            if (profile)
+            {
+                start = DatabaseProfiler::GetTime();
+                _stats.BeginConnectionWait();
+            }
+
             //! Block forever until a connection is free
             for (;;)
             {
-                T* t = _connections[IDX_SYNCH][++i % num_cons];
+                t = _connections[IDX_SYNCH][++i % num_cons];
                 //! Must be matched with t->Unlock() or you will get deadlocks
                 if (t->LockIfReady())
+                {
+                    if (profile)
+                        _stats.EndConnectionWait(uint32(DatabaseProfiler::GetTime() - start));
                     return t;
+                }
             }
 
             //! This will be called when Celine Dion learns to sing
@@ -501,6 +581,39 @@ class DatabaseWorkerPool
             return _connectionInfo.database.c_str();
         }
 
+        char const* GetStatementSQL(int32 index) const
+        {
+            if (index == DB_STATEMENT_ADHOC)
+                return "(ad-hoc queries)";
+            if (index == DB_STATEMENT_TRANSACTION)
+                return "(transactions)";
+
+            PreparedStatementMap const& queries = _connections[IDX_SYNCH][0]->m_queries;
+            PreparedStatementMap::const_iterator itr = queries.find(uint32(index));
+            return itr != queries.end() ? itr->second.first : "(unknown)";
+        }
+
+        //! Reports the synchronous statements blocking a map thread. Returns the start time of the statement when profiling.
+        uint64 BeginSynchStatement(int32 index, char const* sql)
+        {
+            if (_stats.CheckBlocking(index))
+            {
+                sLog->outWarn(LOG_FILTER_SQL, "DatabasePool '%s': blocking statement %d run by a map thread: %s",
+                    GetDatabaseName(), index, sql ? sql : GetStatementSQL(index));
+
+                if (DatabaseProfiler::GetBlockingQueryPolicy() == BLOCKING_QUERY_ASSERT)
+                    ASSERT(DatabaseProfiler::GetThreadRole() != DB_THREAD_ROLE_MAP);
+            }
+
+            return DatabaseProfiler::IsEnabled() ? DatabaseProfiler::GetTime() : 0;
+        }
+
+        void EndSynchStatement(int32 index, uint64 start)
+        {
+            if (start)
+                _stats.AddStatement(index, uint32(DatabaseProfiler::GetTime() - start));
+        }
+
     private:
         enum _internalIndex
         {
@@ -513,6 +626,7 @@ class DatabaseWorkerPool
         std::vector<T*>                 _connections[IDX_SIZE];
         uint32                          _connectionCount[IDX_SIZE];       //! Counter of MySQL connections;
         MySQLConnectionInfo             _connectionInfo;
+        DatabaseQueryStats              _stats;             //! Synchronous statements and connection waits.
 };
 
 #endif
@@ -66,11 +66,30 @@ std::string GetConfigStringDefault(std::string base, const char* name, const cha
 // Returns default logger if the requested logger is not found
 Logger* Log::GetLoggerByType(LogFilterType filter)
 {
-    LoggerMap::iterator it = loggers.begin();
-    while (it != loggers.end() && it->second.getType() != filter)
-        ++it;
+    Logger* logger = filter < MaxLogFilter ? filterLoggers[filter] : NULL;
+    return logger ? logger : &(loggers[0]);
+}
+
+void Log::UpdateFilterLevels()
+{
+    Logger* byType[MaxLogFilter];
+    memset(byType, 0, sizeof(byType));
+
+    // first logger of each type, like the former linear lookups
+    for (LoggerMap::iterator it = loggers.begin(); it != loggers.end(); ++it)
+    {
+        uint8 type = uint8(it->second.getType());
+        if (type < MaxLogFilter && !byType[type])
+            byType[type] = &(it->second);
+    }
 
-    return it == loggers.end() ? &(loggers[0]) : &(it->second);
+    // filters without their own logger use the root one
+    for (uint8 type = 0; type < MaxLogFilter; ++type)
+    {
+        Logger* logger = byType[type] ? byType[type] : byType[LOG_FILTER_GENERAL];
+        filterLoggers[type] = byType[type];
+        filterLevels[type] = logger ? long(logger->getLogLevel()) : long(LOG_LEVEL_DISABLED);
+    }
 }
 
 Appender* Log::GetAppenderByName(std::string const& name)
@@ -196,7 +215,7 @@ void Log::CreateLoggerFromConfig(const char* name)
     }
 
     type = atoi(*iter);
-    if (type > MaxLogFilter)
+    if (type < 0 || type >= MaxLogFilter)
     {
         fprintf(stderr, "Log::CreateLoggerFromConfig: Wrong type %u for logger %s\n", type, name);
         return;
@@ -333,6 +352,7 @@ bool Log::SetLogLevel(std::string const& name, const char* newLevelc, bool isLog
             return false;
 
         it->second.setLogLevel(newLevel);
+        UpdateFilterLevels();
     }
     else
     {
@@ -345,24 +365,6 @@ bool Log::SetLogLevel(std::string const& name, const char* newLevelc, bool isLog
     return true;
 }
 
-bool Log::ShouldLog(LogFilterType type, LogLevel level) const
-{
-    LoggerMap::const_iterator it = loggers.begin();
-    while (it != loggers.end() && it->second.getType() != type)
-        ++it;
-
-    if (it != loggers.end())
-    {
-        LogLevel loggerLevel = it->second.getLogLevel();
-        return loggerLevel && loggerLevel <= level;
-    }
-
-    if (type != LOG_FILTER_GENERAL)
-        return ShouldLog(LOG_FILTER_GENERAL, level);
-
-    return false;
-}
-
 void Log::outTrace(LogFilterType filter, const char * str, ...)
 {
     if (!str || !ShouldLog(filter, LOG_LEVEL_TRACE))
@@ -496,6 +498,7 @@ void Log::Close()
     delete worker;
     worker = NULL;
     loggers.clear();
+    UpdateFilterLevels();
     for (AppenderMap::iterator it = appenders.begin(); it != appenders.end(); ++it)
     {
         delete it->second;
@@ -515,6 +518,7 @@ void Log::LoadFromConfig()
             m_logsDir.push_back('/');
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+    UpdateFilterLevels();
 }
 
 void Log::outGmChat( uint32 message_type,
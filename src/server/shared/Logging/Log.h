@@ -24,6 +24,7 @@
 #include "LogWorker.h"
 #include "Logger.h"
 
+#include <ace/Atomic_Op.h>
 #include <ace/Singleton.h>
 
 #include <string>
@@ -42,7 +43,17 @@ class Log
     public:
         void LoadFromConfig();
         void Close();
-        bool ShouldLog(LogFilterType type, LogLevel level) const;
+
+        // lowest enabled level of each filter, read without locking
+        bool ShouldLog(LogFilterType type, LogLevel level) const
+        {
+            if (type >= MaxLogFilter)
+                return false;
+
+            long filterLevel = filterLevels[type].value();
+            return filterLevel && filterLevel <= level;
+        }
+
         bool SetLogLevel(std::string const& name, char const* level, bool isLogger = true);
 
         void outTrace(LogFilterType f, char const* str, ...) ATTR_PRINTF(3,4);
@@ -84,9 +95,14 @@ class Log
         void CreateLoggerFromConfig(const char* name);
         void ReadAppendersFromConfig();
         void ReadLoggersFromConfig();
+        void UpdateFilterLevels();
 
         AppenderMap appenders;
         LoggerMap loggers;
+
+        // rebuilt by UpdateFilterLevels whenever a logger or its level changes
+        ACE_Atomic_Op<ACE_Thread_Mutex, long> filterLevels[MaxLogFilter];
+        Logger* filterLoggers[MaxLogFilter];                // NULL when the filter uses the root logger
         uint8 AppenderId;
 
         std::string m_logsDir;
@@ -100,4 +116,26 @@ class Log
 
 #define sLog ACE_Singleton<Log, ACE_Thread_Mutex>::instance()
 
+// Check the level before evaluating the arguments. Debug messages are all
+// logged through TC_LOG_DEBUG, TRINITY_LOG_NO_DEBUG (WITH_DEBUG_LOG=0)
+// compiles them out with the trace ones.
+#define TC_LOG_MESSAGE(filter, level, method, ...)                  \
+    do {                                                            \
+        if (sLog->ShouldLog(filter, level))                         \
+            sLog->method(filter, __VA_ARGS__);                      \
+    } while (0)
+
+#ifdef TRINITY_LOG_NO_DEBUG
+#define TC_LOG_TRACE(filter, ...) do { } while (0)
+#define TC_LOG_DEBUG(filter, ...) do { } while (0)
+#else
+#define TC_LOG_TRACE(filter, ...) TC_LOG_MESSAGE(filter, LOG_LEVEL_TRACE, outTrace, __VA_ARGS__)
+#define TC_LOG_DEBUG(filter, ...) TC_LOG_MESSAGE(filter, LOG_LEVEL_DEBUG, outDebug, __VA_ARGS__)
+#endif
+
+#define TC_LOG_INFO(filter, ...)  TC_LOG_MESSAGE(filter, LOG_LEVEL_INFO, outInfo, __VA_ARGS__)
+#define TC_LOG_WARN(filter, ...)  TC_LOG_MESSAGE(filter, LOG_LEVEL_WARN, outWarn, __VA_ARGS__)
+#define TC_LOG_ERROR(filter, ...) TC_LOG_MESSAGE(filter, LOG_LEVEL_ERROR, outError, __VA_ARGS__)
+#define TC_LOG_FATAL(filter, ...) TC_LOG_MESSAGE(filter, LOG_LEVEL_FATAL, outFatal, __VA_ARGS__)
+
 #endif
@@ -18,10 +18,21 @@
 
 #include "EventProcessor.h"
 
+#include <algorithm>
+#include <cstring>
+
 EventProcessor::EventProcessor()
 {
     m_time = 0;
     m_aborting = false;
+
+    m_wheelTime = 0;
+    memset(m_slots, 0, sizeof(m_slots));
+    m_usedSlots = 0;
+    m_wheelEvents = 0;
+    m_addCount = 0;
+    m_dueFirst = NULL;
+    m_dueLast = NULL;
 }
 
 EventProcessor::~EventProcessor()
@@ -34,27 +45,30 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
-    // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    for (;;)
     {
-        // get and remove event from queue
-        BasicEvent* Event = i->second;
-        m_events.erase(i);
-
-        if (!Event->to_Abort)
+        // main event loop, executed events may add new due events
+        while (BasicEvent* Event = PopDue())
         {
-            if (Event->Execute(m_time, p_time))
+            if (!Event->to_Abort)
             {
-                // completely destroy event if it is not re-added
+                if (Event->Execute(m_time, p_time))
+                {
+                    // completely destroy event if it is not re-added
+                    delete Event;
+                }
+            }
+            else
+            {
+                Event->Abort(m_time);
                 delete Event;
             }
         }
-        else
-        {
-            Event->Abort(m_time);
-            delete Event;
-        }
+
+        if (m_wheelTime > m_time)
+            break;
+
+        AdvanceWheel();
     }
 }
 
@@ -63,33 +77,49 @@ void EventProcessor::KillAllEvents(bool force)
     // prevent event insertions
     m_aborting = true;
 
-    // first, abort all existing events
-    for (EventList::iterator i = m_events.begin(); i != m_events.end();)
+    // take all events out of the wheel, insertions done by Abort() go to the emptied one
+    BasicEvent* events = NULL;
+    for (uint8 level = 0; level < EVENT_WHEEL_LEVELS; ++level)
     {
-        EventList::iterator i_old = i;
-        ++i;
-
-        i_old->second->to_Abort = true;
-        i_old->second->Abort(m_time);
-        if (force || i_old->second->IsDeletable())
+        for (uint32 slot = 0; slot < EVENT_WHEEL_SLOTS; ++slot)
         {
-            delete i_old->second;
-
-            if (!force)                                      // need per-element cleanup
-                m_events.erase (i_old);
+            while (BasicEvent* Event = m_slots[level][slot])
+            {
+                m_slots[level][slot] = Event->m_nextEvent;
+                Event->m_nextEvent = events;
+                events = Event;
+            }
         }
     }
 
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
+    m_usedSlots = 0;
+    m_wheelEvents = 0;
+
+    AppendDue(events);
+    events = m_dueFirst;
+    m_dueFirst = NULL;
+    m_dueLast = NULL;
+
+    // abort all existing events, keep the ones which can't be deleted yet
+    while (BasicEvent* Event = events)
+    {
+        events = Event->m_nextEvent;
+
+        Event->to_Abort = true;
+        Event->Abort(m_time);
+        if (force || Event->IsDeletable())
+            delete Event;
+        else
+            Schedule(Event);
+    }
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
 {
     if (set_addtime) Event->m_addTime = m_time;
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    Event->m_addOrder = m_addCount++;
+    Schedule(Event);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -97,3 +127,215 @@ uint64 EventProcessor::CalculateTime(uint64 t_offset) const
     return(m_time + t_offset);
 }
 
+void EventProcessor::Schedule(BasicEvent* Event)
+{
+    Event->m_nextEvent = NULL;
+
+    // already reached by the wheel, executed in the current or next update
+    if (Event->m_execTime < m_wheelTime)
+    {
+        InsertDue(Event);
+        return;
+    }
+
+    uint64 delay = Event->m_execTime - m_wheelTime;
+    uint64 time = Event->m_execTime;
+
+    // lowest level the delay fits in, later events wait in the furthest slot and are rescheduled from there
+    uint8 level = 0;
+    while (level < EVENT_WHEEL_LEVELS - 1 && delay >= (uint64(1) << ((level + 1) * EVENT_WHEEL_BITS)))
+        ++level;
+
+    if (delay >= (uint64(1) << (EVENT_WHEEL_LEVELS * EVENT_WHEEL_BITS)))
+        time = m_wheelTime + (uint64(1) << (EVENT_WHEEL_LEVELS * EVENT_WHEEL_BITS)) - 1;
+
+    uint32 slot = uint32(time >> (level * EVENT_WHEEL_BITS)) & EVENT_WHEEL_MASK;
+    Event->m_nextEvent = m_slots[level][slot];
+    m_slots[level][slot] = Event;
+    ++m_wheelEvents;
+
+    if (!level)
+        m_usedSlots |= uint64(1) << slot;
+}
+
+void EventProcessor::Cascade(uint8 level, uint64 time)
+{
+    uint32 slot = uint32(time >> (level * EVENT_WHEEL_BITS)) & EVENT_WHEEL_MASK;
+
+    // the next slot of the level above wraps with this one
+    if (!slot && level < EVENT_WHEEL_LEVELS - 1)
+        Cascade(level + 1, time);
+
+    BasicEvent* events = m_slots[level][slot];
+    m_slots[level][slot] = NULL;
+
+    while (BasicEvent* Event = events)
+    {
+        events = Event->m_nextEvent;
+        --m_wheelEvents;
+        Schedule(Event);
+    }
+}
+
+void EventProcessor::AdvanceWheel()
+{
+    // nothing waiting, the wheel can jump anywhere
+    if (!m_wheelEvents)
+    {
+        m_wheelTime = m_time + 1;
+        return;
+    }
+
+    uint64 time = m_wheelTime;
+    uint32 slot = uint32(time) & EVENT_WHEEL_MASK;
+
+    // first slot of the level, spread the slot of the level above over it
+    if (!slot)
+        Cascade(1, time);
+
+    if (BasicEvent* events = m_slots[0][slot])
+    {
+        m_slots[0][slot] = NULL;
+        m_usedSlots &= ~(uint64(1) << slot);
+
+        for (BasicEvent* Event = events; Event; Event = Event->m_nextEvent)
+            --m_wheelEvents;
+
+        // all of the same time, executed in adding order
+        AppendDue(SortByAddOrder(events));
+    }
+
+    // skip to the next used slot, stopping at the end of the level for the cascade
+    uint64 next = (time | EVENT_WHEEL_MASK) + 1;
+    if (slot < EVENT_WHEEL_MASK)
+    {
+        uint64 pending = m_usedSlots >> (slot + 1);
+        if (pending)
+        {
+            ++slot;
+            for (; !(pending & 1); pending >>= 1)
+                ++slot;
+
+            next = (time & ~uint64(EVENT_WHEEL_MASK)) + slot;
+        }
+    }
+
+    m_wheelTime = std::min(next, m_time + 1);
+}
+
+BasicEvent* EventProcessor::SortByAddOrder(BasicEvent* events)
+{
+    // merge sort of the list, the events cascaded from the levels above and the ones
+    // added directly to the slot are interleaved, an insertion sort turns quadratic
+    for (uint32 runSize = 1; ; runSize *= 2)
+    {
+        BasicEvent* sorted = NULL;
+        BasicEvent** tail = &sorted;
+        uint32 merges = 0;
+
+        while (events)
+        {
+            ++merges;
+
+            // next two runs of runSize events
+            BasicEvent* left = events;
+            uint32 leftSize = 0;
+            while (events && leftSize < runSize)
+            {
+                events = events->m_nextEvent;
+                ++leftSize;
+            }
+
+            BasicEvent* right = events;
+            uint32 rightSize = 0;
+            while (events && rightSize < runSize)
+            {
+                events = events->m_nextEvent;
+                ++rightSize;
+            }
+
+            while (leftSize || rightSize)
+            {
+                BasicEvent* Event;
+                if (!rightSize || (leftSize && left->m_addOrder < right->m_addOrder))
+                {
+                    Event = left;
+                    left = left->m_nextEvent;
+                    --leftSize;
+                }
+                else
+                {
+                    Event = right;
+                    right = right->m_nextEvent;
+                    --rightSize;
+                }
+
+                *tail = Event;
+                tail = &Event->m_nextEvent;
+            }
+        }
+
+        *tail = NULL;
+
+        if (merges <= 1)
+            return sorted;
+
+        events = sorted;
+    }
+}
+
+void EventProcessor::AppendDue(BasicEvent* events)
+{
+    if (!events)
+        return;
+
+    if (m_dueLast)
+        m_dueLast->m_nextEvent = events;
+    else
+        m_dueFirst = events;
+
+    while (events->m_nextEvent)
+        events = events->m_nextEvent;
+
+    m_dueLast = events;
+}
+
+void EventProcessor::InsertDue(BasicEvent* Event)
+{
+    // mostly added for the current time, after all the due events
+    if (!m_dueLast || !IsBefore(Event, m_dueLast))
+    {
+        AppendDue(Event);
+        return;
+    }
+
+    // added during an update for an earlier time, the former multimap executed it first
+    BasicEvent** itr = &m_dueFirst;
+    while (!IsBefore(Event, *itr))
+        itr = &(*itr)->m_nextEvent;
+
+    Event->m_nextEvent = *itr;
+    *itr = Event;
+}
+
+bool EventProcessor::IsBefore(BasicEvent const* left, BasicEvent const* right)
+{
+    if (left->m_execTime != right->m_execTime)
+        return left->m_execTime < right->m_execTime;
+
+    return left->m_addOrder < right->m_addOrder;
+}
+
+BasicEvent* EventProcessor::PopDue()
+{
+    BasicEvent* Event = m_dueFirst;
+    if (!Event)
+        return NULL;
+
+    m_dueFirst = Event->m_nextEvent;
+    if (!m_dueFirst)
+        m_dueLast = NULL;
+
+    Event->m_nextEvent = NULL;
+    return Event;
+}
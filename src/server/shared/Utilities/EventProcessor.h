@@ -21,14 +21,12 @@
 
 #include "Define.h"
 
-#include <map>
-
 // Note. All times are in milliseconds here.
 
 class BasicEvent
 {
     public:
-        BasicEvent() { to_Abort = false; }
+        BasicEvent() { to_Abort = false; m_nextEvent = NULL; }
         virtual ~BasicEvent() {}                              // override destructor to perform some actions on event removal
 
 
@@ -47,10 +45,26 @@ class BasicEvent
         // these can be used for time offset control
         uint64 m_addTime;                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
+
+        uint64 m_addOrder;                                  // order of the AddEvent call, same time events execute in it, filled by event handler
+        BasicEvent* m_nextEvent;                            // next event in the same EventProcessor slot, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+// Timing wheel of 4 levels of 64 slots, of 1 ms, 64 ms, 4 s and 4.4 min each
+#define EVENT_WHEEL_LEVELS      4
+#define EVENT_WHEEL_BITS        6
+#define EVENT_WHEEL_SLOTS       (1 << EVENT_WHEEL_BITS)
+#define EVENT_WHEEL_MASK        (EVENT_WHEEL_SLOTS - 1)
 
+/*
+ * Events wait in the slot of their execution time, linked through
+ * BasicEvent::m_nextEvent, so adding one allocates nothing. The slots of the
+ * first level are executed in time order, when the update time reaches them,
+ * and the slots of the upper levels are spread over the level below when it
+ * wraps. Events of the same millisecond are executed in the order they were
+ * added, like with the former multimap, and events later than the last level
+ * are rescheduled when reached.
+ */
 class EventProcessor
 {
     public:
@@ -63,7 +77,25 @@ class EventProcessor
         uint64 CalculateTime(uint64 t_offset) const;
     protected:
         uint64 m_time;
-        EventList m_events;
         bool m_aborting;
+
+    private:
+        void Schedule(BasicEvent* Event);
+        void Cascade(uint8 level, uint64 time);
+        void AdvanceWheel();
+        static BasicEvent* SortByAddOrder(BasicEvent* events);
+        void AppendDue(BasicEvent* events);
+        void InsertDue(BasicEvent* Event);
+        static bool IsBefore(BasicEvent const* left, BasicEvent const* right);
+        BasicEvent* PopDue();
+
+        uint64 m_wheelTime;                                 // first time not moved to the due events yet
+        BasicEvent* m_slots[EVENT_WHEEL_LEVELS][EVENT_WHEEL_SLOTS];   // newest event first
+        uint64 m_usedSlots;                                 // non empty slots of the first level
+        uint32 m_wheelEvents;                               // events in m_slots
+        uint64 m_addCount;                                  // AddEvent calls, for BasicEvent::m_addOrder
+
+        BasicEvent* m_dueFirst;                             // events to execute, in execution time then adding order
+        BasicEvent* m_dueLast;
 };
 #endif
\ No newline at end of file
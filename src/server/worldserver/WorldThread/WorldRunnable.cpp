@@ -47,6 +47,8 @@ void WorldRunnable::run()
 
     uint32 prevSleepTime = 0;                               // used for balanced full tick time length near WORLD_SLEEP_CONST
 
+    DatabaseProfiler::SetThreadRole(DB_THREAD_ROLE_WORLD);
+
     sScriptMgr->OnStartup();
 
     ///- While we have not World::m_stopEvent, update the world
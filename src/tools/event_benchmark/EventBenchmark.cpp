@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs the same event workloads on the timing wheel EventProcessor and on the
+ * former multimap one. The check workload compares the order, the execution
+ * time and the planned time of every executed event, with delays up to three
+ * revolutions of the wheel; the benchmark workloads compare the update times.
+ */
+
+#include "EventProcessor.h"
+#include "MultimapEventProcessor.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#define WHEEL_REVOLUTION    (uint64(1) << (EVENT_WHEEL_LEVELS * EVENT_WHEEL_BITS))
+
+namespace
+{
+    struct Execution
+    {
+        uint32 id;
+        uint64 time;                                        // e_time given to Execute
+        uint64 planned;                                     // m_execTime
+    };
+
+    // deterministic, both processors see the same workload as long as they execute in the same order
+    uint32 NextRandom(uint32& seed)
+    {
+        seed = seed * 1103515245 + 12345;
+        return seed >> 8;
+    }
+
+    uint64 CheckDelay(uint32& seed)
+    {
+        switch (NextRandom(seed) % 6)
+        {
+            case 0: return NextRandom(seed) % EVENT_WHEEL_SLOTS;
+            case 1: return NextRandom(seed) % (EVENT_WHEEL_SLOTS * EVENT_WHEEL_SLOTS);
+            case 2: return NextRandom(seed) % (EVENT_WHEEL_SLOTS * EVENT_WHEEL_SLOTS * EVENT_WHEEL_SLOTS);
+            case 3: return NextRandom(seed) % WHEEL_REVOLUTION;
+            case 4: return WHEEL_REVOLUTION - 2 + NextRandom(seed) % 4;
+            default: return (uint64(NextRandom(seed)) * 3) % (3 * WHEEL_REVOLUTION);
+        }
+    }
+
+    template<class Processor>
+    class CheckEvent : public BasicEvent
+    {
+        public:
+            CheckEvent(Processor& events, std::vector<Execution>& executions, uint32& seed, uint32 id, uint32 repeats) :
+                _events(events), _executions(executions), _seed(seed), _id(id), _repeats(repeats) { }
+
+            bool Execute(uint64 e_time, uint32 /*p_time*/)
+            {
+                Execution execution;
+                execution.id = _id;
+                execution.time = e_time;
+                execution.planned = m_execTime;
+                _executions.push_back(execution);
+
+                // events added by an executed event, for the current update or an earlier time
+                if (!(NextRandom(_seed) % 8))
+                {
+                    uint64 back = NextRandom(_seed) % 100;
+                    uint64 time = e_time > back ? e_time - back : 0;
+                    _events.AddEvent(new CheckEvent(_events, _executions, _seed, _id + 1000000, 0), time);
+                }
+
+                if (!_repeats)
+                    return true;
+
+                --_repeats;
+                _events.AddEvent(this, _events.CalculateTime(CheckDelay(_seed)));
+                return false;
+            }
+
+        private:
+            Processor& _events;
+            std::vector<Execution>& _executions;
+            uint32& _seed;
+            uint32 _id;
+            uint32 _repeats;
+    };
+
+    template<class Processor>
+    void RunCheck(std::vector<Execution>& executions, uint32 count)
+    {
+        Processor events;
+        uint32 seed = 1;
+
+        for (uint32 id = 0; id < count; ++id)
+            events.AddEvent(new CheckEvent<Processor>(events, executions, seed, id, NextRandom(seed) % 4), events.CalculateTime(CheckDelay(seed)));
+
+        // regular updates with some long stalls, until past the last possible event
+        uint64 time = 0;
+        while (time < 16 * WHEEL_REVOLUTION)
+        {
+            uint32 diff = (NextRandom(seed) % 64) ? 1 + NextRandom(seed) % 200 : NextRandom(seed) % (1 << 22);
+            events.Update(diff);
+            time += diff;
+        }
+    }
+
+    class BenchmarkEvent : public BasicEvent
+    {
+        public:
+            BenchmarkEvent(uint32 id, uint32 minDelay, uint32 maxDelay, uint32& executed) :
+                _id(id), _minDelay(minDelay), _maxDelay(maxDelay), _executed(executed) { }
+
+            uint32 NextDelay() { return _minDelay + (_id = _id * 1103515245 + 12345) % (_maxDelay - _minDelay + 1); }
+
+            void Executed() { ++_executed; }
+
+        private:
+            uint32 _id;
+            uint32 _minDelay;
+            uint32 _maxDelay;
+            uint32& _executed;
+    };
+
+    // periodic event re-adding itself, like auras and spell casts
+    template<class Processor>
+    class RepeatingEvent : public BenchmarkEvent
+    {
+        public:
+            RepeatingEvent(Processor& events, uint32 id, uint32 minDelay, uint32 maxDelay, uint32& executed) :
+                BenchmarkEvent(id, minDelay, maxDelay, executed), _events(events) { }
+
+            bool Execute(uint64 /*e_time*/, uint32 /*p_time*/)
+            {
+                Executed();
+                _events.AddEvent(this, _events.CalculateTime(NextDelay()));
+                return false;
+            }
+
+        private:
+            Processor& _events;
+    };
+
+    template<class Processor>
+    double RunBenchmark(uint32 count, uint32 minDelay, uint32 maxDelay, uint32 updates, uint32& executed)
+    {
+        Processor events;
+        executed = 0;
+
+        for (uint32 id = 0; id < count; ++id)
+        {
+            RepeatingEvent<Processor>* Event = new RepeatingEvent<Processor>(events, id, minDelay, maxDelay, executed);
+            events.AddEvent(Event, events.CalculateTime(Event->NextDelay()));
+        }
+
+        clock_t start = clock();
+        for (uint32 i = 0; i < updates; ++i)
+            events.Update(50);
+
+        return double(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+    }
+
+    bool Check(uint32 count)
+    {
+        std::vector<Execution> wheel;
+        std::vector<Execution> multimap;
+        RunCheck<EventProcessor>(wheel, count);
+        RunCheck<MultimapEventProcessor>(multimap, count);
+
+        for (size_t i = 0; i < wheel.size() && i < multimap.size(); ++i)
+        {
+            if (wheel[i].id != multimap[i].id || wheel[i].time != multimap[i].time || wheel[i].planned != multimap[i].planned)
+            {
+                printf("check: execution %u differs, wheel event %u at " UI64FMTD " planned " UI64FMTD ", multimap event %u at " UI64FMTD " planned " UI64FMTD "\n",
+                    uint32(i), wheel[i].id, wheel[i].time, wheel[i].planned, multimap[i].id, multimap[i].time, multimap[i].planned);
+                return false;
+            }
+        }
+
+        if (wheel.size() != multimap.size())
+        {
+            printf("check: %u executions on the wheel, %u on the multimap\n", uint32(wheel.size()), uint32(multimap.size()));
+            return false;
+        }
+
+        uint32 beyond = 0;
+        for (size_t i = 0; i < wheel.size(); ++i)
+            if (wheel[i].planned >= WHEEL_REVOLUTION)
+                ++beyond;
+
+        printf("check: %u executions in the same order and at the same time, %u of them after the first revolution of the wheel\n", uint32(wheel.size()), beyond);
+        return true;
+    }
+
+    void Benchmark(char const* name, uint32 count, uint32 minDelay, uint32 maxDelay, uint32 updates)
+    {
+        uint32 wheelExecuted;
+        uint32 multimapExecuted;
+        double wheelTime = RunBenchmark<EventProcessor>(count, minDelay, maxDelay, updates, wheelExecuted);
+        double multimapTime = RunBenchmark<MultimapEventProcessor>(count, minDelay, maxDelay, updates, multimapExecuted);
+
+        printf("%-10s %8u events %6u-%-6u ms: wheel %8.1f ms, multimap %8.1f ms for %u executions\n",
+            name, count, minDelay, maxDelay, wheelTime, multimapTime, wheelExecuted);
+
+        if (wheelExecuted != multimapExecuted)
+            printf("%-10s executions differ, wheel %u, multimap %u\n", name, wheelExecuted, multimapExecuted);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint32 count = argc > 1 ? uint32(atoi(argv[1])) : 100000;
+    uint32 updates = argc > 2 ? uint32(atoi(argv[2])) : 600;
+
+    if (!count || !updates)
+    {
+        printf("usage: %s [events] [updates]\n", argv[0]);
+        return 1;
+    }
+
+    if (!Check(20000))
+        return 1;
+
+    // 50 ms updates, as the world and map updates
+    Benchmark("short", count, 1, 500, updates);
+    Benchmark("medium", count, 500, 10000, updates);
+    Benchmark("long", count, 10000, 600000, updates);
+    return 0;
+}
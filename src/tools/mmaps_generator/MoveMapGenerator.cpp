@@ -0,0 +1,493 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <direct.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+#include "Define.h"
+#include "NavTileDefines.h"
+
+/*
+ * Builds navigation tiles (mmaps/<map><x><y>.mmtile) from the terrain files written by
+ * mapextractor. Every V8 point of the height map becomes a nav cell; a cell is
+ * linked to its neighbours when the terrain between both centers can be climbed.
+ */
+
+// .map file format, see map_extractor
+#define MAP_HEIGHT_NO_HEIGHT        0x0001
+#define MAP_HEIGHT_AS_INT16         0x0002
+#define MAP_HEIGHT_AS_INT8          0x0004
+
+#define MAP_LIQUID_TYPE_WATER       0x01
+#define MAP_LIQUID_TYPE_OCEAN       0x02
+#define MAP_LIQUID_TYPE_MAGMA       0x04
+#define MAP_LIQUID_TYPE_SLIME       0x08
+
+#define MAP_LIQUID_NO_TYPE          0x0001
+#define MAP_LIQUID_NO_HEIGHT        0x0002
+
+#define ADT_CELLS_PER_GRID          16
+#define ADT_CELL_SIZE               8
+
+static char const* MAP_MAGIC         = "MAPS";
+static char const* MAP_VERSION_MAGIC = "v1.3";
+static char const* MAP_HEIGHT_MAGIC  = "MHGT";
+static char const* MAP_LIQUID_MAGIC  = "MLIQ";
+
+struct map_fileheader
+{
+    uint32 mapMagic;
+    uint32 versionMagic;
+    uint32 buildMagic;
+    uint32 areaMapOffset;
+    uint32 areaMapSize;
+    uint32 heightMapOffset;
+    uint32 heightMapSize;
+    uint32 liquidMapOffset;
+    uint32 liquidMapSize;
+    uint32 holesOffset;
+    uint32 holesSize;
+};
+
+struct map_heightHeader
+{
+    uint32 fourcc;
+    uint32 flags;
+    float  gridHeight;
+    float  gridMaxHeight;
+};
+
+struct map_liquidHeader
+{
+    uint32 fourcc;
+    uint16 flags;
+    uint16 liquidType;
+    uint8  offsetX;
+    uint8  offsetY;
+    uint8  width;
+    uint8  height;
+    float  liquidLevel;
+};
+
+struct TerrainTile
+{
+    float V9[NAV_TILE_CELLS + 1][NAV_TILE_CELLS + 1];
+    float V8[NAV_TILE_CELLS][NAV_TILE_CELLS];
+    uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+    map_liquidHeader liquid;
+    bool hasLiquid;
+    uint8 liquidFlags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+    bool hasLiquidFlags;
+    std::vector<float> liquidMap;
+};
+
+struct NavTileData
+{
+    float height[NAV_TILE_CELLS * NAV_TILE_CELLS];
+    uint8 flags[NAV_TILE_CELLS * NAV_TILE_CELLS];
+    uint8 links[NAV_TILE_CELLS * NAV_TILE_CELLS];
+};
+
+void CreateDir(std::string const& path)
+{
+#ifdef _WIN32
+    _mkdir(path.c_str());
+#else
+    mkdir(path.c_str(), S_IRWXU | S_IRWXG | S_IRWXO); // 0777
+#endif
+}
+
+bool GetMapFiles(std::string const& dir, std::vector<std::string>& files)
+{
+#ifdef _WIN32
+    WIN32_FIND_DATA data;
+    HANDLE find = FindFirstFile((dir + "/*.map").c_str(), &data);
+    if (find == INVALID_HANDLE_VALUE)
+        return false;
+
+    do
+        files.push_back(data.cFileName);
+    while (FindNextFile(find, &data));
+
+    FindClose(find);
+#else
+    DIR* dp = opendir(dir.c_str());
+    if (!dp)
+        return false;
+
+    while (dirent* entry = readdir(dp))
+    {
+        std::string name = entry->d_name;
+        if (name.size() == 11 && name.compare(7, 4, ".map") == 0)
+            files.push_back(name);
+    }
+
+    closedir(dp);
+#endif
+    return true;
+}
+
+template<class T>
+bool ReadHeights(FILE* in, map_heightHeader const& header, float multiplier, TerrainTile& tile)
+{
+    static T V9[NAV_TILE_CELLS + 1][NAV_TILE_CELLS + 1];
+    static T V8[NAV_TILE_CELLS][NAV_TILE_CELLS];
+
+    if (fread(V9, sizeof(V9), 1, in) != 1 || fread(V8, sizeof(V8), 1, in) != 1)
+        return false;
+
+    for (int x = 0; x <= NAV_TILE_CELLS; ++x)
+        for (int y = 0; y <= NAV_TILE_CELLS; ++y)
+            tile.V9[x][y] = header.gridHeight + float(V9[x][y]) * multiplier;
+
+    for (int x = 0; x < NAV_TILE_CELLS; ++x)
+        for (int y = 0; y < NAV_TILE_CELLS; ++y)
+            tile.V8[x][y] = header.gridHeight + float(V8[x][y]) * multiplier;
+
+    return true;
+}
+
+bool LoadTerrain(char const* filename, TerrainTile& tile)
+{
+    FILE* in = fopen(filename, "rb");
+    if (!in)
+        return false;
+
+    map_fileheader fileHeader;
+    if (fread(&fileHeader, sizeof(fileHeader), 1, in) != 1 ||
+        fileHeader.mapMagic != *(uint32 const*)MAP_MAGIC || fileHeader.versionMagic != *(uint32 const*)MAP_VERSION_MAGIC)
+    {
+        printf("%s is not a map file of this version, redo it with mapextractor\n", filename);
+        fclose(in);
+        return false;
+    }
+
+    map_heightHeader heightHeader;
+    fseek(in, fileHeader.heightMapOffset, SEEK_SET);
+    if (fread(&heightHeader, sizeof(heightHeader), 1, in) != 1 || heightHeader.fourcc != *(uint32 const*)MAP_HEIGHT_MAGIC)
+    {
+        fclose(in);
+        return false;
+    }
+
+    bool ok = true;
+    if (heightHeader.flags & MAP_HEIGHT_NO_HEIGHT)
+    {
+        for (int x = 0; x <= NAV_TILE_CELLS; ++x)
+            for (int y = 0; y <= NAV_TILE_CELLS; ++y)
+                tile.V9[x][y] = heightHeader.gridHeight;
+
+        for (int x = 0; x < NAV_TILE_CELLS; ++x)
+            for (int y = 0; y < NAV_TILE_CELLS; ++y)
+                tile.V8[x][y] = heightHeader.gridHeight;
+    }
+    else if (heightHeader.flags & MAP_HEIGHT_AS_INT16)
+        ok = ReadHeights<uint16>(in, heightHeader, (heightHeader.gridMaxHeight - heightHeader.gridHeight) / 65535, tile);
+    else if (heightHeader.flags & MAP_HEIGHT_AS_INT8)
+        ok = ReadHeights<uint8>(in, heightHeader, (heightHeader.gridMaxHeight - heightHeader.gridHeight) / 255, tile);
+    else
+    {
+        heightHeader.gridHeight = 0.0f;
+        ok = ReadHeights<float>(in, heightHeader, 1.0f, tile);
+    }
+
+    tile.hasLiquid = false;
+    tile.hasLiquidFlags = false;
+    tile.liquidMap.clear();
+    if (ok && fileHeader.liquidMapOffset)
+    {
+        fseek(in, fileHeader.liquidMapOffset, SEEK_SET);
+        if (fread(&tile.liquid, sizeof(tile.liquid), 1, in) == 1 && tile.liquid.fourcc == *(uint32 const*)MAP_LIQUID_MAGIC)
+        {
+            tile.hasLiquid = true;
+            if (!(tile.liquid.flags & MAP_LIQUID_NO_TYPE))
+            {
+                uint16 entries[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+                ok = fread(entries, sizeof(entries), 1, in) == 1 && fread(tile.liquidFlags, sizeof(tile.liquidFlags), 1, in) == 1;
+                tile.hasLiquidFlags = true;
+            }
+
+            if (ok && !(tile.liquid.flags & MAP_LIQUID_NO_HEIGHT))
+            {
+                tile.liquidMap.resize(size_t(tile.liquid.width) * tile.liquid.height);
+                ok = fread(&tile.liquidMap[0], sizeof(float), tile.liquidMap.size(), in) == tile.liquidMap.size();
+            }
+        }
+    }
+
+    memset(tile.holes, 0, sizeof(tile.holes));
+    if (ok && fileHeader.holesSize)
+    {
+        fseek(in, fileHeader.holesOffset, SEEK_SET);
+        ok = fread(tile.holes, sizeof(tile.holes), 1, in) == 1;
+    }
+
+    fclose(in);
+    return ok;
+}
+
+bool IsHole(TerrainTile const& tile, int x, int y)
+{
+    static uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
+    static uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
+
+    uint16 hole = tile.holes[x / ADT_CELL_SIZE][y / ADT_CELL_SIZE];
+    return (hole & holetab_h[(y % ADT_CELL_SIZE) / 2] & holetab_v[(x % ADT_CELL_SIZE) / 2]) != 0;
+}
+
+// returns liquid type flags of the cell, level is set when there is liquid
+uint8 GetLiquid(TerrainTile const& tile, int x, int y, float& level)
+{
+    if (!tile.hasLiquid)
+        return 0;
+
+    uint8 type = tile.hasLiquidFlags ? tile.liquidFlags[x / ADT_CELL_SIZE][y / ADT_CELL_SIZE] : uint8(tile.liquid.liquidType);
+    if (!type)
+        return 0;
+
+    if (tile.liquidMap.empty())
+    {
+        level = tile.liquid.liquidLevel;
+        return type;
+    }
+
+    // same (swapped) offsets as GridMap::getLiquidLevel
+    int lx = x - tile.liquid.offsetY;
+    int ly = y - tile.liquid.offsetX;
+    if (lx < 0 || lx >= tile.liquid.height || ly < 0 || ly >= tile.liquid.width)
+        return 0;
+
+    level = tile.liquidMap[lx * tile.liquid.width + ly];
+    return type;
+}
+
+// height of the terrain where the segment between a cell center and its neighbour's leaves the cell
+float GetBorderHeight(TerrainTile const& tile, int x, int y, uint8 dir)
+{
+    int dx = NavDirectionX(dir);
+    int dy = NavDirectionY(dir);
+    int vx = x + (dx > 0 ? 1 : 0);
+    int vy = y + (dy > 0 ? 1 : 0);
+
+    if (IsDiagonalNavDirection(dir))
+        return tile.V9[vx][vy];
+
+    if (dx)
+        return (tile.V9[vx][y] + tile.V9[vx][y + 1]) * 0.5f;
+
+    return (tile.V9[x][vy] + tile.V9[x + 1][vy]) * 0.5f;
+}
+
+void BuildNavTile(TerrainTile const& tile, NavTileData& nav)
+{
+    for (int x = 0; x < NAV_TILE_CELLS; ++x)
+    {
+        for (int y = 0; y < NAV_TILE_CELLS; ++y)
+        {
+            int idx = x * NAV_TILE_CELLS + y;
+            float ground = tile.V8[x][y];
+            uint8 flags = 0;
+
+            if (!IsHole(tile, x, y))
+            {
+                flags = NAV_CELL_WALKABLE;
+
+                float level;
+                if (uint8 liquid = GetLiquid(tile, x, y, level))
+                {
+                    if ((liquid & (MAP_LIQUID_TYPE_MAGMA | MAP_LIQUID_TYPE_SLIME)) && level > ground)
+                        flags = NAV_CELL_HAZARD;
+                    else if (level - ground > NAV_SWIM_DEPTH)
+                        flags = NAV_CELL_WATER;
+                }
+            }
+
+            nav.height[idx] = ground;
+            nav.flags[idx] = flags;
+        }
+    }
+
+    float const halfStep[2] = { NAV_CELL_SIZE * 0.5f, NAV_CELL_SIZE * 0.5f * 1.41421356f };
+
+    for (int x = 0; x < NAV_TILE_CELLS; ++x)
+    {
+        for (int y = 0; y < NAV_TILE_CELLS; ++y)
+        {
+            int idx = x * NAV_TILE_CELLS + y;
+            uint8 links = 0;
+
+            if (nav.flags[idx] & (NAV_CELL_WALKABLE | NAV_CELL_WATER))
+            {
+                for (uint8 dir = 0; dir < MAX_NAV_DIRECTIONS; ++dir)
+                {
+                    float half = halfStep[IsDiagonalNavDirection(dir) ? 1 : 0];
+                    float border = GetBorderHeight(tile, x, y, dir);
+
+                    // swimmers float over the ridge
+                    if (!(nav.flags[idx] & NAV_CELL_WATER) && fabs(border - nav.height[idx]) > NAV_MAX_CLIMB_SLOPE * half)
+                        continue;
+
+                    int nx = x + NavDirectionX(dir);
+                    int ny = y + NavDirectionY(dir);
+
+                    // other tile, the server checks the far half once the neighbour is loaded
+                    if (nx < 0 || ny < 0 || nx >= NAV_TILE_CELLS || ny >= NAV_TILE_CELLS)
+                    {
+                        links |= 1 << dir;
+                        continue;
+                    }
+
+                    int nidx = nx * NAV_TILE_CELLS + ny;
+                    if (!(nav.flags[nidx] & (NAV_CELL_WALKABLE | NAV_CELL_WATER)))
+                        continue;
+
+                    if (!(nav.flags[nidx] & NAV_CELL_WATER) && fabs(nav.height[nidx] - border) > NAV_MAX_CLIMB_SLOPE * half)
+                        continue;
+
+                    links |= 1 << dir;
+                }
+            }
+
+            nav.links[idx] = links;
+        }
+    }
+}
+
+bool WriteNavTile(char const* filename, NavTileHeader const& header, NavTileData const& nav)
+{
+    FILE* out = fopen(filename, "wb");
+    if (!out)
+    {
+        printf("Can't create the output file '%s'\n", filename);
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, out) == 1 &&
+        fwrite(nav.height, sizeof(nav.height), 1, out) == 1 &&
+        fwrite(nav.flags, sizeof(nav.flags), 1, out) == 1 &&
+        fwrite(nav.links, sizeof(nav.links), 1, out) == 1;
+
+    fclose(out);
+    return ok;
+}
+
+void Usage(char const* prg)
+{
+    printf("Usage: %s [-i input_path] [-o output_path] [-m map_id]\n"\
+        "  -i  data directory containing maps/, default ./\n"\
+        "  -o  output directory, mmaps/ is created there, default ./\n"\
+        "  -m  only build tiles of this map\n", prg);
+}
+
+int main(int argc, char* argv[])
+{
+    std::string input = ".";
+    std::string output = ".";
+    int onlyMap = -1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-i") && i + 1 < argc)
+            input = argv[++i];
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            output = argv[++i];
+        else if (!strcmp(argv[i], "-m") && i + 1 < argc)
+            onlyMap = atoi(argv[++i]);
+        else
+        {
+            Usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::vector<std::string> files;
+    if (!GetMapFiles(input + "/maps", files) || files.empty())
+    {
+        printf("No map files found in %s/maps, run mapextractor first\n", input.c_str());
+        return 1;
+    }
+
+    CreateDir(output + "/mmaps");
+
+    // both are too big for the stack
+    TerrainTile* terrain = new TerrainTile();
+    NavTileData* nav = new NavTileData();
+
+    uint32 built = 0, failed = 0;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        uint32 mapId = atoi(files[i].substr(0, 3).c_str());
+        uint32 tileX = atoi(files[i].substr(3, 2).c_str());
+        uint32 tileY = atoi(files[i].substr(5, 2).c_str());
+
+        if (onlyMap >= 0 && mapId != uint32(onlyMap))
+            continue;
+
+        std::string source = input + "/maps/" + files[i];
+        if (!LoadTerrain(source.c_str(), *terrain))
+        {
+            printf("Can't read %s, skipped\n", source.c_str());
+            ++failed;
+            continue;
+        }
+
+        BuildNavTile(*terrain, *nav);
+
+        NavTileHeader header;
+        header.magic = NAV_TILE_MAGIC;
+        header.version = NAV_TILE_VERSION;
+        header.mapId = mapId;
+        header.tileX = tileX;
+        header.tileY = tileY;
+        header.cells = NAV_TILE_CELLS;
+
+        char filename[32];
+        sprintf(filename, "%03u%02u%02u.mmtile", mapId, tileX, tileY);
+        std::string dest = output + "/mmaps/" + filename;
+
+        if (!WriteNavTile(dest.c_str(), header, *nav))
+        {
+            ++failed;
+            continue;
+        }
+
+        ++built;
+        printf("Built %s [%u/%u]\r", filename, uint32(i + 1), uint32(files.size()));
+        fflush(stdout);
+    }
+
+    delete terrain;
+    delete nav;
+
+    printf("\n%u tiles built, %u failed\n", built, failed);
+    return failed ? 1 : 0;
+}
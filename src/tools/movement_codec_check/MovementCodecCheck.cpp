@@ -0,0 +1,696 @@
+/*
+ * Copyright (C) 2008-2012 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Round trip check of the movement codecs against the former interpreter of
+ * the MovementStatusElements sequences, kept here as the reference. Run it
+ * after changing MovementStructures.cpp or MovementCodec.cpp, it returns 1 if
+ * any packet is written or read differently.
+ */
+
+#include "MovementCodec.h"
+#include "Player.h"
+
+#include <cstdio>
+#include <cstring>
+
+#define MOVEMENT_CHECK_VARIANTS     32                      // movement infos written per opcode
+#define MOVEMENT_CHECK_RANDOM_SIZE  128                     // bytes of the random packets read per opcode
+
+namespace
+{
+    // former Player::ReadMovementInfo loop, false on an element it could not read
+    bool ReferenceRead(MovementStatusElements const* sequence, MovementReadState& s)
+    {
+        WorldPacket& data = s.data;
+        MovementInfo* mi = s.mi;
+
+        for (; *sequence != MSEEnd; ++sequence)
+        {
+            MovementStatusElements const& element = *sequence;
+
+            if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+            {
+                s.guid[element - MSEHasGuidByte0] = data.ReadBit();
+                continue;
+            }
+
+            if (element >= MSEHasTransportGuidByte0 &&
+                element <= MSEHasTransportGuidByte7)
+            {
+                if (s.hasTransportData)
+                    s.tguid[element - MSEHasTransportGuidByte0] = data.ReadBit();
+                continue;
+            }
+
+            if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+            {
+                data.ReadByteSeq(s.guid[element - MSEGuidByte0]);
+                continue;
+            }
+
+            if (element >= MSETransportGuidByte0 &&
+                element <= MSETransportGuidByte7)
+            {
+                if (s.hasTransportData)
+                    data.ReadByteSeq(s.tguid[element - MSETransportGuidByte0]);
+                continue;
+            }
+
+            if (element >= MSEGenericDword0 &&
+                element <= MSEGenericDword7)
+            {
+                data.read_skip<uint32>();
+                continue;
+            }
+
+            switch (element)
+            {
+                case MSEExtraElement:
+                    s.extras->ReadNextElement(data);
+                    break;
+                case MSEGeneric2bits0:
+                    data.ReadBits(2);
+                    break;
+                case MSEUnkUIntCount:
+                    s.bitcounterLoop = data.ReadBits(22);
+                    break;
+                case MSEUnkUIntLoop:
+                    for (uint32 i = 0; i != s.bitcounterLoop; i++)
+                        data.read_skip<uint32>();
+                    break;
+                case MSEFlushBits:
+                    data.FlushBits();
+                    break;
+                case MSEHasMovementFlags:
+                    mi->flags = !data.ReadBit();
+                    break;
+                case MSEHasMovementFlags2:
+                    mi->flags2 = !data.ReadBit();
+                    break;
+                case MSEHasTimestamp:
+                    mi->time = !data.ReadBit();
+                    break;
+                case MSEHasOrientation:
+                    mi->pos.m_orientation = !data.ReadBit() ? 1.0f : 0.0f;
+                    break;
+                case MSEHasTransportData:
+                    s.hasTransportData = data.ReadBit();
+                    break;
+                case MSEHasTransportTime2:
+                    if (s.hasTransportData)
+                        mi->has_t_time2 = data.ReadBit();
+                    break;
+                case MSEHasTransportTime3:
+                    if (s.hasTransportData)
+                        mi->has_t_time3 = data.ReadBit();
+                    break;
+                case MSEHasPitch:
+                    mi->HavePitch = !data.ReadBit();
+                    break;
+                case MSEHasFallData:
+                    mi->hasFallData = data.ReadBit();
+                    break;
+                case MSEHasFallDirection:
+                    if (mi->hasFallData)
+                        mi->hasFallDirection = data.ReadBit();
+                    break;
+                case MSEHasSplineElevation:
+                    mi->HaveSplineElevation = !data.ReadBit();
+                    break;
+                case MSEHasSpline:
+                    s.hasSpline = data.ReadBit();
+                    break;
+                case MSEMovementFlags:
+                    if (mi->flags)
+                        mi->flags = data.ReadBits(30);
+                    break;
+                case MSEMovementFlags2:
+                    if (mi->flags2)
+                        mi->flags2 = data.ReadBits(13);
+                    break;
+                case MSETimestamp:
+                    if (mi->time)
+                        data >> mi->time;
+                    break;
+                case MSEPositionX:
+                    data >> mi->pos.m_positionX;
+                    break;
+                case MSEPositionY:
+                    data >> mi->pos.m_positionY;
+                    break;
+                case MSEPositionZ:
+                    data >> mi->pos.m_positionZ;
+                    break;
+                case MSEOrientation:
+                    if (mi->pos.m_orientation != 0.0f)
+                        mi->pos.SetOrientation(data.read<float>());
+                    break;
+                case MSETransportPositionX:
+                    if (s.hasTransportData)
+                        data >> mi->t_pos.m_positionX;
+                    break;
+                case MSETransportPositionY:
+                    if (s.hasTransportData)
+                        data >> mi->t_pos.m_positionY;
+                    break;
+                case MSETransportPositionZ:
+                    if (s.hasTransportData)
+                        data >> mi->t_pos.m_positionZ;
+                    break;
+                case MSETransportOrientation:
+                    if (s.hasTransportData)
+                        mi->t_pos.SetOrientation(data.read<float>());
+                    break;
+                case MSETransportSeat:
+                    if (s.hasTransportData)
+                        data >> mi->t_seat;
+                    break;
+                case MSETransportTime:
+                    if (s.hasTransportData)
+                        data >> mi->t_time;
+                    break;
+                case MSETransportTime2:
+                    if (s.hasTransportData && mi->has_t_time2)
+                        data >> mi->t_time2;
+                    break;
+                case MSETransportTime3:
+                    if (s.hasTransportData && mi->has_t_time3)
+                        data >> mi->t_time3;
+                    break;
+                case MSEPitch:
+                    if (mi->HavePitch)
+                        data >> mi->pitch;
+                    break;
+                case MSEFallTime:
+                    if (mi->hasFallData)
+                        data >> mi->fallTime;
+                    break;
+                case MSEFallVerticalSpeed:
+                    if (mi->hasFallData)
+                        data >> mi->j_zspeed;
+                    break;
+                case MSEFallCosAngle:
+                    if (mi->hasFallData && mi->hasFallDirection)
+                        data >> mi->j_cosAngle;
+                    break;
+                case MSEFallSinAngle:
+                    if (mi->hasFallData && mi->hasFallDirection)
+                        data >> mi->j_sinAngle;
+                    break;
+                case MSEFallHorizontalSpeed:
+                    if (mi->hasFallData && mi->hasFallDirection)
+                        data >> mi->j_xyspeed;
+                    break;
+                case MSESplineElevation:
+                    if (mi->HaveSplineElevation)
+                        data >> mi->splineElevation;
+                    break;
+                case MSEZeroBit:
+                case MSEOneBit:
+                    data.ReadBit();
+                    break;
+                case MSEHasUnkTime:
+                    mi->Alive32 = !data.ReadBit();
+                    break;
+                case MSEUnkTime:
+                    if (mi->Alive32)
+                        data >> mi->Alive32;
+                    break;
+                case MSECounter:
+                    data.read_skip<uint32>();
+                    break;
+                default:
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    // former Unit::WriteMovementInfo loop, false on an element it could not write
+    bool ReferenceWrite(MovementStatusElements const* sequence, MovementWriteState& s)
+    {
+        WorldPacket& data = s.data;
+        MovementInfo const* mi = s.mi;
+
+        for (; *sequence != MSEEnd; ++sequence)
+        {
+            MovementStatusElements const& element = *sequence;
+
+            if (element >= MSEHasGuidByte0 && element <= MSEHasGuidByte7)
+            {
+                data.WriteBit(s.guid[element - MSEHasGuidByte0]);
+                continue;
+            }
+
+            if (element >= MSEHasTransportGuidByte0 &&
+                element <= MSEHasTransportGuidByte7)
+            {
+                if (s.hasTransportData)
+                    data.WriteBit(s.tguid[element - MSEHasTransportGuidByte0]);
+                continue;
+            }
+
+            if (element >= MSEGuidByte0 && element <= MSEGuidByte7)
+            {
+                data.WriteByteSeq(s.guid[element - MSEGuidByte0]);
+                continue;
+            }
+
+            if (element >= MSETransportGuidByte0 &&
+                element <= MSETransportGuidByte7)
+            {
+                if (s.hasTransportData)
+                    data.WriteByteSeq(s.tguid[element - MSETransportGuidByte0]);
+                continue;
+            }
+
+            switch (element)
+            {
+                case MSEExtraElement:
+                    s.extras->WriteNextElement(data);
+                    break;
+                case MSEUnkUIntCount:
+                    data.WriteBits(0, 22);
+                    break;
+                case MSEUnkUIntLoop:
+                    break;
+                case MSECounter:
+                    data << uint32(0);
+                    break;
+                case MSEFlushBits:
+                    data.FlushBits();
+                    break;
+                case MSEHasMovementFlags:
+                    data.WriteBit(!s.hasMovementFlags);
+                    break;
+                case MSEHasMovementFlags2:
+                    data.WriteBit(!s.hasMovementFlags2);
+                    break;
+                case MSEHasTimestamp:
+                    data.WriteBit(!mi->time);
+                    break;
+                case MSEHasOrientation:
+                    data.WriteBit(!mi->pos.HasOrientation());
+                    break;
+                case MSEHasTransportData:
+                    data.WriteBit(s.hasTransportData);
+                    break;
+                case MSEHasTransportTime2:
+                    if (s.hasTransportData)
+                        data.WriteBit(mi->has_t_time2);
+                    break;
+                case MSEHasTransportTime3:
+                    if (s.hasTransportData)
+                        data.WriteBit(mi->has_t_time3);
+                    break;
+                case MSEHasPitch:
+                    data.WriteBit(!mi->HavePitch);
+                    break;
+                case MSEHasFallData:
+                    data.WriteBit(mi->hasFallData);
+                    break;
+                case MSEHasFallDirection:
+                    if (mi->hasFallData)
+                        data.WriteBit(mi->hasFallDirection);
+                    break;
+                case MSEHasSplineElevation:
+                    data.WriteBit(!mi->HaveSplineElevation);
+                    break;
+                case MSEHasSpline:
+                    data.WriteBit(s.hasSpline);
+                    break;
+                case MSEMovementFlags:
+                    if (s.hasMovementFlags)
+                        data.WriteBits(mi->flags, 30);
+                    break;
+                case MSEMovementFlags2:
+                    if (s.hasMovementFlags2)
+                        data.WriteBits(mi->flags2, 13);
+                    break;
+                case MSETimestamp:
+                    if (mi->time)
+                        data << mi->time;
+                    break;
+                case MSEPositionX:
+                    data << mi->pos.m_positionX;
+                    break;
+                case MSEPositionY:
+                    data << mi->pos.m_positionY;
+                    break;
+                case MSEPositionZ:
+                    data << mi->pos.m_positionZ;
+                    break;
+                case MSEOrientation:
+                    if (mi->pos.HasOrientation())
+                        data << mi->pos.GetOrientation();
+                    break;
+                case MSETransportPositionX:
+                    if (s.hasTransportData)
+                        data << mi->t_pos.m_positionX;
+                    break;
+                case MSETransportPositionY:
+                    if (s.hasTransportData)
+                        data << mi->t_pos.m_positionY;
+                    break;
+                case MSETransportPositionZ:
+                    if (s.hasTransportData)
+                        data << mi->t_pos.m_positionZ;
+                    break;
+                case MSETransportOrientation:
+                    if (s.hasTransportData)
+                        data << mi->t_pos.GetOrientation();
+                    break;
+                case MSETransportSeat:
+                    if (s.hasTransportData)
+                        data << mi->t_seat;
+                    break;
+                case MSETransportTime:
+                    if (s.hasTransportData)
+                        data << mi->t_time;
+                    break;
+                case MSETransportTime2:
+                    if (s.hasTransportData && mi->has_t_time2)
+                        data << mi->t_time2;
+                    break;
+                case MSETransportTime3:
+                    if (s.hasTransportData && mi->has_t_time3)
+                        data << mi->t_time3;
+                    break;
+                case MSEPitch:
+                    if (mi->HavePitch)
+                        data << mi->pitch;
+                    break;
+                case MSEFallTime:
+                    if (mi->hasFallData)
+                        data << mi->fallTime;
+                    break;
+                case MSEFallVerticalSpeed:
+                    if (mi->hasFallData)
+                        data << mi->j_zspeed;
+                    break;
+                case MSEFallCosAngle:
+                    if (mi->hasFallData && mi->hasFallDirection)
+                        data << mi->j_cosAngle;
+                    break;
+                case MSEFallSinAngle:
+                    if (mi->hasFallData && mi->hasFallDirection)
+                        data << mi->j_sinAngle;
+                    break;
+                case MSEFallHorizontalSpeed:
+                    if (mi->hasFallData && mi->hasFallDirection)
+                        data << mi->j_xyspeed;
+                    break;
+                case MSESplineElevation:
+                    if (mi->HaveSplineElevation)
+                        data << mi->splineElevation;
+                    break;
+                case MSEZeroBit:
+                    data.WriteBit(0);
+                    break;
+                case MSEOneBit:
+                    data.WriteBit(1);
+                    break;
+                case MSEHasUnkTime:
+                    data.WriteBit(!mi->Alive32);
+                    break;
+                case MSEUnkTime:
+                    if (mi->Alive32)
+                        data << mi->Alive32;
+                    break;
+                default:
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    // deterministic, the same packets are checked at every run
+    uint32 NextRandom(uint32& seed)
+    {
+        seed = seed * 1103515245 + 12345;
+        return seed >> 8;
+    }
+
+    bool SameBits(float a, float b) { return memcmp(&a, &b, sizeof(float)) == 0; }
+
+    bool SameGuid(ObjectGuid const& a, ObjectGuid const& b)
+    {
+        for (uint32 i = 0; i < sizeof(uint64); ++i)
+            if (a[i] != b[i])
+                return false;
+
+        return true;
+    }
+
+    bool SamePosition(Position const& a, Position const& b)
+    {
+        return SameBits(a.m_positionX, b.m_positionX) && SameBits(a.m_positionY, b.m_positionY) &&
+            SameBits(a.m_positionZ, b.m_positionZ) && SameBits(a.GetOrientation(), b.GetOrientation());
+    }
+
+    bool SameReadResult(MovementReadState const& a, MovementReadState const& b)
+    {
+        MovementInfo const& x = *a.mi;
+        MovementInfo const& y = *b.mi;
+
+        return SameGuid(a.guid, b.guid) && SameGuid(a.tguid, b.tguid) &&
+            a.hasTransportData == b.hasTransportData && a.hasSpline == b.hasSpline && a.bitcounterLoop == b.bitcounterLoop &&
+            a.data.rpos() == b.data.rpos() &&
+            x.flags == y.flags && x.flags2 == y.flags2 && x.time == y.time && SamePosition(x.pos, y.pos) &&
+            SamePosition(x.t_pos, y.t_pos) && x.t_seat == y.t_seat && x.t_time == y.t_time &&
+            x.t_time2 == y.t_time2 && x.t_time3 == y.t_time3 && x.has_t_time2 == y.has_t_time2 && x.has_t_time3 == y.has_t_time3 &&
+            x.HavePitch == y.HavePitch && x.fallTime == y.fallTime && x.hasFallData == y.hasFallData &&
+            x.hasFallDirection == y.hasFallDirection && SameBits(x.j_zspeed, y.j_zspeed) && SameBits(x.j_cosAngle, y.j_cosAngle) &&
+            SameBits(x.j_sinAngle, y.j_sinAngle) && SameBits(x.j_xyspeed, y.j_xyspeed) &&
+            x.HaveSplineElevation == y.HaveSplineElevation && x.Alive32 == y.Alive32 &&
+            SameGuid(a.extras->Data.guid, b.extras->Data.guid) && SameBits(a.extras->Data.floatData, b.extras->Data.floatData) &&
+            a.extras->Data.byteData == b.extras->Data.byteData;
+    }
+
+    void FillMovementInfo(MovementInfo& mi, uint32 variant, uint32& seed)
+    {
+        mi.guid = (uint64(NextRandom(seed)) << 32) | NextRandom(seed);
+        mi.flags = (variant & 0x001) ? NextRandom(seed) & 0x3FFFFFFF : 0;
+        mi.flags2 = (variant & 0x002) ? NextRandom(seed) & 0x1FFF : 0;
+        mi.time = (variant & 0x004) ? NextRandom(seed) : 0;
+        mi.pos.Relocate(float(NextRandom(seed) % 20000) / 3.0f, -float(NextRandom(seed) % 20000) / 7.0f, float(NextRandom(seed) % 500) / 11.0f,
+            (variant & 0x008) ? float(NextRandom(seed) % 600) / 100.0f : 0.0f);
+
+        if (variant & 0x010)
+        {
+            mi.t_guid = (uint64(NextRandom(seed)) << 32) | NextRandom(seed) | 1;
+            mi.t_pos.Relocate(float(NextRandom(seed) % 100) / 3.0f, float(NextRandom(seed) % 100) / 7.0f, float(NextRandom(seed) % 100) / 11.0f, 1.5f);
+            mi.t_seat = int8(NextRandom(seed) % 8);
+            mi.t_time = NextRandom(seed);
+            mi.has_t_time2 = (variant & 0x020) != 0;
+            mi.t_time2 = NextRandom(seed);
+            mi.has_t_time3 = (variant & 0x040) != 0;
+            mi.t_time3 = NextRandom(seed);
+        }
+
+        if (variant & 0x080)
+            mi.pitch = float(NextRandom(seed) % 300) / 100.0f;
+
+        if (variant & 0x100)
+        {
+            mi.hasFallData = true;
+            mi.fallTime = NextRandom(seed);
+            mi.j_zspeed = float(NextRandom(seed) % 100) / 9.0f;
+            mi.hasFallDirection = (variant & 0x200) != 0;
+            mi.j_cosAngle = 0.6f;
+            mi.j_sinAngle = 0.8f;
+            mi.j_xyspeed = float(NextRandom(seed) % 100) / 13.0f;
+        }
+
+        if (variant & 0x400)
+            mi.splineElevation = float(NextRandom(seed) % 100) / 17.0f;
+
+        mi.Alive32 = (variant & 0x800) ? NextRandom(seed) : 0;
+    }
+
+    // spreads the flags of the variants over every combination of the optional parts
+    uint32 GetVariantFlags(uint32 variant)
+    {
+        if (!variant)
+            return 0;
+
+        if (variant == MOVEMENT_CHECK_VARIANTS - 1)
+            return 0xFFFF;
+
+        uint32 seed = variant;
+        return NextRandom(seed) & 0xFFFF;
+    }
+
+    // reads packet with the codec and the reference, both from the start, false if they differ
+    bool CheckRead(MovementCodec const* codec, MovementStatusElements const* sequence, WorldPacket const& packet, std::vector<MovementStatusElements> const& extraSequence)
+    {
+        WorldPacket codecData(packet);
+        WorldPacket referenceData(packet);
+        codecData.rpos(0);
+        referenceData.rpos(0);
+
+        MovementInfo codecInfo;
+        MovementInfo referenceInfo;
+        ExtraMovementStatusElement codecExtras(&extraSequence[0]);
+        ExtraMovementStatusElement referenceExtras(&extraSequence[0]);
+        MovementReadState codecState(codecData, &codecInfo, &codecExtras);
+        MovementReadState referenceState(referenceData, &referenceInfo, &referenceExtras);
+
+        // random packets may end before their sequence, both have to stop at the same element
+        bool codecEnded = false;
+        bool referenceEnded = false;
+
+        try
+        {
+            if (!ReferenceRead(sequence, referenceState))
+                return true;                                // not a client sequence, the codec asserts there as the interpreter did
+        }
+        catch (ByteBufferException const&)
+        {
+            referenceEnded = true;
+        }
+
+        try
+        {
+            codec->Read(codecState);
+        }
+        catch (ByteBufferException const&)
+        {
+            codecEnded = true;
+        }
+
+        return codecEnded == referenceEnded && SameReadResult(codecState, referenceState);
+    }
+}
+
+int main()
+{
+    InitOpcodes();
+    LoadMovementCodecs();
+
+    uint32 oldMSTime = getMSTime();
+
+    uint32 opcodes = 0;
+    uint32 packets = 0;
+    uint32 failures = 0;
+
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        MovementStatusElements const* sequence = GetMovementStatusElementsSequence(Opcodes(opcode));
+        if (!sequence)
+            continue;
+
+        MovementCodec const* codec = GetMovementCodec(Opcodes(opcode));
+        if (!codec)
+        {
+            printf("no codec for opcode 0x%04X\n", opcode);
+            ++failures;
+            continue;
+        }
+
+        ++opcodes;
+
+        // the extra elements of the packet senders are read and written as floats
+        uint32 extraCount = 0;
+        for (MovementStatusElements const* element = sequence; *element != MSEEnd; ++element)
+            if (*element == MSEExtraElement)
+                ++extraCount;
+
+        std::vector<MovementStatusElements> extraSequence(extraCount, MSEExtraFloat);
+        extraSequence.push_back(MSEEnd);
+
+        uint32 seed = opcode;
+        bool failed = false;
+
+        for (uint32 variant = 0; variant < MOVEMENT_CHECK_VARIANTS && !failed; ++variant)
+        {
+            uint32 flags = GetVariantFlags(variant);
+
+            MovementInfo mi;
+            FillMovementInfo(mi, flags, seed);
+
+            WorldPacket codecData(Opcodes(opcode), 128);
+            WorldPacket referenceData(Opcodes(opcode), 128);
+            ExtraMovementStatusElement codecExtras(&extraSequence[0]);
+            ExtraMovementStatusElement referenceExtras(&extraSequence[0]);
+            codecExtras.Data.floatData = referenceExtras.Data.floatData = float(variant) / 3.0f;
+
+            MovementWriteState codecState(codecData, &mi, &codecExtras);
+            MovementWriteState referenceState(referenceData, &mi, &referenceExtras);
+            codecState.hasMovementFlags = referenceState.hasMovementFlags = mi.GetMovementFlags() != 0;
+            codecState.hasMovementFlags2 = referenceState.hasMovementFlags2 = mi.GetExtraMovementFlags() != 0;
+            codecState.hasTransportData = referenceState.hasTransportData = mi.t_guid != 0LL;
+            codecState.hasSpline = referenceState.hasSpline = (flags & 0x1000) != 0;
+            codecState.guid = referenceState.guid = mi.guid;
+            codecState.tguid = referenceState.tguid = mi.t_guid;
+
+            // server sequences: both encodings must be identical, then decode the same
+            if (ReferenceWrite(sequence, referenceState))
+            {
+                codec->Write(codecState);
+                codecData.FlushBits();
+                referenceData.FlushBits();
+                ++packets;
+
+                if (codecData.size() != referenceData.size() ||
+                    (codecData.size() && memcmp(codecData.contents(), referenceData.contents(), codecData.size())))
+                {
+                    printf("%s variant %u is written differently\n",
+                        GetOpcodeNameForLogging(Opcodes(opcode), WOW_SERVER).c_str(), variant);
+                    failed = true;
+                    break;
+                }
+
+                if (!CheckRead(codec, sequence, referenceData, extraSequence))
+                {
+                    printf("%s variant %u is read back differently\n",
+                        GetOpcodeNameForLogging(Opcodes(opcode), WOW_SERVER).c_str(), variant);
+                    failed = true;
+                    break;
+                }
+            }
+
+            // client sequences: whatever the bytes, both decode the same
+            WorldPacket random(Opcodes(opcode), MOVEMENT_CHECK_RANDOM_SIZE);
+            for (uint32 i = 0; i < MOVEMENT_CHECK_RANDOM_SIZE; ++i)
+                random << uint8(NextRandom(seed));
+
+            ++packets;
+            if (!CheckRead(codec, sequence, random, extraSequence))
+            {
+                printf("%s random packet %u is read differently\n",
+                    GetOpcodeNameForLogging(Opcodes(opcode), WOW_CLIENT).c_str(), variant);
+                failed = true;
+            }
+        }
+
+        if (failed)
+            ++failures;
+    }
+
+    if (failures)
+    {
+        printf("%u of %u movement codecs don't match the movement status sequences\n", failures, opcodes);
+        return 1;
+    }
+
+    printf("Checked %u movement codecs on %u packets in %u ms\n", opcodes, packets, GetMSTimeDiffToNow(oldMSTime));
+    return 0;
+}